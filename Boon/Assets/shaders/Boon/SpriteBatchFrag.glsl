@@ -8,12 +8,35 @@ struct BoonSpriteBatchVertexInput
 layout (location = 0) in BoonSpriteBatchVertexInput Input;
 layout (location = 3) in flat float v_TexIndex;
 layout (location = 4) in flat int v_ID;
+layout (location = 5) in flat int v_MaterialSlot;
 
 layout(location = 0) out vec4 o_Color;
 layout(location = 1) out int o_Id;
 
 layout (binding = 0) uniform sampler2D u_Textures[32];
 
+// Batched quads share one draw across material instances. Define
+// BOON_MATERIAL_PAGE as the @material_binding before including this file and
+// read the @material parameters by their byte offset; each quad indexes its
+// own block in the shared page. The page is 16 KB (MaterialUniformPool::PageSize),
+// the smallest GL_MAX_UNIFORM_BLOCK_SIZE a driver may report.
+#ifdef BOON_MATERIAL_PAGE
+layout(std140, binding = BOON_MATERIAL_PAGE) uniform BoonMaterialPage
+{
+    vec4 u_MaterialPage[1024];
+};
+
+vec4 Boon_MaterialVec4(int offset)
+{
+    return u_MaterialPage[v_MaterialSlot + offset / 16];
+}
+
+float Boon_MaterialFloat(int offset)
+{
+    return u_MaterialPage[v_MaterialSlot + offset / 16][(offset % 16) / 4];
+}
+#endif
+
 vec4 Boon_SampleSpriteTexture()
 {
     vec4 texColor = Input.Color;
@@ -8,6 +8,7 @@
 // @vertex float a_TexIndex
 // @vertex float a_TilingFactor
 // @vertex int a_ID
+// @vertex int a_MaterialSlot
 
 layout(location = 0) in vec3 a_Position;
 layout(location = 1) in vec4 a_Color;
@@ -15,6 +16,7 @@ layout(location = 2) in vec2 a_TexCoord;
 layout(location = 3) in float a_TexIndex;
 layout(location = 4) in float a_TilingFactor;
 layout(location = 5) in int a_ID;
+layout(location = 6) in int a_MaterialSlot;
 
 struct VertexOutput
 {
@@ -26,6 +28,7 @@ struct VertexOutput
 layout (location = 0) out VertexOutput Output;
 layout (location = 3) out flat float v_TexIndex;
 layout (location = 4) out flat int v_ID;
+layout (location = 5) out flat int v_MaterialSlot;
 
 layout(std140, binding = 0) uniform Camera
 {
@@ -40,6 +43,7 @@ void main()
 	Output.TilingFactor = a_TilingFactor;
 	v_TexIndex = a_TexIndex;
 	v_ID = a_ID;
+	v_MaterialSlot = a_MaterialSlot;
 
 	gl_Position = u_ViewProjection * vec4(a_Position, 1.0);
 }
@@ -0,0 +1,90 @@
+#vert
+
+#version 450 core
+
+// @vertex vec3 a_Position
+// @vertex vec2 a_TileCoord
+// @vertex vec3 a_Slot
+
+layout(location = 0) in vec3 a_Position;
+layout(location = 1) in vec2 a_TileCoord;
+layout(location = 2) in vec3 a_Slot;
+
+layout (location = 0) out vec2 v_TileCoord;
+layout (location = 1) flat out vec3 v_Slot;
+
+layout(std140, binding = 0) uniform Camera
+{
+	mat4 u_ViewProjection;
+};
+
+layout(std140, binding = 1) uniform Object
+{
+	mat4 u_world;
+	int u_ID;
+};
+
+
+void main()
+{
+	v_TileCoord = a_TileCoord;
+	v_Slot = a_Slot;
+
+	gl_Position = u_ViewProjection * u_world * vec4(a_Position, 1.0);
+}
+
+#frag
+
+#version 450 core
+
+// @texture u_Texture 0
+// @texture u_TileIndices 1
+// @texture u_FrameTable 2
+
+// Must match Tilemap::FrameTableWidth
+#define FRAME_TABLE_WIDTH 256
+
+layout (location = 0) in vec2 v_TileCoord;
+layout (location = 1) flat in vec3 v_Slot;
+
+layout(location = 0) out vec4 o_Color;
+layout(location = 1) out int o_Id;
+
+layout (binding = 0) uniform sampler2D u_Texture;
+layout (binding = 1) uniform isampler2D u_TileIndices;
+layout (binding = 2) uniform sampler2D u_FrameTable;
+
+layout(std140, binding = 1) uniform Object
+{
+	mat4 u_world;
+	int u_ID;
+};
+
+void main()
+{
+	// v_Slot.xy: slot origin in the tile index texture, v_Slot.z: chunk size
+	ivec2 tile = clamp(ivec2(floor(v_TileCoord)), ivec2(0), ivec2(int(v_Slot.z) - 1));
+	int tileId = texelFetch(u_TileIndices, ivec2(v_Slot.xy) + tile, 0).r;
+	if (tileId < 0)
+		discard;
+
+	vec4 frame = texelFetch(u_FrameTable, ivec2(tileId % FRAME_TABLE_WIDTH, tileId / FRAME_TABLE_WIDTH), 0);
+	if (frame.z <= 0.0)
+		discard;
+
+	// Same padding as the mesh path
+	const float epsilon = 0.0005;
+	vec2 local = fract(v_TileCoord);
+	vec2 uv = frame.xy + mix(vec2(epsilon), frame.zw - vec2(epsilon), local);
+
+	// Derivatives from the continuous coordinate avoid seams at tile borders
+	vec2 dx = dFdx(v_TileCoord) * frame.zw;
+	vec2 dy = dFdy(v_TileCoord) * frame.zw;
+	vec4 color = textureGrad(u_Texture, uv, dx, dy);
+
+	if (color.a == 0.0)
+		discard;
+
+	o_Color = color;
+	o_Id = u_ID;
+}
@@ -23,8 +23,13 @@ namespace Boon
 
         std::shared_ptr<Prefab> GetInstance()
         {
-            return nullptr;
+            return m_Instance;
         }
+
+    private:
+        friend struct AssetSerializer<PrefabAsset>;
+
+        std::shared_ptr<Prefab> m_Instance = std::make_shared<Prefab>();
     };
 
     template<>
@@ -37,14 +42,22 @@ namespace Boon
     template<>
     struct AssetSerializer<PrefabAsset>
     {
-        static PrefabAsset* Load(Buffer&, const AssetMeta& meta)
+        static PrefabAsset* Load(Buffer& buffer, const AssetMeta& meta)
         {
-            return new PrefabAsset(meta.uuid);
+            // An empty or unreadable file loads as an empty prefab
+            auto* asset = new PrefabAsset(meta.uuid);
+            asset->m_Instance->Deserialize(buffer);
+            return asset;
         }
 
-        static Buffer Serialize(PrefabAsset*)
+        static Buffer Serialize(PrefabAsset* asset)
         {
-            return {};
+            Buffer out;
+
+            if (asset)
+                asset->m_Instance->Serialize(out);
+
+            return out;
         }
     };
 }
@@ -9,6 +9,7 @@
 
 #include "Renderer/ShaderCompiler/ShaderReflection.h"
 #include "Renderer/ShaderCompiler/GLSLReflectionProvider.h"
+#include "Renderer/ShaderCompiler/ShaderCache.h"
 
 #include <memory>
 #include <string>
@@ -28,7 +29,7 @@ namespace Boon
         std::shared_ptr<Shader> GetInstance()
         {
             if (!m_RuntimeShader)
-                m_RuntimeShader = Shader::Create(m_VertexSource, m_FragmentSource);
+                m_RuntimeShader = Shader::Create(m_VertexSource, m_FragmentSource, m_CacheKey);
 
             return m_RuntimeShader;
         }
@@ -40,11 +41,17 @@ namespace Boon
         const VertexBufferLayout& GetVertexLayout() const { return m_Reflection.VertexLayout; }
         const MaterialLayout& GetMaterialLayout() const { return m_Reflection.MaterialLayout; }
 
+        /**
+         * @brief ShaderCache key of the resolved sources.
+         */
+        uint64_t GetCacheKey() const { return m_CacheKey; }
+
     private:
         std::string m_VertexSource;
         std::string m_FragmentSource;
         mutable std::shared_ptr<Shader> m_RuntimeShader = nullptr;
         ShaderReflection m_Reflection;
+        uint64_t m_CacheKey = 0;
 
         friend class ShaderImporter;
         friend struct AssetSerializer<ShaderAsset>;
@@ -68,10 +75,21 @@ namespace Boon
             asset->m_VertexSource = buffer.ReadString(cursor);
             asset->m_FragmentSource = buffer.ReadString(cursor);
 
-            GLSLReflectionProvider provider;
-            asset->m_Reflection = provider.Reflect(
-                asset->m_VertexSource,
-                asset->m_FragmentSource);
+            asset->m_CacheKey = ShaderCache::ComputeKey(asset->m_VertexSource, asset->m_FragmentSource);
+
+            if (auto cached = ShaderCache::LoadReflection(asset->m_CacheKey))
+            {
+                asset->m_Reflection = std::move(*cached);
+            }
+            else
+            {
+                GLSLReflectionProvider provider;
+                asset->m_Reflection = provider.Reflect(
+                    asset->m_VertexSource,
+                    asset->m_FragmentSource);
+
+                ShaderCache::StoreReflection(asset->m_CacheKey, asset->m_Reflection);
+            }
 
             return asset;
         }
@@ -1,62 +1,25 @@
 #pragma once
-#include <Component/IECSSystem.h>
-#include <Component/SpriteAnimatorComponent.h>
-#include <Component/RenderComponents.h>
+#include <cstddef>
 
 namespace Boon
 {
-    //class SpriteAnimatorSystem : public IECSSystem
-    //{
-    //public:
-    //    virtual void OnUpdate(Scene& scene) override
-    //    {
-    //        auto group = scene.GetAllGameObjectsWith<SpriteAnimatorComponent, SpriteRendererComponent>();
-    //        for (auto gameObject : group)
-    //        {
-    //            auto [animator, renderer] = group.get<SpriteAnimatorComponent, SpriteRendererComponent>(gameObject);
-    //
-    //            if (!animator.bPlaying)
-    //                continue;
-    //
-    //            if (!animator.Atlas)
-    //                continue;
-    //
-    //            if (animator.GetClipId() < 0 || animator.GetClipId() >= animator.Atlas->GetClips().size())
-    //                continue;
-    //
-    //            SpriteAnimClip& clip = animator.GetClip();
-    //            if (clip.Frames.empty())
-    //                continue;
-    //
-    //            if (animator.CurrentFrame >= clip.Frames.size())
-    //                animator.CurrentFrame = 0;
-    //
-    //            const int frameId = clip.Frames[animator.CurrentFrame];
-    //            const float frameTime = animator.Atlas->GetSpriteFrame(frameId).FrameTime;
-    //
-    //            animator.Time += Time::Get().GetDeltaTime() * clip.Speed * animator.Speed;
-    //
-    //            if (animator.Time >= frameTime)
-    //            {
-    //                animator.Time = 0.0f;
-    //                animator.CurrentFrame++;
-    //
-    //                if (animator.CurrentFrame >= clip.Frames.size())
-    //                {
-    //                    animator.CurrentFrame = animator.bLooping ? 0 : static_cast<int>(clip.Frames.size()) - 1;
-    //                    animator.bPlaying = animator.bLooping;
-    //                }
-    //
-    //                animator.bDirty = true;
-    //            }
-    //
-    //            if (animator.bDirty)
-    //            {
-    //                renderer.Frame = clip.Frames[animator.CurrentFrame];
-    //                renderer.pAtlas = animator.Atlas;
-    //                animator.bDirty = false;
-    //            }
-    //        }
-    //    }
-    //};
-}
\ No newline at end of file
+    class Scene;
+
+    /**
+     * @brief Advances every SpriteAnimatorComponent of a scene in one batched pass.
+     *
+     * Animators that drive the renderer on their own game object are updated
+     * from the packed animator + renderer view, in parallel on the JobSystem
+     * when it is running. Atlases are resolved through the asset library only
+     * when a renderer's atlas handle changes, on the calling thread. Animators
+     * that point at a renderer on another game object are updated serially
+     * afterwards, since several of them may share one renderer.
+     */
+    class SpriteAnimatorSystem final
+    {
+    public:
+        static constexpr size_t BatchSize = 1024;
+
+        static void Update(Scene& scene, float deltaTime);
+    };
+}
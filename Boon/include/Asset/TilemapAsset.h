@@ -55,11 +55,18 @@ namespace Boon
     template<>
     struct AssetSerializer<TilemapAsset>
     {
+        // Leads the sparse payload; older dense payloads start with chunksX, which is never negative
+        static constexpr int SparseTag = -2;
+
         static TilemapAsset* Load(Buffer& buffer, const AssetMeta& meta)
         {
             size_t cursor = 0;
 
-            const int chunksX = buffer.Read<int>(cursor);
+            const int first = buffer.Read<int>(cursor);
+            if (first == SparseTag)
+                return LoadSparse(buffer, cursor, meta);
+
+            const int chunksX = first;
             const int chunksY = buffer.Read<int>(cursor);
             const int chunkSize = buffer.Read<int>(cursor);
 
@@ -95,28 +102,70 @@ namespace Boon
             if (!tilemap)
                 return out;
 
-            const int chunksX = tilemap->GetChunksX();
-            const int chunksY = tilemap->GetChunksY();
-            const int chunkSize = tilemap->GetChunkSize();
-
-            out.Write<int>(chunksX);
-            out.Write<int>(chunksY);
-            out.Write<int>(chunkSize);
+            out.Write<int>(SparseTag);
+            out.Write<int>(tilemap->GetChunksX());
+            out.Write<int>(tilemap->GetChunksY());
+            out.Write<int>(tilemap->GetChunkSize());
 
             out.Write<AssetHandle>(tilemap->GetAtlas().Handle());
 
-            const int width = chunksX * chunkSize;
-            const int height = chunksY * chunkSize;
+            // Only chunks with tiles, each compressed on its own
+            uint32_t chunkCount = 0;
+            for (const auto& [key, chunk] : tilemap->GetChunks())
+                chunkCount += chunk.TileCount > 0;
 
-            for (int y = 0; y < height; ++y)
+            out.Write<uint32_t>(chunkCount);
+
+            Buffer compressed;
+            for (const auto& [key, chunk] : tilemap->GetChunks())
             {
-                for (int x = 0; x < width; ++x)
-                {
-                    out.Write<int>(tilemap->GetTile(x, y));
-                }
+                if (chunk.TileCount == 0)
+                    continue;
+
+                compressed.Clear();
+                TilemapChunkStore::EncodeTiles(chunk.Tiles.data(), chunk.Tiles.size(), compressed);
+
+                out.Write<int>(chunk.ChunkX);
+                out.Write<int>(chunk.ChunkY);
+                out.Write<uint32_t>(static_cast<uint32_t>(compressed.Size()));
+                out.Append(compressed);
             }
 
             return out;
         }
+
+    private:
+        static TilemapAsset* LoadSparse(Buffer& buffer, size_t& cursor, const AssetMeta& meta)
+        {
+            const int chunksX = buffer.Read<int>(cursor);
+            const int chunksY = buffer.Read<int>(cursor);
+            const int chunkSize = buffer.Read<int>(cursor);
+
+            const AssetHandle atlasHandle = buffer.Read<AssetHandle>(cursor);
+
+            std::shared_ptr<Tilemap> tilemap = std::make_shared<Tilemap>(chunksX, chunksY, chunkSize);
+            tilemap->SetAtlas(AssetRef<SpriteAtlasAsset>(atlasHandle));
+
+            const uint32_t chunkCount = buffer.Read<uint32_t>(cursor);
+            const size_t tilesPerChunk = static_cast<size_t>(chunkSize) * chunkSize;
+
+            for (uint32_t i = 0; i < chunkCount; ++i)
+            {
+                const int chunkX = buffer.Read<int>(cursor);
+                const int chunkY = buffer.Read<int>(cursor);
+                const uint32_t size = buffer.Read<uint32_t>(cursor);
+
+                if (cursor + size > buffer.Size())
+                    break;
+
+                std::vector<int> tiles(tilesPerChunk);
+                if (TilemapChunkStore::DecodeTiles(buffer.DataAt(cursor), size, tiles.data(), tiles.size()))
+                    tilemap->SetChunkTiles(chunkX, chunkY, std::move(tiles));
+
+                cursor += size;
+            }
+
+            return new TilemapAsset(meta.uuid, tilemap);
+        }
     };
 }
@@ -0,0 +1,268 @@
+#pragma once
+#include "BoonDebug/LogTypes.h"
+#include "Core/Threading/SPSCRingBuffer.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <format>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace Boon
+{
+    /**
+     * @brief Fixed-size binary log record pushed by producers into their ring.
+     *
+     * Deferred records carry the format string and the raw argument bytes;
+     * the backend thread turns them into text through Format. Text records
+     * carry an already formatted message, inline or on the heap when it does
+     * not fit the payload.
+     */
+    struct alignas(CacheLineSize) LogRecord
+    {
+        enum class EKind : uint8_t
+        {
+            Deferred,
+            Text,
+            HeapText
+        };
+
+        using FormatFn = void(*)(std::string& /*out*/, std::string_view /*fmt*/, const uint8_t* /*args*/);
+
+        struct RecordHeader
+        {
+            FormatFn Format;
+            const char* Fmt;
+            uint32_t FmtSize;
+            uint16_t PayloadSize;
+            LogLevel Level;
+            EKind Kind;
+        };
+
+        static constexpr size_t Size = 256;
+        static constexpr size_t PayloadCapacity = Size - sizeof(RecordHeader);
+
+        RecordHeader Header;
+        uint8_t Payload[PayloadCapacity];
+    };
+    static_assert(sizeof(LogRecord) == LogRecord::Size, "LogRecord must stay one fixed-size slot");
+
+    // -------------------------------------------------------------------------
+    // Raw argument encoding for deferred records
+    // -------------------------------------------------------------------------
+    namespace LogArgs
+    {
+        template<typename T>
+        inline constexpr bool IsString = std::is_convertible_v<const T&, std::string_view>;
+
+        // Arguments are copied byte-wise; pointers (other than strings) would
+        // dangle by the time the backend formats them.
+        template<typename T>
+        inline constexpr bool IsDeferrable = IsString<T> || (std::is_trivially_copyable_v<T> && !std::is_pointer_v<T>);
+
+        template<typename T>
+        using Decoded = std::conditional_t<IsString<T>, std::string_view, T>;
+
+        template<typename T>
+        inline size_t EncodedSize(const T& value)
+        {
+            if constexpr (IsString<T>)
+                return sizeof(uint32_t) + std::string_view(value).size();
+            else
+                return sizeof(T);
+        }
+
+        template<typename T>
+        inline uint8_t* Encode(uint8_t* dst, const T& value)
+        {
+            if constexpr (IsString<T>)
+            {
+                const std::string_view str(value);
+                const uint32_t len = static_cast<uint32_t>(str.size());
+                std::memcpy(dst, &len, sizeof(len));
+                std::memcpy(dst + sizeof(len), str.data(), len);
+                return dst + sizeof(len) + len;
+            }
+            else
+            {
+                std::memcpy(dst, &value, sizeof(T));
+                return dst + sizeof(T);
+            }
+        }
+
+        template<typename T>
+        inline Decoded<T> Decode(const uint8_t*& src)
+        {
+            if constexpr (IsString<T>)
+            {
+                uint32_t len;
+                std::memcpy(&len, src, sizeof(len));
+                const std::string_view str(reinterpret_cast<const char*>(src + sizeof(len)), len);
+                src += sizeof(len) + len;
+                return str;
+            }
+            else
+            {
+                T value;
+                std::memcpy(&value, src, sizeof(T));
+                src += sizeof(T);
+                return value;
+            }
+        }
+
+        template<typename... Ts>
+        void FormatDeferred(std::string& out, std::string_view fmt, const uint8_t* args)
+        {
+            const uint8_t* cursor = args;
+            // Braced init guarantees left to right decoding
+            std::tuple<Decoded<Ts>...> values{ Decode<Ts>(cursor)... };
+            (void)cursor;
+
+            std::apply([&](auto&... v) { out = std::vformat(fmt, std::make_format_args(v...)); }, values);
+        }
+    }
+
+    /**
+     * @brief Background logging backend fed by per-thread SPSC rings.
+     *
+     * Producers never format or touch sinks: they copy a format string pointer
+     * and their raw arguments into a fixed-size record in their own ring. A
+     * single worker thread drains all rings, formats the records and hands
+     * the text to the write callback (the Logger's sinks). When a ring is
+     * full the record is dropped and counted; the worker reports drops as a
+     * warning once it catches up.
+     */
+    class AsyncLogBackend final
+    {
+    public:
+        using WriteFn = std::function<void(LogLevel, const std::string&)>;
+
+        /**
+         * @param ringCapacity Records per producer thread.
+         * @param write Callback invoked on the worker thread for every formatted message.
+         */
+        AsyncLogBackend(size_t ringCapacity, WriteFn write);
+
+        /**
+         * @brief Drain every pending record and stop the worker thread.
+         */
+        ~AsyncLogBackend();
+
+        AsyncLogBackend(const AsyncLogBackend&) = delete;
+        AsyncLogBackend& operator=(const AsyncLogBackend&) = delete;
+
+        /**
+         * @brief Backend currently receiving engine logs, or nullptr in synchronous mode.
+         *
+         * Per binary: game modules hold their own copy which stays null, so their
+         * logs take the Logger's text path and no record ever points at a format
+         * string inside a module that may be unloaded.
+         */
+        static AsyncLogBackend* Get() { return s_Active.load(std::memory_order_acquire); }
+
+        /**
+         * @brief Push a deferred record; formatting happens on the worker thread.
+         *
+         * @param fmt Format string already validated by the caller's std::format_string.
+         *            Must have static storage (string literal).
+         */
+        template<typename... TArgs>
+        void Push(LogLevel level, std::string_view fmt, const TArgs&... args)
+        {
+            if constexpr ((LogArgs::IsDeferrable<std::decay_t<TArgs>> && ...))
+            {
+                const size_t size = (size_t{ 0 } + ... + LogArgs::EncodedSize<std::decay_t<TArgs>>(args));
+                if (size <= LogRecord::PayloadCapacity)
+                {
+                    ThreadRing& ring = GetThreadRing();
+                    LogRecord* record = ring.Ring.BeginPush();
+                    if (!record)
+                    {
+                        ring.Dropped.fetch_add(1, std::memory_order_relaxed);
+                        return;
+                    }
+
+                    record->Header.Format = &LogArgs::FormatDeferred<std::decay_t<TArgs>...>;
+                    record->Header.Fmt = fmt.data();
+                    record->Header.FmtSize = static_cast<uint32_t>(fmt.size());
+                    record->Header.PayloadSize = static_cast<uint16_t>(size);
+                    record->Header.Level = level;
+                    record->Header.Kind = LogRecord::EKind::Deferred;
+
+                    uint8_t* cursor = record->Payload;
+                    ((cursor = LogArgs::Encode<std::decay_t<TArgs>>(cursor, args)), ...);
+
+                    Commit(ring);
+                    return;
+                }
+            }
+
+            PushText(level, std::vformat(fmt, std::make_format_args(args...)));
+        }
+
+        /**
+         * @brief Push an already formatted message.
+         */
+        void PushText(LogLevel level, std::string_view text);
+
+        /**
+         * @brief Block until every record pushed before this call has been written.
+         */
+        void Flush();
+
+        /**
+         * @brief Total number of records dropped because a ring was full.
+         */
+        uint64_t GetDroppedCount() const { return m_TotalDropped.load(std::memory_order_relaxed); }
+
+    private:
+        struct ThreadRing
+        {
+            explicit ThreadRing(size_t capacity) : Ring(capacity) {}
+
+            SPSCRingBuffer<LogRecord> Ring;
+            std::atomic<uint64_t> Dropped{ 0 };
+            std::atomic<bool> Retired{ false };
+        };
+
+        ThreadRing& GetThreadRing();
+        void Commit(ThreadRing& ring);
+
+        void Run();
+        bool DrainAll();
+        void WriteRecord(LogRecord& record);
+
+        WriteFn m_Write;
+        size_t m_RingCapacity;
+        uint64_t m_Generation;
+
+        std::mutex m_RingsMutex;
+        std::vector<std::shared_ptr<ThreadRing>> m_Rings;
+
+        std::mutex m_WakeMutex;
+        std::condition_variable m_WakeCV;
+        std::atomic<bool> m_WorkerSleeping{ false };
+        std::atomic<bool> m_Running{ true };
+
+        std::atomic<uint64_t> m_FlushRequests{ 0 };
+        std::atomic<uint64_t> m_FlushServed{ 0 };
+        std::condition_variable m_FlushCV;
+
+        std::atomic<uint64_t> m_TotalDropped{ 0 };
+
+        std::string m_FormatBuffer;
+        std::thread m_Worker;
+
+        static std::atomic<AsyncLogBackend*> s_Active;
+        static std::atomic<uint64_t> s_NextGeneration;
+    };
+}
@@ -1,88 +1,115 @@
+#pragma once
 #include "Core/Singleton.h"
 
-#include "Renderer/Renderer2D.h"
-#include <queue>
+#include "Renderer/RenderQueue2D.h"
+
+#include <glm/glm.hpp>
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
 
 namespace Boon
 {
-	class DebugDrawCmd
-	{
-	public:
-		virtual void Draw(Renderer2D& renderer) = 0;
-	};
+	class Renderer2D;
+
+	using DebugDrawHandle = uint32_t;
+	inline constexpr DebugDrawHandle InvalidDebugDrawHandle = 0;
 
-	class DrawDebugLineCmd : public DebugDrawCmd
+	/**
+	 * @brief Flat list of debug lines, drawn in one go through the line batch.
+	 *
+	 * Rects are broken into their four edges when recorded, so drawing is a
+	 * single pass over plain data. Clearing keeps the capacity, a list that is
+	 * refilled every frame stops allocating after the first few.
+	 */
+	class DebugDrawList final
 	{
 	public:
-		DrawDebugLineCmd(const glm::vec3& p0, const glm::vec3& p1, const glm::vec4& color)
-		: m_p0(p0), m_p1(p1), m_Color(color) { }
+		void AddLine(const glm::vec3& p0, const glm::vec3& p1, const glm::vec4& color);
 
-		virtual void Draw(Renderer2D& renderer) override
-		{
-			renderer.SubmitLine(m_p0, m_p1, m_Color);
-		}
+		/**
+		 * @brief Outline of an axis aligned rect centered on position.
+		 */
+		void AddRect(const glm::vec3& position, const glm::vec2& size, const glm::vec4& color);
 
-	private:
-		glm::vec3 m_p0, m_p1;
-		glm::vec4 m_Color;
-	};
+		/**
+		 * @brief Outline of a size scaled unit quad placed by transform.
+		 */
+		void AddRect(const glm::mat4& transform, const glm::vec2& size, const glm::vec4& color);
 
-	class DrawDebugRectCmd : public DebugDrawCmd
-	{
-	public:
-			DrawDebugRectCmd(const glm::vec3& p, const glm::vec2& size, const glm::vec4& color)
-			: m_p(p), m_Size(size), m_Color(color) {
-		}
+		void Reserve(size_t lineCount) { m_Lines.reserve(lineCount); }
+		void Clear() { m_Lines.clear(); }
 
-		virtual void Draw(Renderer2D& renderer) override
-		{
-			renderer.SubmitRect(m_p, m_Size, m_Color);
-		}
+		inline bool IsEmpty() const { return m_Lines.empty(); }
+		inline size_t GetLineCount() const { return m_Lines.size(); }
+		inline const std::vector<LineRenderItem2D>& GetLines() const { return m_Lines; }
 
 	private:
-		glm::vec3 m_p;
-		glm::vec2 m_Size;
-		glm::vec4 m_Color;
+		std::vector<LineRenderItem2D> m_Lines;
 	};
 
+	/**
+	 * @brief Global debug drawing for game and engine code.
+	 *
+	 * Immediate primitives live for the frame they were recorded in. Retained
+	 * lists are filled once and drawn every frame until their lifetime runs
+	 * out or they are destroyed, so static overlays are not re-recorded.
+	 */
 	class DebugRenderer final : public Singleton<DebugRenderer>
 	{
 	public:
+		static constexpr float Forever = -1.0f;
+
 		DebugRenderer() = default;
 
-		void FlushQueue(Renderer2D& renderer)
+		void DrawLine(const glm::vec3& p0, const glm::vec3& p1, const glm::vec4& color)
 		{
-			auto& queue = m_pCommands;
-			while (!queue.empty())
-			{
-				queue.front()->Draw(renderer);
-				delete queue.front();
-				queue.pop();
-			}
+			m_FrameList.AddLine(p0, p1, color);
 		}
 
-		void BeginFrame()
+		void DrawRect(const glm::vec3& position, const glm::vec2& size, const glm::vec4& color)
 		{
-			return;
-			while (!m_pCommands.empty())
-			{
-				delete m_pCommands.front();
-				m_pCommands.pop();
-			}
+			m_FrameList.AddRect(position, size, color);
 		}
 
-		void PushCommand(DebugDrawCmd* pCmd)
-		{
-			m_pCommands.push(pCmd);
-		}
+		/**
+		 * @brief Create a retained list drawn until destroyed or lifetime seconds have passed.
+		 */
+		DebugDrawHandle CreateRetained(float lifetime = Forever);
+
+		/**
+		 * @brief Lines of a retained list, nullptr once it expired or was destroyed.
+		 */
+		DebugDrawList* GetRetained(DebugDrawHandle handle);
+
+		void DestroyRetained(DebugDrawHandle handle);
+
+		/**
+		 * @brief Drop last frame's immediate primitives and age the retained lists.
+		 */
+		void BeginFrame(float deltaTime);
+
+		/**
+		 * @brief Submit everything alive to the renderer's line batch. May run for several views per frame.
+		 */
+		void Flush(Renderer2D& renderer) const;
 
 	private:
-		std::queue<DebugDrawCmd*> m_pCommands;
+		struct RetainedList
+		{
+			DebugDrawList Lines;
+			float Lifetime = Forever;
+		};
+
+		DebugDrawList m_FrameList;
+		std::unordered_map<DebugDrawHandle, RetainedList> m_Retained;
+		DebugDrawHandle m_NextHandle = 1;
 	};
 }
 
 #define DEBUG_DRAW_LINE(p0, p1, color) \
-    Boon::DebugRenderer::Get().PushCommand(new Boon::DrawDebugLineCmd((p0), (p1), (color)))
+    Boon::DebugRenderer::Get().DrawLine((p0), (p1), (color))
 
 #define DEBUG_DRAW_RECT(p, size, color) \
-    Boon::DebugRenderer::Get().PushCommand(new Boon::DrawDebugRectCmd((p), (size), (color)))
\ No newline at end of file
+    Boon::DebugRenderer::Get().DrawRect((p), (size), (color))
@@ -0,0 +1,29 @@
+#pragma once
+#include <cstdint>
+#include <string>
+
+namespace Boon
+{
+	enum class LogLevel
+	{
+		Info,
+		Warning,
+		Error
+	};
+
+	class ILogSink
+	{
+	public:
+		virtual ~ILogSink() = default;
+		virtual void Write(LogLevel level, const std::string& message) = 0;
+	};
+
+	struct LogSettings
+	{
+		bool bAsync = false;
+		uint32_t RingCapacity = 1024;             // records per producer thread (async only)
+		std::string File;                         // optional rotating log file, empty disables it
+		uint32_t MaxFileSize = 4u * 1024u * 1024u;
+		uint32_t MaxFiles = 3;
+	};
+}
@@ -1,31 +1,44 @@
 #pragma once
 #include "Core/ServiceLocator.h"
+#include "BoonDebug/LogTypes.h"
+#include "BoonDebug/AsyncLogBackend.h"
 
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 #include <format>
 
 namespace Boon
 {
-	enum class LogLevel
-	{
-		Info,
-		Warning,
-		Error
-	};
-
-	class ILogSink
-	{
-	public:
-		virtual ~ILogSink() = default;
-		virtual void Write(LogLevel level, const std::string& message) = 0;
-	};
-
     class Logger final
     {
     public:
-        static void Init();
+        static void Init(const LogSettings& settings = {});
+
+        ~Logger();
+
+        /**
+         * @brief Route all messages through a background thread.
+         *
+         * Callers only copy their format string and arguments into a per-thread
+         * ring; formatting and sink writes happen on the backend thread.
+         *
+         * @param ringCapacity Records buffered per producer thread before messages are dropped.
+         */
+        void EnableAsync(size_t ringCapacity);
+
+        /**
+         * @brief Drain pending messages and go back to writing on the calling thread.
+         */
+        void DisableAsync();
+
+        bool IsAsync() const { return m_pAsync != nullptr; }
+
+        /**
+         * @brief Block until every message logged so far reached the sinks.
+         */
+        void Flush();
 
         void AddSink(const std::shared_ptr<ILogSink>& sink);
         void RemoveSink(ILogSink* sink);
@@ -54,8 +67,11 @@ namespace Boon
 
     private:
         void Write(LogLevel level, const std::string& msg);
+        void WriteToSinks(LogLevel level, const std::string& msg);
 
+        std::mutex m_SinkMutex;
         std::vector<std::shared_ptr<ILogSink>> m_Sinks;
+        std::unique_ptr<AsyncLogBackend> m_pAsync;
     };
 
     class Log
@@ -68,18 +84,33 @@ namespace Boon
         template<typename... TArgs>
         static void Info(std::format_string<TArgs...> fmt, TArgs&&... args)
         {
+            if (AsyncLogBackend* backend = AsyncLogBackend::Get())
+            {
+                backend->Push(LogLevel::Info, fmt.get(), args...);
+                return;
+            }
             Info(std::format(fmt, std::forward<TArgs>(args)...));
         }
 
         template<typename... TArgs>
         static void Warn(std::format_string<TArgs...> fmt, TArgs&&... args)
         {
+            if (AsyncLogBackend* backend = AsyncLogBackend::Get())
+            {
+                backend->Push(LogLevel::Warning, fmt.get(), args...);
+                return;
+            }
             Warn(std::format(fmt, std::forward<TArgs>(args)...));
         }
 
         template<typename... TArgs>
         static void Error(std::format_string<TArgs...> fmt, TArgs&&... args)
         {
+            if (AsyncLogBackend* backend = AsyncLogBackend::Get())
+            {
+                backend->Push(LogLevel::Error, fmt.get(), args...);
+                return;
+            }
             Error(std::format(fmt, std::forward<TArgs>(args)...));
         }
 
@@ -88,7 +119,7 @@ namespace Boon
     };
 }
 
-#define BOON_INIT_LOGGER() ::Boon::Logger::Init()
+#define BOON_INIT_LOGGER(...) ::Boon::Logger::Init(__VA_ARGS__)
 
 #define BOON_LOG(...) ::Boon::Log::Info(__VA_ARGS__)
 #define BOON_LOG_WARN(...) ::Boon::Log::Warn(__VA_ARGS__)
@@ -0,0 +1,33 @@
+#pragma once
+#include "BoonDebug/LogTypes.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+
+namespace Boon
+{
+	/**
+	 * @brief Log sink writing to a file that rolls over once it grows past a size limit.
+	 *
+	 * On rollover "log.txt" becomes "log.txt.1", "log.txt.1" becomes "log.txt.2"
+	 * and so on; the oldest file beyond maxFiles is deleted.
+	 */
+	class RotatingFileLogSink final : public ILogSink
+	{
+	public:
+		RotatingFileLogSink(const std::filesystem::path& path, uint32_t maxFileSize, uint32_t maxFiles);
+
+		virtual void Write(LogLevel level, const std::string& message) override;
+
+	private:
+		void Open();
+		void Rotate();
+
+		std::filesystem::path m_Path;
+		std::ofstream m_File;
+		uint64_t m_Size = 0;
+		uint32_t m_MaxFileSize;
+		uint32_t m_MaxFiles;
+	};
+}
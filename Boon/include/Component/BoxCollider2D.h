@@ -2,6 +2,8 @@
 #include "Core/Boon.h"
 #include <glm/glm.hpp>
 
+#include <cstdint>
+
 namespace Boon
 {
 	BCLASS(Name="Box Collider 2D")
@@ -22,6 +24,13 @@ namespace Boon
 		BPROPERTY()
 		bool IsTrigger = false;
 
+		// Bit of this collider, and the bits it collides with and is seen by queries from
+		BPROPERTY(Hex)
+		uint64_t CategoryBits = 1;
+
+		BPROPERTY(Hex)
+		uint64_t MaskBits = UINT64_MAX;
+
 #ifdef BOON_WITH_EDITOR
 		bool DrawDebug{ true };
 #endif // BOON_WITH_EDITOR
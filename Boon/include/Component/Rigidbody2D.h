@@ -38,6 +38,10 @@ namespace Boon
         BPROPERTY()
         float Mass = 1.0f;
 
+        // Render between the last two physics steps instead of snapping to the latest one
+        BPROPERTY()
+        bool Interpolate = true;
+
         // Cached state written by host physics
         glm::vec2 Velocity{ 0.0f, 0.0f };
         float AngularVelocity = 0.0f;
@@ -45,6 +49,10 @@ namespace Boon
         glm::vec2 Position{ 0.0f, 0.0f };
         float Rotation = 0.0f;
 
+        // Pose before the last step, the start of the render interpolation
+        glm::vec2 PreviousPosition{ 0.0f, 0.0f };
+        float PreviousRotation = 0.0f;
+
         bool Awake = true;
         bool OnGround = false;
 
@@ -65,6 +73,12 @@ namespace Boon
         glm::vec2 PendingSetPosition{ 0.0f, 0.0f };
         float PendingSetRotation = 0.0f;
 
+        // Set by the request functions below, cleared once the physics world applied them
+        bool HasPendingCommands = false;
+
+        // Runtime body owned by PhysicsWorld2D (b2StoreBodyId), 0 until spawned
+        uint64_t BodyHandle = 0;
+
         bool DirtyBodyDef = true;
         bool DirtyVelocity = false;
         bool DirtyTransform = false;
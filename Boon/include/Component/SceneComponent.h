@@ -69,6 +69,7 @@ namespace Boon
 		void RemoveChild(GameObject child);
 		void SetScene(Scene* pScene);
 
+		friend class Scene;
 		friend class TransformComponent;
 		friend class SceneSerializer;
 
@@ -16,11 +16,32 @@ namespace Boon
 		inline SpriteAnimClip& GetClip() const { return Atlas->GetClip(Clip); }
 
 		void Awake(GameObject);
-		void Update(GameObject);
 
 		void SetClip(int clip, bool restart = true);
 		void SetClip(std::string_view clip, bool restart = true);
 
+		/**
+		 * @brief True when the renderer's atlas differs from the cached one.
+		 */
+		inline bool NeedsAtlas(const SpriteRendererComponent& renderer) const
+		{
+			return m_AtlasHandle != renderer.SpriteAtlasHandle.Handle() ||
+				(!Atlas && renderer.SpriteAtlasHandle.IsValid());
+		}
+
+		/**
+		 * @brief Cache the atlas resolved from the renderer's handle.
+		 */
+		void BindAtlas(AssetHandle handle, std::shared_ptr<SpriteAtlas> atlas);
+
+		/**
+		 * @brief Advance playback and write the current frame to the renderer.
+		 *
+		 * Called by the SpriteAnimatorSystem once per frame. Time past a frame
+		 * boundary carries over, so playback does not drift with frame rate.
+		 */
+		void Advance(float deltaTime, SpriteRendererComponent& renderer);
+
 		BPROPERTY(RangeMin="0", RangeMax="10", Slider)
 		int Clip;
 		std::shared_ptr<SpriteAtlas> Atlas;
@@ -32,5 +53,6 @@ namespace Boon
 		int m_Current = 0;
 		float m_Timer = 0.f;
 		bool m_Dirty = true;
+		AssetHandle m_AtlasHandle = UUID::Null;
 	};
 }
\ No newline at end of file
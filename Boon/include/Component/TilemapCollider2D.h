@@ -0,0 +1,35 @@
+#pragma once
+#include "Core/Boon.h"
+
+#include <cstdint>
+
+namespace Boon
+{
+	/**
+	 * @brief Static collision built from the tiles of the TilemapRendererComponent on the same object.
+	 *
+	 * Every non-empty tile is solid. The solid tiles of each chunk are merged
+	 * into rectangles on one static body per chunk, and only chunks whose tiles
+	 * changed are rebuilt. Colliders follow the object's transform when a chunk
+	 * is built; moving the object afterwards does not move them.
+	 */
+	BCLASS(Name="Tilemap Collider 2D")
+	struct TilemapCollider2D final
+	{
+		BPROPERTY()
+		float Friction = 0.f;
+
+		BPROPERTY()
+		float Restitution = 0.f;
+
+		BPROPERTY(Hex)
+		uint64_t CategoryBits = 1;
+
+		BPROPERTY(Hex)
+		uint64_t MaskBits = UINT64_MAX;
+
+		// Written by the physics world
+		uint32_t BodyCount = 0;
+		uint32_t ShapeCount = 0;
+	};
+}
@@ -10,14 +10,32 @@ namespace Boon
 	BCLASS(Name="Tilemap renderer")
 	struct TilemapRendererComponent
 	{
+		enum class RenderMode
+		{
+			Mesh = 0,		// A quad per tile, re-meshed per chunk on change
+			TileLookup = 1	// A quad per chunk, tiles resolved in the fragment shader
+		};
+
 		BPROPERTY()
 		AssetRef<TilemapAsset> tilemap;
 
+		BPROPERTY()
+		int Mode = (int)RenderMode::Mesh;
+
 		BPROPERTY()
 		AssetRef<MaterialAsset> MaterialOverride;
 
+		// Dirty chunks re-meshed per frame in mesh mode, 0 for all of them
+		BPROPERTY()
+		int RebuildBudget = 0;
+
+		// Chunks kept resident around the camera when the tilemap streams from a chunk file
+		BPROPERTY()
+		int StreamRadius = 4;
+
 		std::shared_ptr<Material> MaterialInstance = nullptr;
 		AssetHandle MaterialInstanceSource = 0;
 		uint32_t MaterialInstanceVersion = 0;
+		int MaterialInstanceMode = -1;
 	};
 }
\ No newline at end of file
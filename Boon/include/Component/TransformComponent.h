@@ -119,6 +119,8 @@ namespace Boon
 		TransformFlag m_DirtyFlags{ TransformFlag::All };
 
 		friend class GameObject;
+		friend class Prefab;
+		friend class Scene;
 		friend class SceneComponent;
 		friend class SceneSerializer;
 		SceneComponent* m_Owner;
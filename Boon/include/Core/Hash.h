@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace Boon
+{
+	/**
+	 * @brief 64-bit FNV-1a helpers shared by every content hash in the engine.
+	 *
+	 * Start from FnvOffset and feed the running hash back in to chain values.
+	 * The results end up in files on disk (shader cache keys, thumbnail names),
+	 * so the algorithm must not change.
+	 */
+	constexpr uint64_t FnvOffset = 14695981039346656037ull;
+	constexpr uint64_t FnvPrime = 1099511628211ull;
+
+	inline uint64_t HashBytes(uint64_t hash, const void* data, size_t size)
+	{
+		const uint8_t* bytes = static_cast<const uint8_t*>(data);
+		for (size_t i = 0; i < size; ++i)
+		{
+			hash ^= bytes[i];
+			hash *= FnvPrime;
+		}
+		return hash;
+	}
+
+	template<typename T>
+	inline uint64_t HashValue(uint64_t hash, const T& value)
+	{
+		return HashBytes(hash, &value, sizeof(T));
+	}
+
+	/**
+	 * @brief Hash the length first so consecutive strings cannot run into each other.
+	 */
+	inline uint64_t HashString(uint64_t hash, std::string_view value)
+	{
+		const uint64_t size = value.size();
+		hash = HashBytes(hash, &size, sizeof(size));
+		return HashBytes(hash, value.data(), value.size());
+	}
+}
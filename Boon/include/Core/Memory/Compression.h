@@ -0,0 +1,44 @@
+#pragma once
+#include "Core/Memory/Buffer.h"
+
+#include <cstdint>
+#include <cstddef>
+
+namespace Boon
+{
+    /**
+     * @brief Small LZ77 style block codec for bulk network/data payloads.
+     *
+     * Byte oriented (LZ4-like token stream) and dependency free. Fast enough
+     * to run on every snapshot chunk; favours speed over ratio.
+     */
+    class Compression final
+    {
+    public:
+        /**
+         * @brief Worst case compressed size for an input of the given size.
+         */
+        static size_t CompressBound(size_t size);
+
+        /**
+         * @brief Compress a block and append the result to the output buffer.
+         *
+         * @param src Source bytes.
+         * @param size Number of source bytes.
+         * @param out Buffer the compressed stream is appended to.
+         * @return Number of bytes appended.
+         */
+        static size_t Compress(const uint8_t* src, size_t size, Buffer& out);
+
+        /**
+         * @brief Decompress a block produced by Compress.
+         *
+         * @param src Compressed bytes.
+         * @param size Number of compressed bytes.
+         * @param dst Destination memory, must hold rawSize bytes.
+         * @param rawSize Exact decompressed size.
+         * @return true when the stream was valid and produced exactly rawSize bytes.
+         */
+        static bool Decompress(const uint8_t* src, size_t size, uint8_t* dst, size_t rawSize);
+    };
+}
@@ -0,0 +1,245 @@
+#pragma once
+#include "Core/ISubsystem.h"
+#include "Core/Threading/MPMCQueue.h"
+#include "Core/Threading/WorkStealingDeque.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Boon
+{
+    class JobSystem;
+    struct Job;
+
+    /**
+     * @brief Tracks completion of a group of jobs.
+     *
+     * Every job scheduled against a counter increments it and decrements it
+     * when done. Jobs can be made to depend on a counter; they are scheduled
+     * once it reaches zero.
+     */
+    class JobCounter final
+    {
+    public:
+        JobCounter() = default;
+        JobCounter(const JobCounter&) = delete;
+        JobCounter& operator=(const JobCounter&) = delete;
+
+        bool IsDone() const { return m_Pending.load(std::memory_order_acquire) == 0; }
+        uint32_t GetPending() const { return m_Pending.load(std::memory_order_acquire); }
+
+    private:
+        friend class JobSystem;
+
+        std::atomic<uint32_t> m_Pending{ 0 };
+
+        mutable std::atomic<bool> m_Lock{ false };
+        std::vector<Job*> m_Continuations;
+    };
+
+    /**
+     * @brief Unit of work with inline storage for its callable.
+     *
+     * Jobs are taken from a per-thread ring, so scheduling never hits the heap
+     * unless the callable is larger than InlineSize or the ring has no free
+     * slot left. A ring slot stays taken until its job has run, including
+     * while it waits as a continuation.
+     */
+    struct alignas(CacheLineSize) Job
+    {
+        static constexpr size_t InlineSize = 2 * CacheLineSize - 4 * sizeof(void*);
+
+        void (*Invoke)(Job&) = nullptr;
+        void (*Destroy)(Job&) = nullptr;
+        JobCounter* Counter = nullptr;
+        std::atomic<bool> InUse{ false };
+        bool FromHeap = false;
+        alignas(std::max_align_t) unsigned char Storage[InlineSize];
+    };
+
+    /**
+     * @brief Work-stealing job scheduler.
+     *
+     * Each worker owns a Chase-Lev deque: it pushes and pops its own jobs at the
+     * bottom while idle workers steal from the top. The thread that initialises
+     * the system (the main thread) gets a deque too, so it can schedule without
+     * contention and execute jobs while it waits on a counter. Jobs scheduled
+     * from any other thread go through a shared injection queue.
+     *
+     * With zero workers (or on platforms without threads) every job runs inline.
+     */
+    class JobSystem final : public ISubsystem
+    {
+    public:
+        /** Capacity of each thread's deque; the per-thread job ring holds twice as many. */
+        static constexpr size_t JobsPerThread = 4096;
+
+        /**
+         * @param workerCount Worker threads to spawn, 0 picks hardware_concurrency - 1.
+         */
+        explicit JobSystem(uint32_t workerCount = 0);
+        ~JobSystem() override;
+
+        virtual void OnInit(EngineContext& ctx) override;
+        virtual void OnShutdown(EngineContext& ctx) override;
+
+        /**
+         * @brief Job system of this binary, or nullptr when it is not running.
+         */
+        static JobSystem* Get() { return s_Instance; }
+
+        /**
+         * @brief Schedule a callable for execution on any thread.
+         *
+         * @param counter Optional counter incremented now and decremented when the job finishes.
+         */
+        template<typename Fn>
+        void Schedule(Fn&& fn, JobCounter* counter = nullptr)
+        {
+            Job* job = CreateJob(std::forward<Fn>(fn), counter);
+            if (counter)
+                counter->m_Pending.fetch_add(1, std::memory_order_relaxed);
+            Submit(job);
+        }
+
+        /**
+         * @brief Schedule a callable once every job tracked by dependency has finished.
+         */
+        template<typename Fn>
+        void ScheduleAfter(JobCounter& dependency, Fn&& fn, JobCounter* counter = nullptr)
+        {
+            Job* job = CreateJob(std::forward<Fn>(fn), counter);
+            if (counter)
+                counter->m_Pending.fetch_add(1, std::memory_order_relaxed);
+            AddContinuation(dependency, job);
+        }
+
+        /**
+         * @brief Block until the counter reaches zero, executing other jobs meanwhile.
+         */
+        void Wait(const JobCounter& counter);
+
+        /**
+         * @brief Run fn(begin, end) over [0, count) split in batches of batchSize, and wait.
+         *
+         * The calling thread executes batches as well.
+         */
+        template<typename Fn>
+        void ParallelFor(size_t count, size_t batchSize, Fn&& fn)
+        {
+            if (count == 0)
+                return;
+            if (batchSize == 0)
+                batchSize = 1;
+
+            // Keep the job count well inside one thread's deque
+            const size_t maxBatches = JobsPerThread / 2;
+            if (count / batchSize > maxBatches)
+                batchSize = (count + maxBatches - 1) / maxBatches;
+
+            if (count <= batchSize || m_Workers.empty())
+            {
+                fn(size_t{ 0 }, count);
+                return;
+            }
+
+            JobCounter counter;
+            for (size_t begin = batchSize; begin < count; begin += batchSize)
+            {
+                const size_t end = begin + batchSize < count ? begin + batchSize : count;
+                Schedule([&fn, begin, end]() { fn(begin, end); }, &counter);
+            }
+
+            fn(size_t{ 0 }, batchSize);
+            Wait(counter);
+        }
+
+        /**
+         * @brief Run fn(entity) for every entity of an entt view, in parallel batches.
+         *
+         * Iterates the view's leading storage by index; components of other
+         * entities must not be structurally modified from fn.
+         */
+        template<typename View, typename Fn>
+        void ParallelForEach(const View& view, size_t batchSize, Fn&& fn)
+        {
+            const auto* storage = view.handle();
+            if (!storage)
+                return;
+
+            ParallelFor(storage->size(), batchSize, [&](size_t begin, size_t end)
+                {
+                    auto it = storage->begin() + static_cast<std::ptrdiff_t>(begin);
+                    for (size_t i = begin; i < end; ++i, ++it)
+                    {
+                        const auto entity = *it;
+                        if (view.contains(entity))
+                            fn(entity);
+                    }
+                });
+        }
+
+        uint32_t GetWorkerCount() const { return static_cast<uint32_t>(m_Workers.size()); }
+
+    private:
+        struct ThreadQueue
+        {
+            WorkStealingDeque<Job*> Deque{ JobsPerThread };
+        };
+
+        template<typename Fn>
+        Job* CreateJob(Fn&& fn, JobCounter* counter)
+        {
+            using F = std::decay_t<Fn>;
+
+            Job* job = AllocateJob();
+            job->Counter = counter;
+
+            if constexpr (sizeof(F) <= Job::InlineSize && alignof(F) <= alignof(std::max_align_t))
+            {
+                new (job->Storage) F(std::forward<Fn>(fn));
+                job->Invoke = [](Job& j) { (*std::launder(reinterpret_cast<F*>(j.Storage)))(); };
+                job->Destroy = [](Job& j) { std::launder(reinterpret_cast<F*>(j.Storage))->~F(); };
+            }
+            else
+            {
+                F* heapFn = new F(std::forward<Fn>(fn));
+                std::memcpy(job->Storage, &heapFn, sizeof(heapFn));
+                job->Invoke = [](Job& j) { F* f; std::memcpy(&f, j.Storage, sizeof(f)); (*f)(); };
+                job->Destroy = [](Job& j) { F* f; std::memcpy(&f, j.Storage, sizeof(f)); delete f; };
+            }
+            return job;
+        }
+
+        void Stop();
+
+        Job* AllocateJob();
+        void ReleaseJob(Job* job);
+        void Submit(Job* job);
+        void AddContinuation(JobCounter& dependency, Job* job);
+
+        void Execute(Job* job);
+        Job* FindJob(uint32_t selfIndex);
+        void WorkerLoop(uint32_t index);
+        void WakeWorkers(uint32_t count);
+
+        uint32_t m_RequestedWorkers;
+        std::vector<std::unique_ptr<ThreadQueue>> m_Queues;    // [0] main thread, [1..] workers
+        std::vector<std::thread> m_Workers;
+        MPMCQueue<Job*> m_Injected{ JobsPerThread };
+
+        std::atomic<uint32_t> m_WakeEpoch{ 0 };
+        std::atomic<uint32_t> m_Sleeping{ 0 };
+        std::atomic<bool> m_Running{ false };
+
+        static JobSystem* s_Instance;
+    };
+}
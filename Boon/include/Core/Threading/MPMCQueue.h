@@ -0,0 +1,149 @@
+#pragma once
+#include "Core/Threading/SPSCRingBuffer.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace Boon
+{
+    /**
+     * @brief Bounded multi-producer / multi-consumer queue.
+     *
+     * Each cell carries a sequence number that tells producers and consumers
+     * whether it is free or filled for their lap around the ring, so both
+     * sides only ever CAS their own index. Elements are constructed in place
+     * on push and consumed in place on pop; nothing is allocated after
+     * construction.
+     */
+    template<typename T>
+    class MPMCQueue final
+    {
+    public:
+        /**
+         * @param capacity Requested element count, rounded up to a power of two.
+         */
+        explicit MPMCQueue(size_t capacity)
+        {
+            size_t cap = 2;
+            while (cap < capacity)
+                cap <<= 1;
+
+            m_Mask = cap - 1;
+            m_Cells = std::make_unique<Cell[]>(cap);
+            for (size_t i = 0; i < cap; ++i)
+                m_Cells[i].Sequence.store(i, std::memory_order_relaxed);
+        }
+
+        ~MPMCQueue()
+        {
+            while (TryPop([](T&) {}))
+            {
+            }
+        }
+
+        MPMCQueue(const MPMCQueue&) = delete;
+        MPMCQueue& operator=(const MPMCQueue&) = delete;
+
+        /**
+         * @brief Construct an element at the back of the queue.
+         * @return false when the queue is full.
+         */
+        template<typename... TArgs>
+        bool TryPush(TArgs&&... args)
+        {
+            size_t pos = m_EnqueuePos.load(std::memory_order_relaxed);
+            Cell* cell;
+
+            while (true)
+            {
+                cell = &m_Cells[pos & m_Mask];
+                const size_t seq = cell->Sequence.load(std::memory_order_acquire);
+                const intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+
+                if (diff == 0)
+                {
+                    if (m_EnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                        break;
+                }
+                else if (diff < 0)
+                {
+                    return false;
+                }
+                else
+                {
+                    pos = m_EnqueuePos.load(std::memory_order_relaxed);
+                }
+            }
+
+            new (cell->Storage) T(std::forward<TArgs>(args)...);
+            cell->Sequence.store(pos + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * @brief Hand the front element to consume and destroy it afterwards.
+         * @return false when the queue is empty.
+         */
+        template<typename Fn>
+        bool TryPop(Fn&& consume)
+        {
+            size_t pos = m_DequeuePos.load(std::memory_order_relaxed);
+            Cell* cell;
+
+            while (true)
+            {
+                cell = &m_Cells[pos & m_Mask];
+                const size_t seq = cell->Sequence.load(std::memory_order_acquire);
+                const intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+
+                if (diff == 0)
+                {
+                    if (m_DequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                        break;
+                }
+                else if (diff < 0)
+                {
+                    return false;
+                }
+                else
+                {
+                    pos = m_DequeuePos.load(std::memory_order_relaxed);
+                }
+            }
+
+            T* value = std::launder(reinterpret_cast<T*>(cell->Storage));
+            consume(*value);
+            value->~T();
+
+            cell->Sequence.store(pos + m_Mask + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * @brief Approximate emptiness check, exact only while no one else pushes or pops.
+         */
+        bool Empty() const
+        {
+            return m_EnqueuePos.load(std::memory_order_acquire) == m_DequeuePos.load(std::memory_order_acquire);
+        }
+
+        size_t Capacity() const { return m_Mask + 1; }
+
+    private:
+        struct alignas(CacheLineSize) Cell
+        {
+            std::atomic<size_t> Sequence{ 0 };
+            alignas(T) unsigned char Storage[sizeof(T)];
+        };
+
+        std::unique_ptr<Cell[]> m_Cells;
+        size_t m_Mask = 0;
+
+        alignas(CacheLineSize) std::atomic<size_t> m_EnqueuePos{ 0 };
+        alignas(CacheLineSize) std::atomic<size_t> m_DequeuePos{ 0 };
+    };
+}
@@ -0,0 +1,110 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+namespace Boon
+{
+    inline constexpr size_t CacheLineSize = 64;
+
+    /**
+     * @brief Bounded single-producer / single-consumer ring of trivially copyable slots.
+     *
+     * The producer writes straight into the next free slot (BeginPush/EndPush)
+     * and the consumer reads in place (Front/Pop), so no element is ever copied
+     * twice. Head and tail live on separate cache lines and each side keeps a
+     * cached copy of the other's index to avoid needless cross-core traffic.
+     */
+    template<typename T>
+    class SPSCRingBuffer final
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "SPSCRingBuffer requires trivially copyable slots");
+
+    public:
+        /**
+         * @param capacity Requested slot count, rounded up to a power of two.
+         */
+        explicit SPSCRingBuffer(size_t capacity)
+        {
+            size_t cap = 2;
+            while (cap < capacity)
+                cap <<= 1;
+
+            m_Mask = cap - 1;
+            m_Slots = std::make_unique<T[]>(cap);
+        }
+
+        SPSCRingBuffer(const SPSCRingBuffer&) = delete;
+        SPSCRingBuffer& operator=(const SPSCRingBuffer&) = delete;
+
+        // ---------------- Producer ----------------
+
+        /**
+         * @brief Reserve the next slot for writing.
+         * @return Pointer to the slot, or nullptr when the ring is full.
+         */
+        T* BeginPush()
+        {
+            const size_t tail = m_Tail.load(std::memory_order_relaxed);
+            if (tail - m_CachedHead > m_Mask)
+            {
+                m_CachedHead = m_Head.load(std::memory_order_acquire);
+                if (tail - m_CachedHead > m_Mask)
+                    return nullptr;
+            }
+            return &m_Slots[tail & m_Mask];
+        }
+
+        /**
+         * @brief Publish the slot returned by BeginPush.
+         */
+        void EndPush()
+        {
+            m_Tail.store(m_Tail.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+        }
+
+        // ---------------- Consumer ----------------
+
+        /**
+         * @brief Oldest published slot, or nullptr when empty.
+         */
+        T* Front()
+        {
+            const size_t head = m_Head.load(std::memory_order_relaxed);
+            if (head == m_CachedTail)
+            {
+                m_CachedTail = m_Tail.load(std::memory_order_acquire);
+                if (head == m_CachedTail)
+                    return nullptr;
+            }
+            return &m_Slots[head & m_Mask];
+        }
+
+        /**
+         * @brief Release the slot returned by Front back to the producer.
+         */
+        void Pop()
+        {
+            m_Head.store(m_Head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+        }
+
+        bool Empty() const
+        {
+            return m_Head.load(std::memory_order_acquire) == m_Tail.load(std::memory_order_acquire);
+        }
+
+        size_t Capacity() const { return m_Mask + 1; }
+
+    private:
+        std::unique_ptr<T[]> m_Slots;
+        size_t m_Mask = 0;
+
+        alignas(CacheLineSize) std::atomic<size_t> m_Head{ 0 };
+        size_t m_CachedTail = 0;     // consumer side
+
+        alignas(CacheLineSize) std::atomic<size_t> m_Tail{ 0 };
+        size_t m_CachedHead = 0;     // producer side
+    };
+}
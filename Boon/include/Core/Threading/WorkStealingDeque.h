@@ -0,0 +1,109 @@
+#pragma once
+#include "Core/Threading/SPSCRingBuffer.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+namespace Boon
+{
+    /**
+     * @brief Fixed-capacity Chase-Lev work-stealing deque.
+     *
+     * The owning thread pushes and pops at the bottom (LIFO, cache friendly),
+     * any other thread steals from the top (FIFO). Only the race for the last
+     * element and concurrent steals use a CAS.
+     */
+    template<typename T>
+    class WorkStealingDeque final
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "WorkStealingDeque stores plain values (pointers, handles)");
+
+    public:
+        /**
+         * @param capacity Requested slot count, rounded up to a power of two.
+         */
+        explicit WorkStealingDeque(size_t capacity)
+        {
+            size_t cap = 2;
+            while (cap < capacity)
+                cap <<= 1;
+
+            m_Mask = cap - 1;
+            m_Slots = std::make_unique<std::atomic<T>[]>(cap);
+        }
+
+        WorkStealingDeque(const WorkStealingDeque&) = delete;
+        WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+        // ---------------- Owner ----------------
+
+        /**
+         * @return false when the deque is full.
+         */
+        bool Push(T value)
+        {
+            const int64_t bottom = m_Bottom.load(std::memory_order_relaxed);
+            const int64_t top = m_Top.load(std::memory_order_acquire);
+            if (bottom - top > static_cast<int64_t>(m_Mask))
+                return false;
+
+            m_Slots[bottom & m_Mask].store(value, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+            return true;
+        }
+
+        bool Pop(T& out)
+        {
+            const int64_t bottom = m_Bottom.load(std::memory_order_relaxed) - 1;
+            m_Bottom.store(bottom, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            int64_t top = m_Top.load(std::memory_order_relaxed);
+
+            if (top > bottom)
+            {
+                m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+                return false;
+            }
+
+            out = m_Slots[bottom & m_Mask].load(std::memory_order_relaxed);
+            if (top != bottom)
+                return true;
+
+            // Last element: race the thieves for it
+            const bool won = m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+            m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+            return won;
+        }
+
+        // ---------------- Thieves ----------------
+
+        bool Steal(T& out)
+        {
+            int64_t top = m_Top.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            const int64_t bottom = m_Bottom.load(std::memory_order_acquire);
+
+            if (top >= bottom)
+                return false;
+
+            out = m_Slots[top & m_Mask].load(std::memory_order_relaxed);
+            return m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+        }
+
+        bool Empty() const
+        {
+            return m_Bottom.load(std::memory_order_relaxed) <= m_Top.load(std::memory_order_relaxed);
+        }
+
+    private:
+        std::unique_ptr<std::atomic<T>[]> m_Slots;
+        int64_t m_Mask = 0;
+
+        alignas(CacheLineSize) std::atomic<int64_t> m_Top{ 0 };
+        alignas(CacheLineSize) std::atomic<int64_t> m_Bottom{ 0 };
+    };
+}
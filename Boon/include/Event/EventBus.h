@@ -1,5 +1,5 @@
 #pragma once
-#include "Core/Threading/LockFreeQueue.h"
+#include "Core/Threading/MPMCQueue.h"
 #include "Event/Event.h"
 
 #include <vector>
@@ -9,46 +9,45 @@
 #include <thread>
 #include <memory>
 #include <functional>
-#include <condition_variable>
+#include <shared_mutex>
+#include <mutex>
 #include <algorithm>
+#include <cstddef>
+#include <type_traits>
 
-namespace Boon 
+namespace Boon
 {
-    struct ListenerBase 
+    struct ListenerBase
     {
         EventListenerID id;
         virtual ~ListenerBase() = default;
     };
 
     template<typename EventType>
-    struct Listener : ListenerBase 
+    struct Listener : ListenerBase
     {
         std::function<void(const EventType&)> callback;
     };
 
-    class EventBus 
+    class EventBus
     {
     public:
+        /** Number of posted events that can be in flight before Post applies back-pressure. */
+        static constexpr size_t QueueCapacity = 4096;
+
         /**
          * @brief Construct an EventBus and start the background worker thread.
          *
          * A worker thread is created to process asynchronously posted events.
          */
-        EventBus() : m_Stop(false) 
-        {
-            m_WorkerThread = std::thread([this]() { ProcessQueueThread(); });
-        }
+        EventBus();
 
         /**
          * @brief Destroy the EventBus and stop the worker thread.
+         *
+         * Events still queued are delivered before the worker exits.
          */
-        ~EventBus() 
-        {
-            m_Stop = true;
-            m_Condition.notify_all();
-            if (m_WorkerThread.joinable())
-                m_WorkerThread.join();
-        }
+        ~EventBus();
 
         // Subscribe
         /**
@@ -64,13 +63,20 @@ namespace Boon
          * @return EventListenerID Identifier for the registered listener.
          */
         template<typename EventType, typename Func>
-        EventListenerID Subscribe(Func&& callback) 
+        EventListenerID Subscribe(Func&& callback)
         {
             auto listener = std::make_shared<Listener<EventType>>();
-            listener->id = m_NextListenerID++;
+            const EventListenerID id = m_NextListenerID++;
+            listener->id = id;
             listener->callback = std::forward<Func>(callback);
-            GetListeners<EventType>().emplace_back(listener);
-            return listener->id;
+
+            std::unique_lock lock(m_ListenerMutex);
+            auto& list = m_ListenerMap[std::type_index(typeid(EventType))];
+            auto next = list ? std::make_shared<ListenerList>(*list) : std::make_shared<ListenerList>();
+            next->emplace_back(std::move(listener));
+            list = std::move(next);
+
+            return id;
         }
 
         // Unsubscribe
@@ -80,14 +86,20 @@ namespace Boon
          * If the id is not found this is a no-op.
          */
         template<typename EventType>
-        void Unsubscribe(EventListenerID id) 
+        void Unsubscribe(EventListenerID id)
         {
-            auto& listeners = GetListeners<EventType>();
-            listeners.erase(
-                std::remove_if(listeners.begin(), listeners.end(),
+            std::unique_lock lock(m_ListenerMutex);
+            auto it = m_ListenerMap.find(std::type_index(typeid(EventType)));
+            if (it == m_ListenerMap.end() || !it->second)
+                return;
+
+            auto next = std::make_shared<ListenerList>(*it->second);
+            next->erase(
+                std::remove_if(next->begin(), next->end(),
                     [id](auto& l) { return l->id == id; }),
-                listeners.end()
+                next->end()
             );
+            it->second = std::move(next);
         }
 
         // Dispatch synchronously
@@ -95,68 +107,114 @@ namespace Boon
          * @brief Dispatch an event synchronously to all listeners of EventType.
          *
          * The call will invoke each registered listener callback on the current thread.
+         * Listeners see the subscription list as it was when dispatch started, so
+         * callbacks may subscribe or unsubscribe freely.
          */
         template<typename EventType>
-        void Dispatch(const EventType& event) 
+        void Dispatch(const EventType& event)
         {
-            auto& listeners = GetListeners<EventType>();
-            for (auto& l : listeners)
-                l->callback(event);
+            std::shared_ptr<const ListenerList> listeners;
+            {
+                std::shared_lock lock(m_ListenerMutex);
+                auto it = m_ListenerMap.find(std::type_index(typeid(EventType)));
+                if (it == m_ListenerMap.end())
+                    return;
+                listeners = it->second;
+            }
+
+            if (!listeners)
+                return;
+
+            for (auto& l : *listeners)
+                static_cast<const Listener<EventType>&>(*l).callback(event);
         }
 
         // Post asynchronously
         /**
          * @brief Post an event for asynchronous delivery.
          *
-         * The event will be enqueued and processed by the internal worker thread.
+         * The event is copied into the bounded queue and processed by the internal
+         * worker thread. When the queue is full the caller yields until space frees
+         * up; posts made from a listener on the worker itself are dispatched inline
+         * instead so they can never wait on themselves.
          */
         template<typename EventType>
-        void Post(const EventType& event) 
+        void Post(const EventType& event)
         {
-            m_EventQueue.Enqueue([this, event]() { Dispatch(event); });
-            m_Condition.notify_one();
+            while (!m_EventQueue.TryPush(event))
+            {
+                if (std::this_thread::get_id() == m_WorkerThread.get_id())
+                {
+                    Dispatch(event);
+                    return;
+                }
+                std::this_thread::yield();
+            }
+
+            WakeWorker();
         }
 
     private:
-        std::unordered_map<std::type_index, std::vector<std::shared_ptr<ListenerBase>>> m_ListenerMap;
+        using ListenerList = std::vector<std::shared_ptr<ListenerBase>>;
 
-        template<typename EventType>
-        std::vector<std::shared_ptr<Listener<EventType>>>& GetListeners() 
+        /**
+         * @brief Type-erased posted event with small-buffer storage.
+         *
+         * Events that fit InlineSize live inside the queue cell; larger ones
+         * fall back to a single heap allocation.
+         */
+        class PostedEvent
         {
-            auto type = std::type_index(typeid(EventType));
-            auto it = m_ListenerMap.find(type);
-            if (it == m_ListenerMap.end()) 
+        public:
+            static constexpr size_t InlineSize = 48;
+
+            template<typename EventType>
+            explicit PostedEvent(const EventType& event)
             {
-                m_ListenerMap[type] = {};
+                if constexpr (FitsInline<EventType>)
+                    m_pEvent = new (m_Storage) EventType(event);
+                else
+                    m_pEvent = new EventType(event);
+
+                m_Dispatch = [](EventBus& bus, const void* e) { bus.Dispatch(*static_cast<const EventType*>(e)); };
+                m_Destroy = [](void* e)
+                    {
+                        if constexpr (FitsInline<EventType>)
+                            static_cast<EventType*>(e)->~EventType();
+                        else
+                            delete static_cast<EventType*>(e);
+                    };
             }
-            
-            return *reinterpret_cast<std::vector<std::shared_ptr<Listener<EventType>>>*>(&m_ListenerMap[type]);
-        }
 
-        LockFreeQueue<std::function<void()>> m_EventQueue;
-        std::mutex m_QueueMutex;
-        std::condition_variable m_Condition;
+            ~PostedEvent() { m_Destroy(m_pEvent); }
+
+            PostedEvent(const PostedEvent&) = delete;
+            PostedEvent& operator=(const PostedEvent&) = delete;
+
+            void Dispatch(EventBus& bus) const { m_Dispatch(bus, m_pEvent); }
+
+        private:
+            template<typename EventType>
+            static constexpr bool FitsInline = sizeof(EventType) <= InlineSize && alignof(EventType) <= alignof(std::max_align_t);
+
+            void (*m_Dispatch)(EventBus&, const void*) = nullptr;
+            void (*m_Destroy)(void*) = nullptr;
+            void* m_pEvent = nullptr;
+            alignas(std::max_align_t) unsigned char m_Storage[InlineSize];
+        };
+
+        void WakeWorker();
+        void ProcessQueueThread();
+
+        std::shared_mutex m_ListenerMutex;
+        std::unordered_map<std::type_index, std::shared_ptr<const ListenerList>> m_ListenerMap;
+
+        MPMCQueue<PostedEvent> m_EventQueue{ QueueCapacity };
+        std::atomic<uint32_t> m_WakeEpoch{ 0 };
+        std::atomic<bool> m_WorkerWaiting{ false };
+        std::atomic<bool> m_Stop{ false };
         std::thread m_WorkerThread;
-        std::atomic<bool> m_Stop;
         std::atomic<EventListenerID> m_NextListenerID{ 1 };
-
-        void ProcessQueueThread() 
-        {
-            //return;
-            while (!m_Stop) 
-            {
-                auto job = m_EventQueue.Dequeue();
-                if (job) 
-                {
-                    (*job)();
-                }
-                else 
-                {
-                    std::unique_lock<std::mutex> lock(m_QueueMutex);
-                    m_Condition.wait_for(lock, std::chrono::milliseconds(1));
-                }
-            }
-        }
     };
 
-} 
\ No newline at end of file
+}
@@ -0,0 +1,183 @@
+#pragma once
+#include "Serialization/BinarySerializer.h"
+#include "Serialization/BufferReader.h"
+
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <typeindex>
+#include <typeinfo>
+
+namespace Boon
+{
+    /**
+     * @brief Marks an argument that points straight at NUL terminated characters.
+     *
+     * String literals and char pointers are passed this way, so they can be
+     * sent as a std::string parameter without a temporary on the caller side.
+     */
+    struct NetRPCCString {};
+
+    /**
+     * @brief Type erased RPC argument handed to a generated send stub.
+     *
+     * Type is the exact type of the object Value points at. The stub checks
+     * it against the declared parameter type before reading the value.
+     */
+    struct NetRPCArgRef
+    {
+        const void* Value;
+        std::type_index Type;
+    };
+
+    template<typename A>
+    NetRPCArgRef MakeNetRPCArgRef(const A& value)
+    {
+        using Decayed = std::decay_t<A>;
+
+        if constexpr (std::is_same_v<Decayed, const char*> || std::is_same_v<Decayed, char*>)
+            return { static_cast<const char*>(value), typeid(NetRPCCString) };
+        else
+            return { &value, typeid(A) };
+    }
+
+    namespace NetRPCDetail
+    {
+        template<typename T, typename From>
+        bool ConvertFrom(const NetRPCArgRef& arg, T* pOut)
+        {
+            if (arg.Type != typeid(From))
+                return false;
+
+            if (pOut)
+                *pOut = static_cast<T>(*static_cast<const From*>(arg.Value));
+            return true;
+        }
+
+        /**
+         * @brief Convert any arithmetic argument to T, the same conversion a direct call would do.
+         *
+         * @param pOut Receives the value, may be nullptr to only test convertibility.
+         */
+        template<typename T>
+        bool ConvertArithmetic(const NetRPCArgRef& arg, T* pOut)
+        {
+            return ConvertFrom<T, bool>(arg, pOut) ||
+                ConvertFrom<T, char>(arg, pOut) ||
+                ConvertFrom<T, signed char>(arg, pOut) ||
+                ConvertFrom<T, unsigned char>(arg, pOut) ||
+                ConvertFrom<T, short>(arg, pOut) ||
+                ConvertFrom<T, unsigned short>(arg, pOut) ||
+                ConvertFrom<T, int>(arg, pOut) ||
+                ConvertFrom<T, unsigned int>(arg, pOut) ||
+                ConvertFrom<T, long>(arg, pOut) ||
+                ConvertFrom<T, unsigned long>(arg, pOut) ||
+                ConvertFrom<T, long long>(arg, pOut) ||
+                ConvertFrom<T, unsigned long long>(arg, pOut) ||
+                ConvertFrom<T, float>(arg, pOut) ||
+                ConvertFrom<T, double>(arg, pOut) ||
+                ConvertFrom<T, long double>(arg, pOut);
+        }
+
+        /**
+         * @brief Reader over the bytes ser has not consumed yet.
+         *
+         * Serializer reads align to a byte first, so a partly read byte counts as consumed.
+         */
+        inline BufferReader UnreadBytes(const BinarySerializer& ser)
+        {
+            const size_t readPos = (ser.GetReadBitPos() + 7) >> 3;
+            return readPos < ser.Size() ? BufferReader(ser.Data() + readPos, ser.Size() - readPos) : BufferReader();
+        }
+    }
+
+    /**
+     * @brief Typed wire encoding for a single RPC argument.
+     *
+     * Used by the generated RPC send stubs and receive thunks to write and
+     * read parameters straight into the packet serializer without boxing
+     * them into a Variant. The byte layout matches the Variant based path
+     * so both sides stay compatible when only one of them uses the stubs.
+     */
+    template<typename T>
+    struct NetRPCArg
+    {
+        static_assert(std::is_trivially_copyable_v<T>,
+            "NetRPCArg<T> requires a trivially copyable type or a specialization");
+
+        static void Write(BinarySerializer& ser, const T& value) { ser.Write<T>(value); }
+        static T Read(BinarySerializer& ser) { return ser.Read<T>(); }
+        static bool Skip(BufferReader& in) { return in.Skip(sizeof(T)); }
+
+        /**
+         * @brief Whether arg holds a T, or an arithmetic value that converts to one.
+         */
+        static bool Accepts(const NetRPCArgRef& arg)
+        {
+            if (arg.Type == typeid(T))
+                return true;
+
+            if constexpr (std::is_arithmetic_v<T>)
+                return NetRPCDetail::ConvertArithmetic<T>(arg, nullptr);
+            else
+                return false;
+        }
+
+        /**
+         * @brief Write arg as a T. Only valid once Accepts returned true.
+         */
+        static void WriteFrom(BinarySerializer& ser, const NetRPCArgRef& arg)
+        {
+            if (arg.Type == typeid(T))
+            {
+                Write(ser, *static_cast<const T*>(arg.Value));
+                return;
+            }
+
+            if constexpr (std::is_arithmetic_v<T>)
+            {
+                T value{};
+                NetRPCDetail::ConvertArithmetic<T>(arg, &value);
+                Write(ser, value);
+            }
+        }
+    };
+
+    template<>
+    struct NetRPCArg<std::string>
+    {
+        static void Write(BinarySerializer& ser, const std::string& value) { ser.WriteString(value); }
+        static std::string Read(BinarySerializer& ser) { return ser.ReadString(); }
+        static bool Skip(BufferReader& in) { return in.Skip(in.Read<uint32_t>()); }
+
+        static bool Accepts(const NetRPCArgRef& arg)
+        {
+            return arg.Type == typeid(std::string) ||
+                arg.Type == typeid(std::string_view) ||
+                arg.Type == typeid(NetRPCCString);
+        }
+
+        static void WriteFrom(BinarySerializer& ser, const NetRPCArgRef& arg)
+        {
+            if (arg.Type == typeid(std::string))
+                Write(ser, *static_cast<const std::string*>(arg.Value));
+            else if (arg.Type == typeid(std::string_view))
+                Write(ser, std::string(*static_cast<const std::string_view*>(arg.Value)));
+            else
+                Write(ser, arg.Value ? std::string(static_cast<const char*>(arg.Value)) : std::string());
+        }
+    };
+
+    /**
+     * @brief Whether arguments of the given types fit in the bytes ser has left.
+     *
+     * BinarySerializer only asserts its bounds, so receive thunks check the
+     * whole argument list against the packet before reading any of it.
+     */
+    template<typename... Ts>
+    bool NetRPCArgsFit(const BinarySerializer& ser)
+    {
+        BufferReader in = NetRPCDetail::UnreadBytes(ser);
+        return (NetRPCArg<Ts>::Skip(in) && ...);
+    }
+}
@@ -10,5 +10,9 @@ namespace Boon
 
 		std::string Ip = "127.0.0.1"; // default local host
 		uint16_t Port = 27020u;
+
+		// Join-in-progress scene snapshot
+		bool bCompressSnapshots = true;
+		uint32_t SnapshotChunkSize = 256u * 1024u; // bytes of raw object data per chunk
 	};
 }
\ No newline at end of file
@@ -2,12 +2,14 @@
 #include "Scene/GameObjectID.h"
 #include <glm/glm.hpp>
 
+#include <cstdint>
+
 namespace Boon
 {
 	struct Ray2D
 	{
 		glm::vec2 Origin;
-		glm::vec2 Direction;
+		glm::vec2 Direction;	// Normalized
 		float Distance;
 	};
 
@@ -16,5 +18,38 @@ namespace Boon
 		GameObjectID gameObject;
 		glm::vec2 point;
 		glm::vec2 normal;
+		float distance;
+	};
+
+	/**
+	 * @brief Which colliders a query sees.
+	 *
+	 * A collider is reported when its category is in MaskBits and the query's
+	 * CategoryBits are in the collider's mask, the same test Box2D uses for contacts.
+	 */
+	struct QueryFilter2D
+	{
+		uint64_t CategoryBits = 1;
+		uint64_t MaskBits = UINT64_MAX;
+	};
+
+	struct AABB2D
+	{
+		glm::vec2 Min;
+		glm::vec2 Max;
+	};
+
+	/**
+	 * @brief Box swept along a direction; zero extents with a radius make it a circle.
+	 */
+	struct ShapeCast2D
+	{
+		glm::vec2 Center;
+		glm::vec2 HalfExtents;
+		float Radius = 0.0f;
+		float Rotation = 0.0f;	// Degrees
+
+		glm::vec2 Direction;	// Normalized
+		float Distance;
 	};
 }
\ No newline at end of file
@@ -3,12 +3,20 @@
 
 #include <box2d/id.h>
 
+#include <cstdint>
 #include <functional>
+#include <memory>
+#include <span>
+#include <unordered_map>
+#include <vector>
 
 struct b2ContactBeginTouchEvent;
 namespace Boon
 {
 	class Scene;
+	class Tilemap;
+	struct Rigidbody2D;
+
 	class PhysicsWorld2D final
 	{
 	public:
@@ -48,7 +56,10 @@ namespace Boon
         void Step(Scene* pScene);
 
         /**
-         * @brief Update physics-related runtime state for the scene.
+         * @brief Place interpolated rigidbodies between their last two physics poses.
+         *
+         * Runs once per frame after the fixed steps, using Time::GetInterpolationAlpha,
+         * so rendering stays smooth at any ratio between frame rate and physics rate.
          * @param pScene Scene to update.
          */
         void Update(Scene* pScene);
@@ -57,24 +68,96 @@ namespace Boon
          * @brief Cast a ray into the physics world and return the first hit.
          * @param ray Ray to cast in world space.
          * @param result Output hit result populated on success.
+         * @param filter Colliders the ray can hit.
          * @return True if a hit was found, false otherwise.
          */
-        bool Raycast(const Ray2D& ray, HitResult2D& result) const;
+        bool Raycast(const Ray2D& ray, HitResult2D& result, const QueryFilter2D& filter = {}) const;
+
+        /**
+         * @brief Cast many rays at once, spread over the job threads.
+         *
+         * Ray i writes up to maxHitsPerRay hits, closest first, to
+         * hits[i * maxHitsPerRay] onwards and their number to hitCounts[i].
+         * With maxHitsPerRay of 1 only the closest hit is kept.
+         * @param hits Caller buffer of rays.size() * maxHitsPerRay results.
+         * @param hitCounts Caller buffer of rays.size() counts.
+         */
+        void RaycastBatch(std::span<const Ray2D> rays, std::span<HitResult2D> hits, std::span<uint32_t> hitCounts,
+            uint32_t maxHitsPerRay = 1, const QueryFilter2D& filter = {}) const;
+
+        /**
+         * @brief Sweep many boxes or circles at once; hits are laid out as in RaycastBatch.
+         */
+        void ShapeCastBatch(std::span<const ShapeCast2D> casts, std::span<HitResult2D> hits, std::span<uint32_t> hitCounts,
+            uint32_t maxHitsPerCast = 1, const QueryFilter2D& filter = {}) const;
+
+        /**
+         * @brief Game objects whose collider bounds overlap each box.
+         *
+         * Box i writes up to maxHitsPerBox objects to hits[i * maxHitsPerBox]
+         * onwards and their number to hitCounts[i].
+         */
+        void OverlapBatch(std::span<const AABB2D> boxes, std::span<GameObjectID> hits, std::span<uint32_t> hitCounts,
+            uint32_t maxHitsPerBox, const QueryFilter2D& filter = {}) const;
+
+        /**
+         * @brief Number of threads Box2D solves on, 1 when stepping single-threaded.
+         */
+        uint32_t GetWorkerCount() const { return m_WorkerCount; }
+
+        /**
+         * @brief Wall time of the last b2World_Step in milliseconds, as profiled by Box2D.
+         */
+        float GetStepMilliseconds() const;
 
 	private:
 		void SpawnRigidbody(class GameObject* obj);
+		void SyncMovedBodies(Scene* pScene);
 		void HandleEvents(Scene* pScene);
 
+		void OnRigidbodyAdded(entt::registry& registry, GameObjectID id);
+		void OnRigidbodyRemoved(entt::registry& registry, GameObjectID id);
+
+		void SyncTilemapColliders(Scene* pScene);
+		void OnTilemapColliderRemoved(entt::registry& registry, GameObjectID id);
+
+		b2BodyId GetBody(const Rigidbody2D& rb) const;
+
+		static void* EnqueueTask(void (*task)(int, int, uint32_t, void*), int itemCount, int minRange, void* taskContext, void* userContext);
+		static void FinishTask(void* userTask, void* userContext);
+
 		b2WorldId m_PhysicsWorldId = b2_nullWorldId;
 
-		struct RigidbodyRuntime
+		uint32_t m_WorkerCount = 1;
+
+		// Rigidbodies added while running, spawned at the start of the next step
+		std::vector<GameObjectID> m_PendingSpawns;
+
+		// Interpolated rigidbodies that moved during the last step
+		std::vector<GameObjectID> m_Interpolated;
+
+		struct TilemapChunkBody
 		{
 			b2BodyId Body = b2_nullBodyId;
-			bool Valid = false;
+			uint64_t Revision = 0;
+			uint32_t ShapeCount = 0;
 		};
 
-		RigidbodyRuntime* GetRuntime(GameObjectID id);
+		struct TilemapColliderRuntime
+		{
+			const Tilemap* Source = nullptr;
+			uint64_t Revision = 0;
+			float UnitSize = 0.0f;
+			int ChunkSize = 0;
+			std::unordered_map<uint64_t, TilemapChunkBody> Chunks;
+		};
+
+		void DestroyTilemapBodies(TilemapColliderRuntime& runtime);
+
+		std::unordered_map<GameObjectID, TilemapColliderRuntime> m_TilemapColliders;
 
-		std::unordered_map<GameObjectID, RigidbodyRuntime> m_RigidbodyRuntime;
+		// Box2D tasks scheduled on the JobSystem, null when stepping single-threaded
+		struct TaskPool;
+		std::unique_ptr<TaskPool> m_pTasks;
 	};
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 #include "Core/Window.h"
 #include "Networking/NetworkSettings.h"
+#include "BoonDebug/LogTypes.h"
 
 #include <string>
 #include <filesystem>
@@ -38,8 +39,22 @@ namespace Boon
         {
             bool bVSync = true;
             std::string Renderer = "Default";
+            bool bShaderCache = true;   // Stored under IntermediateRoot/ShaderCache
         } Render;
 
+        struct JobSettings
+        {
+            uint32_t WorkerCount = 0;   // 0 = hardware threads - 1
+        } Jobs;
+
+        struct PhysicsSettings
+        {
+            uint32_t WorkerCount = 0;   // 0 = every job thread, 1 = single-threaded
+            float FixedTimeStep = 0.02f; // Seconds; rigidbodies are interpolated between steps
+        } Physics;
+
         NetworkSettings Network{};
+
+        LogSettings Log{};
     };
 }
\ No newline at end of file
@@ -12,11 +12,13 @@
 #include "BProperty.h"
 #include "BFunction.h"
 #include "Core/Delegate.h"
+#include "Scene/GameObjectID.h"
 
 namespace Boon
 {
     struct ECSLifecycleSystem;
     class GameObject;
+    class Scene;
 
     class BClassRegistry;
     class NetRepRegistry;
@@ -61,6 +63,9 @@ namespace Boon
         using GetComponentFn = void* (*)(GameObject&);
         using HasComponentFn = bool (*)(GameObject&);
         using RemoveComponentFn = void (*)(GameObject&);
+        using AddComponentsFn = void (*)(Scene&, const GameObjectID*, size_t);
+        using CopyComponentsFn = void (*)(Scene&, Scene&);
+        using InsertComponentsFn = void (*)(Scene&, const GameObjectID*, size_t, const void*);
 
         RegisterFunc registerLifecycle = nullptr;
         UnregisterFunc unregister = nullptr;
@@ -73,6 +78,9 @@ namespace Boon
         GetComponentFn getComponent = nullptr;
         HasComponentFn hasComponent = nullptr;
         RemoveComponentFn removeComponent = nullptr;
+        AddComponentsFn addComponents = nullptr;
+        CopyComponentsFn copyComponents = nullptr;
+        InsertComponentsFn insertComponents = nullptr;
 
         uint8_t flags = 0;
 
@@ -217,6 +225,23 @@ namespace Boon
             functions.push_back(std::move(fn));
         }
 
+        /**
+         * @brief Attach generated network stubs to a previously added function.
+         *
+         * @param id Hashed id of the function name.
+         * @param write Typed send stub serializing the arguments.
+         * @param thunk Typed receive thunk deserializing and invoking the function.
+         */
+        inline void SetNetStubs(uint32_t id, BFunction::NetWriteFn write, BFunction::NetThunkFn thunk)
+        {
+            BFunction* fn = FindFunction(id);
+            if (!fn)
+                return;
+
+            fn->netWrite = write;
+            fn->netThunk = thunk;
+        }
+
         // Find function by ID
         /**
          * @brief Find a reflected function by hashed id.
@@ -11,6 +11,9 @@
 
 namespace Boon
 {
+    class BinarySerializer;
+    struct NetRPCArgRef;
+
     // ---------------------------------------------------------------------
     // Stable FNV-1a 32-bit hash for function IDs and name lookup
     // ---------------------------------------------------------------------
@@ -60,17 +63,26 @@ namespace Boon
      *
      * Contains a hashed id, parameter and metadata lists and a thunk used to
      * invoke the function on an instance with Variant arguments.
+     *
+     * RPC functions additionally carry generated network stubs that write and
+     * read the typed parameters directly from a BinarySerializer.
      */
     struct BFunction
     {
         using ThunkFn = void(*)(void* /*instance*/, Variant* /*args*/, size_t /*argCount*/);
+        using NetWriteFn = bool(*)(BinarySerializer& /*ser*/, const NetRPCArgRef* /*args*/);
+        using NetThunkFn = bool(*)(void* /*instance*/, BinarySerializer& /*ser*/);
 
         uint32_t id = 0;                              // FNV1a hash of function name
         std::vector<BFunctionParam> params;           // reflected parameter info
         std::vector<BFunctionMeta> meta;              // function metadata
         ThunkFn thunk = nullptr;                      // invocation wrapper
 
+        NetWriteFn netWrite = nullptr;                // typed send stub (RPC only)
+        NetThunkFn netThunk = nullptr;                // typed receive thunk, false if the arguments do not fit (RPC only)
+
         bool IsValid() const { return thunk != nullptr; }
+        bool HasNetStubs() const { return netWrite != nullptr && netThunk != nullptr; }
     };
 
 } // namespace Boon
@@ -82,6 +82,18 @@ namespace Boon
             {
                 go.template RemoveComponent<T>();
             };
+        cls.addComponents = [](Scene& scene, const GameObjectID* pObjects, size_t count) -> void
+            {
+                scene.template AddComponents<T>(pObjects, count);
+            };
+        cls.copyComponents = [](Scene& dst, Scene& src) -> void
+            {
+                dst.template CopyComponents<T>(src);
+            };
+        cls.insertComponents = [](Scene& scene, const GameObjectID* pObjects, size_t count, const void* pValue) -> void
+            {
+                scene.template InsertComponents<T>(pObjects, count, *static_cast<const T*>(pValue));
+            };
 
         registry.Register(&cls);
         return &cls;
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Boon
+{
+    struct AtlasPackSettings
+    {
+        /** Largest page edge. Pages are always power of two. */
+        uint32_t MaxPageSize = 4096;
+
+        /** Empty texels between the extruded borders of neighbouring images. */
+        uint32_t Padding = 2;
+
+        /** Edge texels repeated around every image, so filtering never samples a neighbour. */
+        uint32_t Extrude = 1;
+
+        /** Allow images to be placed rotated by 90 degrees clockwise. */
+        bool AllowRotation = false;
+    };
+
+    struct AtlasPackInput
+    {
+        uint32_t Width = 0;
+        uint32_t Height = 0;
+    };
+
+    /**
+     * @brief Placement of one input image. X/Y/Width/Height cover the image
+     * itself, without padding and extrusion, in texels of its page.
+     */
+    struct AtlasPackedRect
+    {
+        int Page = -1;
+        uint32_t X = 0;
+        uint32_t Y = 0;
+        uint32_t Width = 0;
+        uint32_t Height = 0;
+        bool Rotated = false;
+
+        bool IsPacked() const { return Page >= 0; }
+    };
+
+    struct AtlasPage
+    {
+        uint32_t Width = 0;
+        uint32_t Height = 0;
+        uint64_t UsedArea = 0;
+    };
+
+    struct AtlasPackResult
+    {
+        std::vector<AtlasPage> Pages;
+
+        /** One entry per input, in input order. */
+        std::vector<AtlasPackedRect> Rects;
+
+        /** Inputs larger than a page, left unpacked. */
+        std::vector<size_t> Rejected;
+
+        /** Image area over total page area, in [0, 1]. */
+        float Efficiency = 0.0f;
+        double Milliseconds = 0.0;
+    };
+
+    /**
+     * @brief Offline MaxRects bin packer for sprite atlases.
+     *
+     * Each page is packed by trying every power of two page size that could
+     * hold the remaining images against several free rectangle heuristics;
+     * the smallest page that takes everything wins, otherwise the page that
+     * takes the most area. The candidates are independent and run on the
+     * JobSystem when it is available. Inputs that do not fit on one page
+     * spill onto further pages.
+     */
+    class AtlasPacker final
+    {
+    public:
+        static AtlasPackResult Pack(const std::vector<AtlasPackInput>& inputs, const AtlasPackSettings& settings);
+
+        /**
+         * @brief Copy an RGBA8 image into its packed place and extrude its edges.
+         *
+         * The source is given unrotated; rotated placements are written turned
+         * 90 degrees clockwise. Different images may be blitted concurrently.
+         */
+        static void Blit(
+            uint8_t* pagePixels,
+            uint32_t pageWidth,
+            uint32_t pageHeight,
+            const uint8_t* imagePixels,
+            const AtlasPackedRect& rect,
+            uint32_t extrude);
+    };
+}
@@ -80,6 +80,28 @@ namespace Boon
 		 */
 		virtual int ReadPixel(uint32_t attachmentIndex, int x, int y) = 0;
 
+		/**
+		 * @brief Queue an asynchronous read of a pixel from a color attachment.
+		 *
+		 * The copy is recorded after whatever has been rendered so far and does not
+		 * wait for the GPU; collect the value with PollPixel once it has arrived,
+		 * usually one or two frames later. Requests made while every readback slot
+		 * is still in flight are dropped.
+		 *
+		 * @param attachmentIndex Index of the attachment to read from.
+		 * @param x X coordinate in pixels.
+		 * @param y Y coordinate in pixels.
+		 */
+		virtual void RequestPixel(uint32_t attachmentIndex, int x, int y) = 0;
+
+		/**
+		 * @brief Collect the newest finished asynchronous pixel read, never blocking.
+		 *
+		 * @param outValue Receives the value of the most recent completed request.
+		 * @return True if a request completed since the last poll.
+		 */
+		virtual bool PollPixel(int& outValue) = 0;
+
 		/**
 		 * @brief Clear an attachment to a given integer value.
 		 *
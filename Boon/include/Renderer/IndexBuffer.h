@@ -44,5 +44,13 @@ namespace Boon
 		 * @return Shared pointer to the created IndexBuffer.
 		 */
 		static std::shared_ptr<IndexBuffer> Create(uint32_t* indices, uint32_t count);
+
+		/**
+		 * @brief Create the index buffer for a run of quads (0, 1, 2, 2, 3, 0 per four vertices).
+		 *
+		 * @param quadCount Number of quads.
+		 * @return Shared pointer to the created IndexBuffer.
+		 */
+		static std::shared_ptr<IndexBuffer> CreateQuadPattern(uint32_t quadCount);
 	};
 }
\ No newline at end of file
@@ -2,13 +2,14 @@
 
 #include "Renderer/Pipeline.h"
 #include "Renderer/Texture.h"
-#include "Renderer/UniformBuffer.h"
+#include "Renderer/MaterialUniformPool.h"
 #include "Renderer/ShaderCompiler/ShaderReflection.h"
 #include "Core/Memory/Buffer.h"
 
 #include <memory>
 #include <string>
-#include <unordered_map>
+#include <string_view>
+#include <vector>
 #include <type_traits>
 #include <cstring>
 #include <utility>
@@ -17,6 +18,7 @@ namespace Boon
 {
 	struct MaterialTextureBinding
 	{
+		std::string Name;
 		std::shared_ptr<Texture2D> Texture = nullptr;
 		uint32_t Slot = 0;
 	};
@@ -24,14 +26,24 @@ namespace Boon
 	class Material
 	{
 	public:
+		/** Texture the 2D passes bind per draw; it goes through the batch texture slots, not the material. */
+		static constexpr std::string_view SpriteTextureName = "u_Texture";
+
 		explicit Material(std::shared_ptr<Pipeline> pipeline, const MaterialLayout& layout)
 			: m_Pipeline(std::move(pipeline))
-			, m_MaterialLayout(layout)
 			, m_Data(layout.UniformBufferSize)
+			, m_MaterialLayout(layout)
 			, m_UniformBinding(layout.UniformBinding)
 		{
 			if (layout.UniformBufferSize > 0)
-				m_UniformBuffer = UniformBuffer::Create(layout.UniformBufferSize, layout.UniformBinding);
+				m_Uniforms = MaterialUniformPool::Allocate(layout.UniformBufferSize, layout.UniformBinding);
+
+			// Texture IDs are the layout's texture indices, unbound until set
+			m_Textures.reserve(layout.Textures.size());
+			for (const MaterialTextureSlot& texture : layout.Textures)
+				m_Textures.push_back({ texture.Name, nullptr, texture.Slot });
+
+			m_SpriteTextureID = layout.GetTextureID(SpriteTextureName);
 		}
 
 		void Bind()
@@ -41,13 +53,15 @@ namespace Boon
 
 			m_Pipeline->Bind();
 
-			if (m_Dirty && m_UniformBuffer && m_Data.Size() > 0)
+			if (m_Uniforms.IsValid() && m_Data.Size() > 0)
 			{
-				m_UniformBuffer->SetData(m_Data.Data(), m_Data.Size());
-				m_Dirty = false;
+				UploadUniforms();
+
+				// Blocks share pages, so the range has to be bound every time
+				m_Uniforms.Bind(m_UniformBinding);
 			}
 
-			for (auto& [name, binding] : m_Textures)
+			for (const MaterialTextureBinding& binding : m_Textures)
 			{
 				if (binding.Texture)
 					binding.Texture->Bind(binding.Slot);
@@ -60,14 +74,74 @@ namespace Boon
 				m_Pipeline->Unbind();
 		}
 
+		/**
+		 * @brief Write pending parameter changes into the shared page without binding it.
+		 *
+		 * Batched draws read the block straight from the page, so the material
+		 * itself is never bound for them.
+		 */
+		void UploadUniforms()
+		{
+			if (!m_Dirty || !m_Uniforms.IsValid() || m_Data.Size() == 0)
+				return;
+
+			m_Uniforms.Upload(m_Data.Data(), m_Data.Size());
+			m_Dirty = false;
+		}
+
+		/**
+		 * @brief Resolve a parameter name once; pass the ID to SetValue on hot paths.
+		 */
+		MaterialParameterID GetParameterID(std::string_view name) const { return m_MaterialLayout.GetParameterID(name); }
+
+		/**
+		 * @brief Resolve a texture name once; pass the ID to SetTexture on hot paths.
+		 */
+		MaterialTextureID GetTextureID(std::string_view name) const
+		{
+			for (size_t i = 0; i < m_Textures.size(); ++i)
+			{
+				if (m_Textures[i].Name == name)
+					return { static_cast<uint32_t>(i) };
+			}
+
+			return {};
+		}
+
+		/**
+		 * @brief Like GetTextureID, but appends a binding when the shader does not declare the name.
+		 */
+		MaterialTextureID GetOrAddTextureID(std::string_view name)
+		{
+			MaterialTextureID id = GetTextureID(name);
+			if (id.IsValid())
+				return id;
+
+			id.Index = static_cast<uint32_t>(m_Textures.size());
+			m_Textures.push_back({ std::string(name), nullptr, 0 });
+
+			if (name == SpriteTextureName)
+				m_SpriteTextureID = id;
+
+			return id;
+		}
+
+		MaterialTextureID GetSpriteTextureID() const { return m_SpriteTextureID; }
+
 		template<typename T>
-		void SetValue(const std::string& name, const T& value)
+		void SetValue(MaterialParameterID id, const T& value)
 		{
-			const MaterialParameter* parameter = m_MaterialLayout.FindParameter(name);
-			if (!parameter)
+			if (!id.IsValid() || id.Index >= m_MaterialLayout.Parameters.size())
 				return;
 
-			SetValue(parameter->Offset, value);
+			SetValue(static_cast<size_t>(m_MaterialLayout.Parameters[id.Index].Offset), value);
+		}
+
+		/** Name lookup for tools and setup code; resolve an ID for per-frame updates. */
+		template<typename T>
+		void SetValue(const std::string& name, const T& value)
+		{
+			SetValue(GetParameterID(name), value);
 		}
 
 		template<typename T>
@@ -78,7 +152,7 @@ namespace Boon
 			EnsureDataSize(offset + sizeof(T));
 
 			std::memcpy(m_Data.DataAt(offset), &value, sizeof(T));
-			m_Dirty = true;
+			MarkDirty();
 		}
 
 		void SetRaw(size_t offset, const void* data, size_t size)
@@ -89,27 +163,58 @@ namespace Boon
 			EnsureDataSize(offset + size);
 
 			std::memcpy(m_Data.DataAt(offset), data, size);
-			m_Dirty = true;
+			MarkDirty();
 		}
 
-		void SetTexture(const std::string& name, std::shared_ptr<Texture2D> texture, uint32_t slot)
+		void SetTexture(MaterialTextureID id, std::shared_ptr<Texture2D> texture, uint32_t slot)
 		{
-			auto& binding = m_Textures[name];
+			if (!id.IsValid() || id.Index >= m_Textures.size())
+				return;
+
+			MaterialTextureBinding& binding = m_Textures[id.Index];
 
 			if (binding.Texture == texture && binding.Slot == slot)
 				return;
 
 			binding.Texture = std::move(texture);
 			binding.Slot = slot;
+			m_HashDirty = true;
 		}
 
-		std::shared_ptr<Texture2D> GetTexture(const std::string& name) const
+		/** Name lookup for tools and setup code; resolve an ID for per-frame updates. */
+		void SetTexture(const std::string& name, std::shared_ptr<Texture2D> texture, uint32_t slot)
+		{
+			SetTexture(GetOrAddTextureID(name), std::move(texture), slot);
+		}
+
+		/**
+		 * @brief Unbind a texture. The ID stays valid.
+		 */
+		void RemoveTexture(MaterialTextureID id)
+		{
+			if (!id.IsValid() || id.Index >= m_Textures.size() || !m_Textures[id.Index].Texture)
+				return;
+
+			m_Textures[id.Index].Texture = nullptr;
+			m_HashDirty = true;
+		}
+
+		void RemoveTexture(const std::string& name)
 		{
-			auto it = m_Textures.find(name);
-			if (it == m_Textures.end())
+			RemoveTexture(GetTextureID(name));
+		}
+
+		std::shared_ptr<Texture2D> GetTexture(MaterialTextureID id) const
+		{
+			if (!id.IsValid() || id.Index >= m_Textures.size())
 				return nullptr;
 
-			return it->second.Texture;
+			return m_Textures[id.Index].Texture;
+		}
+
+		std::shared_ptr<Texture2D> GetTexture(const std::string& name) const
+		{
+			return GetTexture(GetTextureID(name));
 		}
 
 		template<typename T>
@@ -125,19 +230,82 @@ namespace Boon
 		{
 			auto instance = std::make_shared<Material>(m_Pipeline, m_MaterialLayout);
 
-			instance->m_Data = m_Data;
-			instance->m_Dirty = true;
+			instance->SetRaw(0, m_Data.Data(), m_Data.Size());
 			instance->m_Textures = m_Textures;
+			instance->m_SpriteTextureID = m_SpriteTextureID;
+			instance->m_HashDirty = true;
 
 			return instance;
 		}
 
+		/**
+		 * @brief Hash of everything that affects rendering: pipeline state,
+		 *        parameter bytes and texture bindings.
+		 *
+		 * Two materials with the same hash (and HasSameContent) are interchangeable.
+		 */
+		uint64_t GetContentHash() const;
+
+		/**
+		 * @brief Hash of the state that forces a separate 2D batch.
+		 *
+		 * Pipeline state and texture bindings, without the sprite texture (bound
+		 * through the batch texture slots) and without the parameter bytes: the
+		 * 2D renderer moves those into vertex attributes, or has each quad index
+		 * its block in the shared uniform page.
+		 */
+		uint64_t GetBatchHash() const;
+
+		/**
+		 * @brief Hash of the parameter bytes alone.
+		 */
+		uint64_t GetParameterHash() const;
+
+		bool HasSameContent(const Material& other) const;
+
+		/**
+		 * @brief True when quads of both materials can share a draw.
+		 *
+		 * Parameters never split a batch, but the 2D renderer also keys batches
+		 * by uniform page, since a draw can only bind one.
+		 */
+		bool IsBatchCompatible(const Material& other) const;
+
+		/**
+		 * @brief True when the shader reads parameters from a material uniform block.
+		 */
+		bool UsesUniformBlock() const { return m_MaterialLayout.UniformBufferSize > 0; }
+
+		/**
+		 * @brief Shared page holding this instance's parameter block, nullptr without a block.
+		 */
+		const std::shared_ptr<UniformBuffer>& GetUniformPage() const { return m_Uniforms.GetPage(); }
+		uint32_t GetUniformPageSize() const { return m_Uniforms.GetPageSize(); }
+
+		/**
+		 * @brief Index of the block's first vec4 in its page.
+		 *
+		 * Batched quads carry it as a vertex attribute and index the page with it.
+		 */
+		uint32_t GetUniformSlot() const { return m_Uniforms.GetOffset() / 16; }
+
 		std::shared_ptr<Pipeline> GetPipeline() const { return m_Pipeline; }
 
 		const Buffer& GetData() const { return m_Data; }
-		Buffer& GetData() { return m_Data; }
+		Buffer& GetData() { MarkDirty(); return m_Data; }
+
+		const MaterialLayout& GetLayout() const { return m_MaterialLayout; }
+
+		/** Flat binding array indexed by MaterialTextureID::Index; unbound entries have no texture. */
+		const std::vector<MaterialTextureBinding>& GetTextures() const { return m_Textures; }
 
 	private:
+		void MarkDirty()
+		{
+			m_Dirty = true;
+			m_HashDirty = true;
+		}
+
 		void EnsureDataSize(size_t requiredSize)
 		{
 			if (requiredSize <= m_Data.Size())
@@ -145,19 +313,27 @@ namespace Boon
 
 			m_Data.Resize(requiredSize);
 
-			m_UniformBuffer = UniformBuffer::Create(static_cast<uint32_t>(m_Data.Size()), m_UniformBinding);
+			m_Uniforms = MaterialUniformPool::Allocate(static_cast<uint32_t>(m_Data.Size()), m_UniformBinding);
 
 			m_Dirty = true;
 		}
 
+		void UpdateHashes() const;
+
 		std::shared_ptr<Pipeline> m_Pipeline = nullptr;
 
 		Buffer m_Data;
 		MaterialLayout m_MaterialLayout;
-		std::shared_ptr<UniformBuffer> m_UniformBuffer = nullptr;
+		MaterialUniformAllocation m_Uniforms;
 		bool m_Dirty = true;
 		uint32_t m_UniformBinding = 2;
 
-		std::unordered_map<std::string, MaterialTextureBinding> m_Textures;
+		std::vector<MaterialTextureBinding> m_Textures;
+		MaterialTextureID m_SpriteTextureID;
+
+		mutable uint64_t m_ContentHash = 0;
+		mutable uint64_t m_BatchHash = 0;
+		mutable uint64_t m_ParameterHash = 0;
+		mutable bool m_HashDirty = true;
 	};
-}
\ No newline at end of file
+}
@@ -0,0 +1,41 @@
+#pragma once
+#include "Renderer/Material.h"
+
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+
+namespace Boon
+{
+	/**
+	 * @brief Deduplicates material instances by content.
+	 *
+	 * Instances with identical pipeline state, parameter bytes and textures
+	 * resolve to one canonical Material, so renderers that batch by material
+	 * see them as a single batch. Entries are weak: a canonical material dies
+	 * with its last user.
+	 *
+	 * Canonical materials are shared; callers must not modify them afterwards.
+	 */
+	class MaterialInstanceCache final
+	{
+	public:
+		/**
+		 * @brief Return the canonical material equal to the given one, registering it if new.
+		 */
+		static std::shared_ptr<Material> Acquire(const std::shared_ptr<Material>& material);
+
+		/**
+		 * @brief Number of live canonical materials.
+		 */
+		static size_t GetSize();
+
+		static void Clear();
+
+	private:
+		static void PurgeExpired();
+
+		static std::unordered_multimap<uint64_t, std::weak_ptr<Material>> s_Entries;
+		static uint32_t s_AcquiresSincePurge;
+	};
+}
@@ -0,0 +1,107 @@
+#pragma once
+#include "Renderer/UniformBuffer.h"
+
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace Boon
+{
+	/**
+	 * @brief Range of a shared uniform buffer page owned by one material.
+	 *
+	 * Released back to the pool when destroyed.
+	 */
+	class MaterialUniformAllocation final
+	{
+	public:
+		MaterialUniformAllocation() = default;
+		~MaterialUniformAllocation();
+
+		MaterialUniformAllocation(const MaterialUniformAllocation&) = delete;
+		MaterialUniformAllocation& operator=(const MaterialUniformAllocation&) = delete;
+
+		MaterialUniformAllocation(MaterialUniformAllocation&& other) noexcept;
+		MaterialUniformAllocation& operator=(MaterialUniformAllocation&& other) noexcept;
+
+		bool IsValid() const { return m_pPage != nullptr; }
+
+		void Upload(const void* data, size_t size);
+		void Bind(uint32_t binding) const;
+
+		uint32_t GetOffset() const { return m_Offset; }
+		uint32_t GetSize() const { return m_Size; }
+
+		/**
+		 * @brief Buffer the range lives in, shared with other materials of the same page.
+		 */
+		const std::shared_ptr<UniformBuffer>& GetPage() const { return m_pPage; }
+		uint32_t GetPageSize() const { return m_PageSize; }
+
+	private:
+		friend class MaterialUniformPool;
+
+		void Release();
+
+		std::shared_ptr<UniformBuffer> m_pPage = nullptr;
+		uint32_t m_Offset = 0;
+		uint32_t m_Size = 0;
+		uint32_t m_PageSize = 0;
+	};
+
+	/**
+	 * @brief Packs material parameter blocks into a few large uniform buffers.
+	 *
+	 * Instead of one UniformBuffer per material instance, every instance gets an
+	 * aligned range of a shared page and binds it with a dynamic offset. Freed
+	 * ranges are recycled per size class.
+	 */
+	class MaterialUniformPool final
+	{
+	public:
+		/**
+		 * @brief Size of a shared page.
+		 *
+		 * Kept at the 16 KB GL_MAX_UNIFORM_BLOCK_SIZE every OpenGL driver has to
+		 * support, since batched sprite shaders declare the whole page as one
+		 * block (BoonMaterialPage in SpriteBatchFrag.glsl must match).
+		 */
+		static constexpr uint32_t PageSize = 16 * 1024;
+
+		/**
+		 * @brief Allocate a range able to hold size bytes.
+		 *
+		 * @param binding Binding point of the material block; only used as the
+		 *                initial binding of a newly created page so it never
+		 *                clobbers the engine's camera/object blocks.
+		 */
+		static MaterialUniformAllocation Allocate(uint32_t size, uint32_t binding);
+
+		/**
+		 * @brief Drop every page. Outstanding allocations keep their page alive.
+		 */
+		static void Clear();
+
+	private:
+		friend class MaterialUniformAllocation;
+
+		struct FreeRange
+		{
+			std::weak_ptr<UniformBuffer> Page;
+			uint32_t Offset = 0;
+		};
+
+		struct Page
+		{
+			std::shared_ptr<UniformBuffer> Buffer;
+			uint32_t Used = 0;
+		};
+
+		static void Free(const std::shared_ptr<UniformBuffer>& page, uint32_t offset, uint32_t size);
+		static uint32_t AlignSize(uint32_t size);
+
+		static std::vector<Page> s_Pages;
+		static std::unordered_map<uint32_t, std::vector<FreeRange>> s_FreeRanges;
+	};
+}
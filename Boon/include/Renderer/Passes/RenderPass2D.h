@@ -62,8 +62,8 @@ namespace Boon
 	public:
 		virtual ~TilemapRenderPass() = default;
 
-		TilemapRenderPass(const std::shared_ptr<Material>& material)
-			: m_pMaterial{ material }{ }
+		TilemapRenderPass(const std::shared_ptr<Material>& material, const std::shared_ptr<Material>& lookupMaterial = nullptr)
+			: m_pMaterial{ material }, m_pLookupMaterial{ lookupMaterial }{ }
 
 		void Execute(RenderContext& context) override;
 
@@ -79,5 +79,6 @@ namespace Boon
 
 	private:
 		std::shared_ptr<Material> m_pMaterial;
+		std::shared_ptr<Material> m_pLookupMaterial;
 	};
 }
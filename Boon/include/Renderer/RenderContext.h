@@ -1,6 +1,8 @@
 #pragma once
 #include "Renderer/RendererTypes.h"
 
+#include <glm/glm.hpp>
+
 namespace Boon
 {
 	class Scene;
@@ -15,5 +17,6 @@ namespace Boon
 		Renderer3D& Renderer3D;
 		UniformBuffer& ObjectUniformBuffer;
 		RenderPhaseID CurrentPhase = 0;
+		glm::vec3 CameraPosition{ 0.0f };	// World space, set by BeginScene
 	};
 }
\ No newline at end of file
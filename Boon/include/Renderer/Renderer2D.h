@@ -7,7 +7,9 @@
 #include "Renderer/Material.h"
 
 #include <array>
+#include <functional>
 #include <memory>
+#include <span>
 #include <vector>
 #include <unordered_map>
 
@@ -25,11 +27,19 @@ namespace Boon
 
 	struct QuadBatchKey
 	{
-		std::shared_ptr<Material> Material = nullptr;
+		uint64_t Hash = 0;
+		const Material* Material = nullptr;
+
+		// Quads of one batch index their parameter blocks in this page
+		const UniformBuffer* UniformPage = nullptr;
 
 		bool operator==(const QuadBatchKey& other) const
 		{
-			return Material.get() == other.Material.get();
+			if (Hash != other.Hash || UniformPage != other.UniformPage)
+				return false;
+
+			return Material == other.Material
+				|| (Material && other.Material && Material->IsBatchCompatible(*other.Material));
 		}
 	};
 
@@ -37,10 +47,26 @@ namespace Boon
 	{
 		size_t operator()(const QuadBatchKey& key) const
 		{
-			return std::hash<void*>{}(key.Material.get());
+			return static_cast<size_t>(key.Hash) ^ std::hash<const UniformBuffer*>{}(key.UniformPage);
 		}
 	};
 
+	struct Renderer2DStats
+	{
+		uint32_t QuadCount = 0;
+		uint32_t BatchCount = 0;       // quad batches that received geometry this frame
+		uint32_t DrawCalls = 0;        // quad draws issued, including overflow flushes
+	};
+
+	/**
+	 * @brief Quad batch counts for one set of quads, with and without parameter splitting.
+	 */
+	struct Renderer2DBatchComparison
+	{
+		uint32_t ParameterKeyed = 0;   // one batch per distinct parameter block, the old keying
+		uint32_t PageIndexed = 0;      // quads index their block in the shared uniform page
+	};
+
 	class IndexBuffer;
 
 	class Renderer2D final
@@ -79,19 +105,44 @@ namespace Boon
 
 		void SubmitLine(const glm::vec3& p0, const glm::vec3& p1, const glm::vec4& color);
 
+		/**
+		 * @brief Write prepared lines straight into the line batch, skipping the render queue.
+		 *
+		 * Only valid between Begin and End.
+		 */
+		void SubmitLines(const std::vector<LineRenderItem2D>& lines);
+
 		void SubmitRect(const glm::vec3& position, const glm::vec2& size, const glm::vec4& color);
 		void SubmitRect(const glm::vec3& position, const glm::vec2& size, float rotation, const glm::vec4& color);
 		void SubmitRect(const glm::mat4& transform, const glm::vec2& size, const glm::vec4& color);
 
 		void SubmitPolygon(const std::vector<glm::vec3>& positions, const glm::vec4& color);
 
+		const Renderer2DStats& GetStats() const { return m_Stats; }
+
+		/**
+		 * @brief Count the quad batches a set of quads needs, before and after page indexing.
+		 *
+		 * Only reads material hashes and touches no GPU state, so it runs headless
+		 * on captured render items. Texture slot overflow is not counted.
+		 *
+		 * @param defaultMaterial Material of quads without an override.
+		 */
+		static Renderer2DBatchComparison CompareBatchCounts(std::span<const QuadRenderItem2D> quads, const Material* defaultMaterial);
+
 	private:
 		static constexpr uint32_t s_MaxTextureSlots = 32;
+		static constexpr uint64_t s_UnusedBatchFrames = 120;
 
 		struct QuadBatchState
 		{
 			RenderBatch Batch;
 			std::shared_ptr<Material> Material = nullptr;
+			uint64_t LastUsedFrame = 0;
+
+			// Bound whole in place of the material's own range
+			std::shared_ptr<UniformBuffer> UniformPage = nullptr;
+			uint32_t UniformPageSize = 0;
 
 			std::array<std::shared_ptr<Texture2D>, s_MaxTextureSlots> TextureSlots{};
 			uint32_t TextureSlotIndex = 1;
@@ -110,6 +161,8 @@ namespace Boon
 		std::shared_ptr<Material> m_pDefaultLineMaterial = nullptr;
 
 		std::unordered_map<QuadBatchKey, QuadBatchState, QuadBatchKeyHasher> m_QuadBatches;
+		uint64_t m_FrameIndex = 0;
+		Renderer2DStats m_Stats{};
 
 		std::shared_ptr<Texture2D> m_pWhiteTexture = nullptr;
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <string>
 
@@ -35,8 +36,10 @@ namespace Boon
 		 *
 		 * @param vertexSrc Source code for the vertex shader stage.
 		 * @param fragmentSrc Source code for the fragment shader stage.
+		 * @param cacheKey ShaderCache key of the sources; when non-zero the linked
+		 *        program is loaded from and stored to the cache if the API supports it.
 		 * @return Shared pointer to a Shader instance, or nullptr on failure.
 		 */
-		static std::shared_ptr<Shader> Create(const std::string& vertexSrc, const std::string& fragmentSrc);
+		static std::shared_ptr<Shader> Create(const std::string& vertexSrc, const std::string& fragmentSrc, uint64_t cacheKey = 0);
 	};
 }
\ No newline at end of file
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "Renderer/ShaderCompiler/ShaderReflection.h"
+#include "Core/Memory/Buffer.h"
+#include "Serialization/BufferReader.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Boon
+{
+    /**
+     * @brief On-disk cache for shader build products.
+     *
+     * Reflection results and linked program binaries are keyed by a hash of
+     * the fully resolved stage sources. Preprocessed sources are keyed by the
+     * raw source and its directory, and are only returned while every include
+     * they pulled in still has the size and write time it had when stored.
+     *
+     * Nothing here needs a GPU; program binaries are opaque bytes tagged with
+     * the driver that produced them. Until a directory is set every lookup
+     * misses and every store is dropped.
+     */
+    class ShaderCache final
+    {
+    public:
+        static void SetDirectory(const std::filesystem::path& directory);
+        static std::filesystem::path GetDirectory();
+        static bool IsEnabled();
+
+        /**
+         * @brief Key for reflection and program binary entries.
+         */
+        static uint64_t ComputeKey(std::string_view vertexSource, std::string_view fragmentSource);
+
+        static std::optional<ShaderReflection> LoadReflection(uint64_t key);
+        static void StoreReflection(uint64_t key, const ShaderReflection& reflection);
+
+        /**
+         * @param driverTag Identifies the driver; binaries stored under another tag are ignored.
+         */
+        static bool LoadProgramBinary(uint64_t key, std::string_view driverTag, uint32_t& outFormat, Buffer& outBinary);
+        static void StoreProgramBinary(uint64_t key, std::string_view driverTag, uint32_t format, const Buffer& binary);
+
+        static std::optional<std::string> LoadPreprocessed(
+            const std::filesystem::path& directory,
+            std::string_view rawSource);
+
+        static void StorePreprocessed(
+            const std::filesystem::path& directory,
+            std::string_view rawSource,
+            const std::string& resolvedSource,
+            const std::vector<std::filesystem::path>& dependencies);
+
+        /**
+         * @brief Delete every cache file in the directory.
+         */
+        static void Clear();
+
+        static void SerializeReflection(Buffer& out, const ShaderReflection& reflection);
+        static bool DeserializeReflection(BufferReader& in, ShaderReflection& outReflection);
+    };
+}
@@ -2,7 +2,9 @@
 
 #include <filesystem>
 #include <string>
+#include <string_view>
 #include <unordered_set>
+#include <vector>
 
 namespace Boon
 {
@@ -18,8 +20,33 @@ namespace Boon
             const std::filesystem::path& currentDirectory,
             std::unordered_set<std::filesystem::path>& includeStack);
 
+        /**
+         * @brief Resolve includes and report every file that was pulled in.
+         */
+        static std::string ResolveIncludes(
+            const std::string& source,
+            const std::filesystem::path& currentDirectory,
+            std::vector<std::filesystem::path>& outDependencies);
+
+        /**
+         * @brief ResolveIncludes backed by the ShaderCache.
+         *
+         * Returns the cached result when neither the source nor any of its
+         * includes changed since it was stored.
+         */
+        static std::string ResolveIncludesCached(
+            const std::string& source,
+            const std::filesystem::path& currentDirectory);
+
     private:
-        static bool TryParseInclude(const std::string& line, std::string& includePath);
+        static void ResolveIncludesInto(
+            std::string_view source,
+            const std::filesystem::path& currentDirectory,
+            std::unordered_set<std::filesystem::path>& includeStack,
+            std::string& output,
+            std::vector<std::filesystem::path>* dependencies);
+
+        static bool TryParseInclude(std::string_view line, std::string_view& includePath);
         static std::filesystem::path ResolveIncludePath(
             const std::filesystem::path& includePath,
             const std::filesystem::path& currentDirectory);
@@ -2,8 +2,10 @@
 
 #include "Renderer/VertexBufferLayout.h"
 
+#include <cstdint>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace Boon
@@ -33,6 +35,36 @@ namespace Boon
         bool IsArray = false;
     };
 
+    /**
+     * @brief Index of a parameter in MaterialLayout::Parameters.
+     *
+     * Resolve it once from the name and keep it; setting a value through an ID
+     * skips the string lookup.
+     */
+    struct MaterialParameterID
+    {
+        static constexpr uint32_t Invalid = UINT32_MAX;
+
+        uint32_t Index = Invalid;
+
+        bool IsValid() const { return Index != Invalid; }
+    };
+
+    /**
+     * @brief Index into a material's flat texture binding array.
+     *
+     * The first IDs match MaterialLayout::Textures; bindings a material adds
+     * for names the shader does not declare come after them.
+     */
+    struct MaterialTextureID
+    {
+        static constexpr uint32_t Invalid = UINT32_MAX;
+
+        uint32_t Index = Invalid;
+
+        bool IsValid() const { return Index != Invalid; }
+    };
+
     struct MaterialLayout
     {
         uint32_t UniformBufferSize = 0;
@@ -63,6 +95,28 @@ namespace Boon
             return nullptr;
         }
 
+        MaterialParameterID GetParameterID(std::string_view name) const
+        {
+            for (size_t i = 0; i < Parameters.size(); ++i)
+            {
+                if (Parameters[i].Name == name)
+                    return { static_cast<uint32_t>(i) };
+            }
+
+            return {};
+        }
+
+        MaterialTextureID GetTextureID(std::string_view name) const
+        {
+            for (size_t i = 0; i < Textures.size(); ++i)
+            {
+                if (Textures[i].Name == name)
+                    return { static_cast<uint32_t>(i) };
+            }
+
+            return {};
+        }
+
         std::optional<uint32_t> FindTextureSlot(const std::string& name) const
         {
             const MaterialTextureSlot* texture = FindTexture(name);
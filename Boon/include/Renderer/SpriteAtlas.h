@@ -58,6 +58,7 @@ namespace Boon
         void SetTexture(const AssetRef<Texture2DAsset>& texture)
         {
             m_pTexture = texture;
+            ++m_Version;
         }
 
         const AssetRef<Texture2DAsset>& GetTexture() const
@@ -84,6 +85,7 @@ namespace Boon
 
             m_Frames.push_back(FrameEntry{ id, frame });
             m_IdToIndex[static_cast<size_t>(id)] = index;
+            ++m_Version;
 
             return id;
         }
@@ -107,6 +109,8 @@ namespace Boon
             if (stableId >= m_NextId)
                 m_NextId = stableId + 1;
 
+            ++m_Version;
+
             return true;
         }
 
@@ -130,6 +134,7 @@ namespace Boon
 
             m_IdToIndex[static_cast<size_t>(stableId)] = -1;
             m_FreeIds.push(stableId);
+            ++m_Version;
 
             // Remove deleted frame references from clips.
             for (SpriteAnimClip& clip : m_Clips)
@@ -161,6 +166,7 @@ namespace Boon
 
             m_Frames[index].stableId = stableId;
             m_Frames[index].frame = frame;
+            ++m_Version;
         }
 
         void SetOrAddSpriteFrame(int stableId, const SpriteFrame& frame)
@@ -179,12 +185,14 @@ namespace Boon
 
         SpriteFrame& GetSpriteFrameMutable(int stableId)
         {
+            ++m_Version;
             const int index = m_IdToIndex.at(static_cast<size_t>(stableId));
             return m_Frames[index].frame;
         }
 
         std::vector<FrameEntry>& GetFrameEntries()
         {
+            ++m_Version;
             return m_Frames;
         }
 
@@ -198,6 +206,24 @@ namespace Boon
             return m_Frames.size();
         }
 
+        /**
+         * @brief Largest frame id plus one; ids below it may be unused.
+         */
+        int GetFrameIdCapacity() const
+        {
+            return static_cast<int>(m_IdToIndex.size());
+        }
+
+        /**
+         * @brief Incremented whenever frames or the texture change.
+         *
+         * Mutable accessors count as a change, since the caller may edit through them.
+         */
+        uint32_t GetVersion() const
+        {
+            return m_Version;
+        }
+
         std::vector<int> GetAllFrameIDs() const
         {
             std::vector<int> ids;
@@ -286,6 +312,7 @@ namespace Boon
         std::vector<int> m_IdToIndex;
         std::queue<int> m_FreeIds;
         int m_NextId = 0;
+        uint32_t m_Version = 0;
 
         std::vector<SpriteAnimClip> m_Clips;
     };
@@ -12,7 +12,8 @@ namespace Boon
 		R8,
 		RGB8,
 		RGBA8,
-		RGBA32F
+		RGBA32F,
+		R32I
 	};
 
 	enum class ImageFilter
@@ -75,6 +76,13 @@ namespace Boon
 		 */
 		virtual void SetData(Buffer& buffer) = 0;
 
+		/**
+		 * @brief Upload pixel data to a sub-rectangle of the texture.
+		 *
+		 * @param data Tightly packed pixels in the texture's format.
+		 */
+		virtual void SetSubData(const void* data, uint32_t x, uint32_t y, uint32_t width, uint32_t height) = 0;
+
 		/**
 		 * @brief Bind the texture to the given slot for rendering.
 		 *
@@ -4,34 +4,103 @@
 #include "Renderer/VertexInput.h"
 #include "Renderer/VertexBuffer.h"
 #include "Renderer/IndexBuffer.h"
+#include "Renderer/Texture.h"
+#include "Renderer/TilemapChunkStore.h"
+#include "Renderer/VertexData.h"
 #include "Asset/SpriteAtlasAsset.h"
 
+#include <glm/glm.hpp>
+
 #include <vector>
 #include <memory>
+#include <cstdint>
+#include <unordered_map>
 
 namespace Boon
 {
     struct TilemapChunk
     {
-        int ChunkX, ChunkY;
+        int ChunkX = 0, ChunkY = 0;
         bool Dirty = true;
 
-        std::vector<int> Tiles;
+        std::vector<int> Tiles;     // Empty until the chunk gets its first tile
+        int TileCount = 0;          // Non-empty tiles
+
+        // Streaming
+        bool Streamed = false;      // Came from the stream source and may be evicted
+        bool Modified = false;      // Edited since it was streamed in, kept resident
+
+        // Changes whenever the chunk's tiles do, unique across the map so a reloaded chunk never matches
+        uint64_t Revision = 0;
 
+        // Mesh mode, allocated on first build. Tile i owns vertices [4i, 4i + 4)
         std::shared_ptr<VertexInput>  VertexInput;
         std::shared_ptr<VertexBuffer> VertexBuffer;
+        uint32_t MeshDirtyBegin = 0;    // Tile range the next build rewrites
+        uint32_t MeshDirtyEnd = 0;
+
+        // Tile lookup mode
+        int LookupSlot = -1;
+        bool LookupDirty = true;    // Whole chunk needs uploading
+        std::shared_ptr<Boon::VertexInput> LookupQuad;
     };
 
+    /**
+     * @brief Block of solid tiles in chunk-local tile coordinates.
+     */
+    struct TileRect
+    {
+        int X = 0, Y = 0;
+        int Width = 0, Height = 0;
+    };
+
+    /**
+     * @brief Memory held by a tilemap and bytes uploaded since creation.
+     */
+    struct TilemapStats
+    {
+        uint32_t ResidentChunks = 0;
+        size_t TileBytes = 0;
+        size_t MeshBytes = 0;
+        size_t PooledMeshBytes = 0;     // Released chunk buffers kept for reuse
+        size_t LookupBytes = 0;
+        uint64_t UploadedBytes = 0;
+    };
+
+    /**
+     * @brief Chunk streaming counters. Load latency runs from request to resident.
+     */
+    struct TilemapStreamingStats
+    {
+        uint32_t PendingLoads = 0;
+        uint64_t LoadedChunks = 0;
+        uint64_t EvictedChunks = 0;
+        uint64_t DiskBytesRead = 0;
+        double LastLoadMs = 0.0;
+        double AverageLoadMs = 0.0;
+        double MaxLoadMs = 0.0;
+    };
+
+    /**
+     * @brief Sparse chunked tile grid.
+     *
+     * Chunks live in a hash map keyed by chunk coordinates and are only
+     * created once they hold a tile, so empty space costs nothing. A map with
+     * zero chunks on both axes is unbounded and accepts negative coordinates.
+     * GPU buffers of released chunks are pooled and reused.
+     */
     class Tilemap
     {
     public:
+        using ChunkMap = std::unordered_map<uint64_t, TilemapChunk>;
+
         Tilemap() = default;
 
         /**
          * @brief Construct a Tilemap with the given chunk layout.
          *
-         * @param chunksX Number of chunks in X direction.
-         * @param chunksY Number of chunks in Y direction.
+         * @param chunksX Number of chunks in X direction, 0 for unbounded.
+         * @param chunksY Number of chunks in Y direction, 0 for unbounded.
          * @param chunkSize Size of each chunk (tiles per side).
          */
         Tilemap(int chunksX, int chunksY, int chunkSize);
@@ -56,12 +125,18 @@ namespace Boon
         /**
          * @brief Resize the tilemap and its chunk configuration.
          *
+         * Tiles keep their tile coordinates. Chunks outside the new bounds are
+         * dropped; the rest are untouched unless the chunk size changes, in
+         * which case only non-empty tiles are moved into the new chunks.
+         *
          * @param newChunksX New number of chunks in X.
          * @param newChunksY New number of chunks in Y.
          * @param newChunkSize New chunk size in tiles.
          */
         void Resize(int newChunksX, int newChunksY, int newChunkSize);
 
+        inline bool IsBounded() const { return m_ChunksX > 0 && m_ChunksY > 0; }
+
         /**
          * @brief Set the tile id at world tile coordinates.
          *
@@ -83,6 +158,8 @@ namespace Boon
         /**
          * @brief Check whether the given tile coordinates are within the map bounds.
          *
+         * Always true for unbounded maps.
+         *
          * @param x Tile X coordinate.
          * @param y Tile Y coordinate.
          * @return true if the coordinates are valid, false otherwise.
@@ -100,16 +177,83 @@ namespace Boon
         int  GetTile(int chunkX, int chunkY, int x, int y) const;
 
         /**
-         * @brief Rebuild any chunks marked as dirty.
+         * @brief Replace every tile of a chunk at once.
+         *
+         * @param tiles chunkSize * chunkSize tile ids, row-major.
+         */
+        void SetChunkTiles(int chunkX, int chunkY, std::vector<int> tiles);
+
+        /**
+         * @brief Find a resident chunk, nullptr when it has never held a tile or is not streamed in.
+         */
+        const TilemapChunk* FindChunk(int chunkX, int chunkY) const;
+
+        /**
+         * @brief Cover the non-empty tiles of a chunk with as few rectangles as a greedy pass finds.
+         *
+         * Each rectangle grows right along its row as far as tiles are solid,
+         * then down while every tile of the next row's span is; rectangles never overlap.
          */
-        void RebuildDirtyChunks();
+        void BuildCollisionRects(const TilemapChunk& chunk, std::vector<TileRect>& outRects) const;
 
         /**
-         * @brief Access the internal chunk array.
+         * @brief Rebuild the meshes of chunks marked as dirty.
          *
-         * @return Const reference to the vector of TilemapChunk.
+         * Chunks are meshed in parallel on the JobSystem, then only the tile
+         * range that changed is uploaded. Every chunk shares one static quad
+         * index buffer; empty tiles are degenerate quads.
+         *
+         * @param maxChunks Chunks to rebuild this call, 0 for all. The rest stay dirty.
+         */
+        void RebuildDirtyChunks(uint32_t maxChunks = 0);
+
+        /**
+         * @brief Stream chunks from a chunk file instead of keeping the whole map resident.
+         *
+         * @return false when the store uses a different chunk size.
          */
-        inline const std::vector<TilemapChunk>& GetChunks() const { return m_Chunks; }
+        bool SetStreamSource(std::shared_ptr<TilemapChunkStore> store);
+
+        inline bool IsStreaming() const { return m_Stream != nullptr; }
+
+        /**
+         * @brief Load chunks around a point and evict the ones left behind.
+         *
+         * Loads run on the JobSystem when it is available and become resident
+         * on a later call; nearest chunks are requested first. Streamed chunks
+         * that were edited are never evicted.
+         *
+         * @param focusTile Point in tile coordinates, usually the camera.
+         * @param radius Chunks to keep resident on each side of the focus chunk.
+         */
+        void UpdateStreaming(const glm::vec2& focusTile, int radius);
+
+        TilemapStreamingStats GetStreamingStats() const;
+
+        /**
+         * @brief Upload tiles changed since the last call to the lookup textures.
+         *
+         * Used by the tile lookup render mode: every non-empty chunk owns a
+         * chunkSize x chunkSize slot in one R32I tile index texture, and is drawn
+         * as a single quad whose fragment shader resolves the tile's atlas rect
+         * through the frame table. Changing a tile uploads one texel.
+         */
+        void UpdateLookupTextures();
+
+        inline const std::shared_ptr<Texture2D>& GetTileIndexTexture() const { return m_Lookup.TileIndices; }
+        inline const std::shared_ptr<Texture2D>& GetFrameTableTexture() const { return m_Lookup.FrameTable; }
+
+        TilemapStats GetStats() const;
+
+        /**
+         * @brief Access the resident chunks, keyed by MakeTilemapChunkKey.
+         */
+        inline const ChunkMap& GetChunks() const { return m_Chunks; }
+
+        /**
+         * @brief Changes whenever a chunk is added, removed or has its tiles changed.
+         */
+        inline uint64_t GetRevision() const { return m_Revision; }
 
 
         /**
@@ -144,8 +288,76 @@ namespace Boon
          */
         inline int GetChunksY() const { return m_ChunksY; }
 
+        /** Frame table texels per row; frame id N lives at (N % width, N / width). */
+        static constexpr uint32_t FrameTableWidth = 256;
+
     private:
-        void BuildChunk(TilemapChunk& chunk);
+        struct LookupState
+        {
+            std::shared_ptr<Texture2D> TileIndices;
+            std::shared_ptr<Texture2D> FrameTable;
+            std::shared_ptr<IndexBuffer> QuadIndices;
+
+            int SlotsPerRow = 0;
+            int NextSlot = 0;
+            std::vector<int> FreeSlots;
+
+            struct DirtyTile
+            {
+                uint64_t Chunk;
+                uint32_t Local;
+            };
+            std::vector<DirtyTile> DirtyTiles;
+
+            const SpriteAtlas* FrameTableAtlas = nullptr;
+            uint32_t FrameTableVersion = 0;
+
+            float QuadUnitSize = 0.0f;
+        };
+
+        struct MeshBuffers
+        {
+            std::shared_ptr<Boon::VertexInput> Input;
+            std::shared_ptr<Boon::VertexBuffer> Vertices;
+        };
+
+        struct MeshState
+        {
+            std::shared_ptr<IndexBuffer> QuadIndices;   // chunkSize^2 quads, shared by every chunk
+
+            const SpriteAtlas* Atlas = nullptr;
+            uint32_t AtlasVersion = 0;
+            float UnitSize = 0.0f;
+
+            // Reused across rebuilds
+            std::vector<TilemapChunk*> Queue;
+            std::vector<std::vector<TileVertex>> Scratch;
+        };
+
+        struct StreamState;
+
+        static constexpr size_t MaxDirtyTiles = 256;
+        static constexpr size_t MaxPooledMeshBuffers = 64;
+        static constexpr int StreamEvictionMargin = 1;     // Chunks past the radius before a chunk is evicted
+        static constexpr size_t MaxPendingLoads = 32;
+
+        TilemapChunk* FindChunk(int chunkX, int chunkY);
+        TilemapChunk& GetOrCreateChunk(int chunkX, int chunkY);
+        void ReleaseChunk(TilemapChunk& chunk);
+
+        void MarkMeshDirty(TilemapChunk& chunk, uint32_t begin, uint32_t end);
+        void SyncMeshState(const SpriteAtlas& atlas);
+        void MeshTiles(const TilemapChunk& chunk, const SpriteAtlas& atlas, std::vector<TileVertex>& out) const;
+        void AllocateChunkBuffers(TilemapChunk& chunk);
+        void ReleaseChunkBuffers(TilemapChunk& chunk);
+
+        void SetTileInChunk(int chunkX, int chunkY, int local, int tileId);
+        void OnTileChanged(TilemapChunk& chunk, uint64_t key, int local, int oldTileId, int newTileId);
+        void ApplyLoadedChunks(const glm::ivec2& focusChunk, int keepRadius);
+        void ResetLookup();
+        bool EnsureLookupCapacity(int requiredSlots);
+        void BuildLookupQuad(TilemapChunk& chunk);
+        void UpdateFrameTable(const SpriteAtlas& atlas);
 
     private:
         float m_UnitSize = 0.5f;
@@ -158,8 +370,16 @@ namespace Boon
 
         bool m_IsDirty = true;
 
-        std::vector<TilemapChunk> m_Chunks;
+        ChunkMap m_Chunks;
+        uint64_t m_Revision = 0;
+        std::vector<MeshBuffers> m_MeshPool;
+        MeshState m_Mesh;
 
         AssetRef<SpriteAtlasAsset> m_Atlas;
+
+        LookupState m_Lookup;
+        uint64_t m_UploadedBytes = 0;
+
+        std::shared_ptr<StreamState> m_Stream;
     };
 }
\ No newline at end of file
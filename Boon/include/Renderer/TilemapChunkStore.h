@@ -0,0 +1,150 @@
+#pragma once
+#include "Core/Memory/Buffer.h"
+
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace Boon
+{
+    class Tilemap;
+
+    /**
+     * @brief Pack signed chunk coordinates into a single hash map key.
+     */
+    inline uint64_t MakeTilemapChunkKey(int chunkX, int chunkY)
+    {
+        return static_cast<uint64_t>(static_cast<uint32_t>(chunkX)) |
+            (static_cast<uint64_t>(static_cast<uint32_t>(chunkY)) << 32);
+    }
+
+    /**
+     * @brief Read side of the chunked on-disk tilemap format.
+     *
+     * Chunks are grouped into regions of RegionSize x RegionSize chunks. The
+     * file ends with a table of the regions that hold at least one chunk; each
+     * region has a fixed block of offsets into the compressed chunk payloads.
+     * Opening a file only reads the region table, region blocks are read on
+     * first use, so a map of any size costs memory proportional to what is
+     * streamed in. Chunks that are entirely empty are not stored.
+     */
+    class TilemapChunkStore final
+    {
+    public:
+        static constexpr uint32_t Magic = 0x434D5442; // 'BTMC'
+        static constexpr uint32_t Version = 1;
+        static constexpr int RegionSize = 32;
+
+        /**
+         * @brief Open a chunk file. Returns nullptr when it is missing or malformed.
+         */
+        static std::shared_ptr<TilemapChunkStore> Open(const std::filesystem::path& path);
+
+        /**
+         * @brief Write every chunk of a tilemap that holds at least one tile.
+         */
+        static bool Save(const std::filesystem::path& path, const Tilemap& tilemap);
+
+        inline int GetChunkSize() const { return m_ChunkSize; }
+
+        /**
+         * @brief Read and decompress one chunk. Safe to call from any thread.
+         *
+         * @param outTiles Resized to chunkSize * chunkSize on success.
+         * @return false when the file has no chunk at these coordinates.
+         */
+        bool ReadChunk(int chunkX, int chunkY, std::vector<int>& outTiles);
+
+        /**
+         * @brief Compressed bytes read from disk since the file was opened.
+         */
+        uint64_t GetBytesRead() const;
+
+        static void EncodeTiles(const int* tiles, size_t count, Buffer& out);
+        static bool DecodeTiles(const uint8_t* data, size_t size, int* outTiles, size_t count);
+
+    private:
+        friend class TilemapChunkStoreWriter;
+
+        struct FileHeader
+        {
+            uint32_t Magic;
+            uint32_t Version;
+            int32_t ChunkSize;
+            int32_t RegionSize;
+            uint32_t RegionCount;
+            uint32_t Reserved;
+            uint64_t RegionTableOffset;
+        };
+
+        struct RegionTableEntry
+        {
+            int32_t RegionX;
+            int32_t RegionY;
+            uint64_t BlockOffset;
+        };
+
+        // Size 0 marks a chunk that is not stored
+        struct ChunkEntry
+        {
+            uint64_t Offset;
+            uint32_t Size;
+            uint32_t Reserved;
+        };
+
+        static constexpr size_t MaxCachedRegions = 64;
+
+        const ChunkEntry* FindChunkEntry(int chunkX, int chunkY);
+
+        std::mutex m_Mutex;
+        std::ifstream m_File;
+        uint64_t m_FileSize = 0;
+        int m_ChunkSize = 0;
+
+        std::unordered_map<uint64_t, uint64_t> m_RegionOffsets;
+        std::unordered_map<uint64_t, std::vector<ChunkEntry>> m_RegionCache;
+
+        std::atomic<uint64_t> m_BytesRead{ 0 };
+    };
+
+    /**
+     * @brief Write side of the chunked tilemap format.
+     *
+     * Chunk payloads are written as they are added, so a generator can emit
+     * maps far larger than memory. The region blocks and table are written by
+     * Finish, which also moves the file into place.
+     */
+    class TilemapChunkStoreWriter final
+    {
+    public:
+        TilemapChunkStoreWriter(const std::filesystem::path& path, int chunkSize);
+        ~TilemapChunkStoreWriter();
+
+        TilemapChunkStoreWriter(const TilemapChunkStoreWriter&) = delete;
+        TilemapChunkStoreWriter& operator=(const TilemapChunkStoreWriter&) = delete;
+
+        /**
+         * @brief Add a chunk of chunkSize * chunkSize tile ids. Empty chunks are skipped.
+         */
+        bool AddChunk(int chunkX, int chunkY, const int* tiles);
+
+        bool Finish();
+
+    private:
+        std::filesystem::path m_Path;
+        std::filesystem::path m_TempPath;
+        std::ofstream m_File;
+        uint64_t m_Offset = 0;
+        int m_ChunkSize = 0;
+        bool m_Finished = false;
+        bool m_Failed = false;
+
+        std::unordered_map<uint64_t, std::vector<TilemapChunkStore::ChunkEntry>> m_Regions;
+        Buffer m_Scratch;
+    };
+}
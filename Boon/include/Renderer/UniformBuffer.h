@@ -28,6 +28,15 @@ namespace Boon
 		 */
 		virtual void SetData(const void* data, size_t size, uint32_t offset = 0) = 0;
 
+		/**
+		 * @brief Bind a sub-range of the buffer to a uniform binding point.
+		 *
+		 * @param binding Binding index for shader access.
+		 * @param offset Byte offset, must be a multiple of GetOffsetAlignment().
+		 * @param size Number of bytes visible to the shader.
+		 */
+		virtual void BindRange(uint32_t binding, uint32_t offset, size_t size) = 0;
+
 		template <typename T>
 		void SetValue(const T& data, uint32_t offset = 0)
 		{
@@ -43,6 +52,11 @@ namespace Boon
 		 */
 		static std::shared_ptr<UniformBuffer> Create(size_t size, uint32_t binding);
 
+		/**
+		 * @brief Required alignment for BindRange offsets on the active API.
+		 */
+		static uint32_t GetOffsetAlignment();
+
 		template <typename T>
 		static std::shared_ptr<UniformBuffer> Create(uint32_t binding)
 		{
@@ -38,6 +38,15 @@ namespace Boon
 		 */
 		virtual void SetData(const void* data, uint32_t size) = 0;
 
+		/**
+		 * @brief Upload data into part of the buffer.
+		 *
+		 * @param data Pointer to source data.
+		 * @param size Size in bytes of the data.
+		 * @param offset Byte offset into the buffer.
+		 */
+		virtual void SetSubData(const void* data, uint32_t size, uint32_t offset) = 0;
+
 		/**
 		 * @brief Get the current vertex buffer layout.
 		 *
@@ -13,6 +13,7 @@ namespace Boon
 		float TilingFactor{};
 
 		int GameObjectID{};
+		int MaterialSlot{};	// First vec4 of the material block in the bound uniform page
 	};
 
 	struct LineVertex
@@ -28,4 +29,11 @@ namespace Boon
 		glm::vec4 Color;
 		glm::vec2 TexCoord;
 	};
+
+	struct TileLookupVertex
+	{
+		glm::vec3 Position;
+		glm::vec2 TileCoord;	// Chunk-local, in tiles
+		glm::vec3 Slot;			// Origin of the chunk's slot in the tile index texture, chunk size
+	};
 }
\ No newline at end of file
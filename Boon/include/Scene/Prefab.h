@@ -1,26 +1,76 @@
+#pragma once
 #include <Core/Memory/Buffer.h>
 #include "Reflection/BClass.h"
 #include "Scene/GameObject.h"
 
-#include <unordered_map>
+#include <cstdint>
+#include <vector>
 
 namespace Boon
 {
+	/**
+	 * @brief Pre-baked template of a game object hierarchy.
+	 *
+	 * Every node keeps one ready made instance per component class, so
+	 * Scene::Instantiate can copy it straight into the component pools for a
+	 * whole batch of objects. Nodes are stored parents first, node 0 is the root.
+	 */
 	class Prefab final
 	{
 	public:
+		Prefab() = default;
+		~Prefab();
+
+		Prefab(const Prefab&) = delete;
+		Prefab& operator=(const Prefab&) = delete;
+
+		/**
+		 * @brief Bake root and its children into the template, replacing what was there.
+		 *
+		 * Component values are copied as they are, so capture from a scene that
+		 * is not playing. References to other game objects are cleared.
+		 */
+		void Capture(GameObject root);
+
+		/**
+		 * @brief Copy the root node's components onto an existing game object.
+		 */
 		void ApplyTo(GameObject obj);
 
+		void Serialize(Buffer& out) const;
+
+		/**
+		 * @brief Rebuild the template from Serialize output.
+		 *
+		 * Unknown classes and properties that changed type are skipped.
+		 *
+		 * @return false if the data is truncated, the template is left empty.
+		 */
+		bool Deserialize(const Buffer& in);
+
+		inline size_t GetNodeCount() const { return m_Nodes.size(); }
+		inline bool IsEmpty() const { return m_Nodes.empty(); }
+
 	private:
+		struct PrefabComponent
+		{
+			BClass* Class = nullptr;
+			void* Instance = nullptr;
+		};
+
 		struct PrefabNode
 		{
-			std::unordered_map<BClass*, Buffer> Components;
-			std::vector<PrefabNode> Children;
-			GameObjectID Id{};
+			std::vector<PrefabComponent> Components;
+			int32_t Parent = -1;
 		};
 
+		void CaptureNode(GameObject obj, int32_t parent);
+		void* AddInstance(PrefabNode& node, BClass* cls);
 		void ResolveNode(PrefabNode& node);
+		void Clear();
+
+		std::vector<PrefabNode> m_Nodes;
 
-		PrefabNode m_Root{};
+		friend class Scene;
 	};
-}
\ No newline at end of file
+}
@@ -9,8 +9,10 @@
 #include <queue>
 #include <glm/glm.hpp>
 #include <unordered_map>
+#include <vector>
 #include <functional>
 #include <memory>
+#include <span>
 #include <string>
 
 namespace Boon
@@ -23,6 +25,20 @@ namespace Boon
 	struct BClass;
 	struct ECSLifecycleSystem;
 	class GameObject;
+	class Prefab;
+
+	/**
+	 * @brief Running totals of the objects a scene spawned from prefabs.
+	 */
+	struct PrefabSpawnStats
+	{
+		uint64_t Batches = 0;
+		uint64_t Objects = 0;
+		double Milliseconds = 0.0;
+
+		inline double GetObjectsPerMillisecond() const { return Milliseconds > 0.0 ? Objects / Milliseconds : 0.0; }
+	};
+
 	class Scene final
 	{
 	public:
@@ -54,6 +70,70 @@ namespace Boon
 		 */
 		GameObject Instantiate(UUID uuid, const glm::vec3& pos = {});
 
+		/**
+		 * @brief Spawn count copies of a prefab in one batch.
+		 *
+		 * All objects are created in one go and every component of the template
+		 * is copied into its pool with a single insert for the whole batch.
+		 * Components are awoken once the batch is complete, and the batch is
+		 * reported once through GetOnGameObjectsSpawned instead of per object
+		 * and per component.
+		 *
+		 * @param prefab Template to copy.
+		 * @param count Number of copies.
+		 * @return The root of every copy, in spawn order.
+		 */
+		std::vector<GameObjectID> Instantiate(const Prefab& prefab, size_t count = 1);
+
+		/**
+		 * @brief Pre-allocate registry and lookup capacity for bulk instantiation.
+		 *
+		 * Reserves room for the entities and the components every GameObject
+		 * gets on Instantiate, so spawning many objects in one go does not
+		 * repeatedly grow the underlying storage.
+		 *
+		 * @param count Number of additional game objects expected.
+		 */
+		void ReserveGameObjects(size_t count);
+
+		/**
+		 * @brief Add a default constructed T to many game objects in one storage insert.
+		 *
+		 * Objects that already have a T keep theirs. Added components are awoken
+		 * and reported like AddComponent does, one object at a time.
+		 *
+		 * @param pObjects Game objects to add the component to.
+		 * @param count Number of entries in pObjects.
+		 */
+		template <typename T>
+		void AddComponents(const GameObjectID* pObjects, size_t count);
+
+		/**
+		 * @brief Copy every T of another scene onto the same game objects here.
+		 *
+		 * Walks the source pool once and inserts it into a storage reserved up
+		 * front, so the copy is a straight run over packed memory. The objects
+		 * must already exist in this scene and not have a T yet. Copied
+		 * components are awoken and reported like AddComponent does.
+		 *
+		 * @param from Scene whose components are copied.
+		 */
+		template <typename T>
+		void CopyComponents(Scene& from);
+
+		/**
+		 * @brief Add a copy of value to many game objects in one storage insert.
+		 *
+		 * Used by batched spawning; nothing is awoken or reported, the caller
+		 * does that once the batch is complete. The objects must not have a T yet.
+		 *
+		 * @param pObjects Game objects to add the component to.
+		 * @param count Number of entries in pObjects.
+		 * @param value Component copied to every object.
+		 */
+		template <typename T>
+		void InsertComponents(const GameObjectID* pObjects, size_t count, const T& value);
+
 		/**
 		 * @brief Transition the scene into the "awake" state.
 		 *
@@ -89,7 +169,27 @@ namespace Boon
 		 * @param result Output parameter populated with hit information if a hit occurs.
 		 * @return true if the ray hit something and `result` was populated, false otherwise.
 		 */
-		bool Raycast2D(const Ray2D& ray, HitResult2D& result) const;
+		bool Raycast2D(const Ray2D& ray, HitResult2D& result, const QueryFilter2D& filter = {}) const;
+
+		/**
+		 * @brief Cast many rays in parallel into caller-provided buffers.
+		 *
+		 * See PhysicsWorld2D::RaycastBatch for the buffer layout.
+		 */
+		void RaycastBatch2D(std::span<const Ray2D> rays, std::span<HitResult2D> hits, std::span<uint32_t> hitCounts,
+			uint32_t maxHitsPerRay = 1, const QueryFilter2D& filter = {}) const;
+
+		/**
+		 * @brief Sweep many boxes or circles in parallel into caller-provided buffers.
+		 */
+		void ShapeCastBatch2D(std::span<const ShapeCast2D> casts, std::span<HitResult2D> hits, std::span<uint32_t> hitCounts,
+			uint32_t maxHitsPerCast = 1, const QueryFilter2D& filter = {}) const;
+
+		/**
+		 * @brief Find the game objects overlapping many boxes in parallel into caller-provided buffers.
+		 */
+		void OverlapBatch2D(std::span<const AABB2D> boxes, std::span<GameObjectID> hits, std::span<uint32_t> hitCounts,
+			uint32_t maxHitsPerBox, const QueryFilter2D& filter = {}) const;
 
 		/**
 		 * @brief Retrieve a game object by UUID.
@@ -153,6 +253,16 @@ namespace Boon
 		 */
 		inline Delegate<void(GameObject)>& GetOnGameObjectSpawned() { return m_OnGameObjectSpawned; }
 
+		/**
+		 * @brief Get delegate invoked once per batch spawned from a prefab.
+		 *
+		 * Receives every object of the batch, children included. Objects spawned
+		 * this way do not go through GetOnGameObjectSpawned or GetOnComponentAdded.
+		 *
+		 * @return Reference to the batch spawn delegate.
+		 */
+		inline Delegate<void(std::span<const GameObjectID>)>& GetOnGameObjectsSpawned() { return m_OnGameObjectsSpawned; }
+
 		/**
 		 * @brief Get delegate invoked when a GameObject is destroyed.
 		 *
@@ -188,6 +298,8 @@ namespace Boon
 		 */
 		inline bool IsRunning() const { return m_Running; }
 
+		inline const PrefabSpawnStats& GetPrefabSpawnStats() const { return m_PrefabSpawnStats; }
+
 		inline bool IsLoaded() const 
 		{
 			if (m_fnIsLoaded)
@@ -229,6 +341,7 @@ namespace Boon
 		std::queue<UUID> m_ObjectsPendingDestroy{};
 
 		Delegate<void(GameObject)> m_OnGameObjectSpawned;
+		Delegate<void(std::span<const GameObjectID>)> m_OnGameObjectsSpawned;
 		Delegate<void(GameObject)> m_OnGameObjectDestroyed;
 		Delegate<void(GameObject, const BClass*)> m_OnComponentAdded;
 		Delegate<void(GameObject, const BClass*)> m_OnComponentRemoved;
@@ -256,6 +369,8 @@ namespace Boon
 		std::string m_Name;
 		bool m_Running{ false };
 		EngineContext* m_pContext;
+
+		PrefabSpawnStats m_PrefabSpawnStats{};
 	};
 
 	template <typename T, typename ... TArgs>
@@ -277,4 +392,75 @@ namespace Boon
 
 		return comp;
 	}
+
+	template <typename T>
+	void Scene::AddComponents(const GameObjectID* pObjects, size_t count)
+	{
+		auto& storage = m_Registry.storage<T>();
+		storage.reserve(storage.size() + count);
+
+		std::vector<GameObjectID> added;
+		added.reserve(count);
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			if (!storage.contains(pObjects[i]))
+				added.push_back(pObjects[i]);
+		}
+
+		m_Registry.insert<T>(added.begin(), added.end());
+
+		const BClass* cls = BClassRegistry::Get().Find<T>();
+		if (!cls)
+			return;
+
+		for (GameObjectID handle : added)
+		{
+			GameObject obj{ handle, this };
+			if (m_Running && cls->awake)
+				cls->awake(obj);
+
+			m_OnComponentAdded.Invoke(obj, cls);
+		}
+	}
+
+	template <typename T>
+	void Scene::CopyComponents(Scene& from)
+	{
+		auto& source = from.m_Registry.template storage<T>();
+		if (source.empty())
+			return;
+
+		auto& storage = m_Registry.storage<T>();
+		storage.reserve(storage.size() + source.size());
+
+		// Entities and values of a storage iterate in the same packed order
+		const entt::sparse_set& objects = source;
+		if constexpr (std::is_empty_v<T>)
+			m_Registry.insert<T>(objects.begin(), objects.end());
+		else
+			m_Registry.insert<T>(objects.begin(), objects.end(), source.begin());
+
+		const BClass* cls = BClassRegistry::Get().Find<T>();
+		if (!cls)
+			return;
+
+		for (GameObjectID handle : objects)
+		{
+			GameObject obj{ handle, this };
+			if (m_Running && cls->awake)
+				cls->awake(obj);
+
+			m_OnComponentAdded.Invoke(obj, cls);
+		}
+	}
+
+	template <typename T>
+	void Scene::InsertComponents(const GameObjectID* pObjects, size_t count, const T& value)
+	{
+		auto& storage = m_Registry.storage<T>();
+		storage.reserve(storage.size() + count);
+
+		m_Registry.insert<T>(pObjects, pObjects + count, value);
+	}
 }
@@ -19,8 +19,22 @@ namespace Boon
 		 */
 		void Serialize(const std::filesystem::path& dst);
 
+		/**
+		 * @brief Serialize the scene to the destination path in the binary format.
+		 *
+		 * Components are stored column-wise per reflected class: the objects
+		 * carrying the class, then each property packed for all of them. Loads
+		 * much faster and is smaller than JSON, which stays the editable format.
+		 *
+		 * @param dst Destination file path to write the scene representation.
+		 */
+		void SerializeBinary(const std::filesystem::path& dst);
+
 		/**
 		 * @brief Deserialize scene data from the provided source path.
+		 *
+		 * Binary and JSON scenes are told apart by the file header.
+		 *
 		 * @param src Source file path to read scene data from.
 		 */
 		void Deserialize(const std::filesystem::path& src);
@@ -37,6 +51,9 @@ namespace Boon
 		void Copy(Scene& from);
 
 	private:
+		void DeserializeJson(const std::filesystem::path& src);
+		bool DeserializeBinary(const std::filesystem::path& src);
+
 		Scene& m_Context;
 	};
 }
\ No newline at end of file
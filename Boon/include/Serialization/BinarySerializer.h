@@ -3,6 +3,7 @@
 #include <string>
 #include <cassert>
 #include <cstring>
+#include <utility>
 
 namespace Boon
 {
@@ -31,6 +32,13 @@ namespace Boon
         {
         }
 
+        BinarySerializer(Buffer&& buffer)
+            : m_Mode(Mode::Reading),
+            m_Buffer(std::move(buffer)),
+            m_ReadBitPos(0)
+        {
+        }
+
         // =====================================================
         //                   BITPACK WRITING
         // =====================================================
@@ -124,6 +132,15 @@ namespace Boon
             m_ReadBitPos += size * 8;
         }
 
+        inline void SkipBytes(size_t size)
+        {
+            EnsureReading();
+            AlignRead();
+
+            assert((m_ReadBitPos >> 3) + size <= m_Buffer.Size());
+            m_ReadBitPos += size * 8;
+        }
+
         template<typename T>
         inline T Read()
         {
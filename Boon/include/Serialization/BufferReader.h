@@ -0,0 +1,119 @@
+#pragma once
+#include "Core/Memory/Buffer.h"
+#include <string>
+#include <cstring>
+#include <type_traits>
+
+namespace Boon
+{
+    /**
+     * @brief Bounds checked cursor over a byte range.
+     *
+     * Meant for data that comes from disk or the network. A read past the
+     * end marks the reader failed and returns a default value instead of
+     * touching memory outside the range; every later read fails as well.
+     * Does not own the underlying memory.
+     */
+    class BufferReader
+    {
+    public:
+        BufferReader() = default;
+
+        BufferReader(const uint8_t* data, size_t size)
+            : m_Data(data), m_Size(size)
+        {
+        }
+
+        explicit BufferReader(const Buffer& buffer)
+            : m_Data(buffer.Data()), m_Size(buffer.Size())
+        {
+        }
+
+        /**
+         * @brief Check that size bytes remain; marks the reader failed if not.
+         */
+        bool Has(size_t size)
+        {
+            if (m_Failed || size > m_Size - m_Offset)
+                m_Failed = true;
+            return !m_Failed;
+        }
+
+        /**
+         * @brief Consume size bytes and return a pointer to them, nullptr on a short read.
+         */
+        const uint8_t* Take(size_t size)
+        {
+            if (!Has(size))
+                return nullptr;
+
+            const uint8_t* ptr = m_Data + m_Offset;
+            m_Offset += size;
+            return ptr;
+        }
+
+        bool Skip(size_t size)
+        {
+            if (!Has(size))
+                return false;
+
+            m_Offset += size;
+            return true;
+        }
+
+        template<typename T>
+        T Read()
+        {
+            static_assert(std::is_trivially_copyable_v<T>,
+                "BufferReader::Read requires trivially copyable type");
+
+            T value{};
+            if (const uint8_t* ptr = Take(sizeof(T)))
+                std::memcpy(&value, ptr, sizeof(T));
+            return value;
+        }
+
+        template<typename T>
+        bool Read(T& out)
+        {
+            out = Read<T>();
+            return !m_Failed;
+        }
+
+        std::string ReadString()
+        {
+            const uint32_t length = Read<uint32_t>();
+            const uint8_t* ptr = Take(length);
+            return ptr ? std::string(reinterpret_cast<const char*>(ptr), length) : std::string();
+        }
+
+        bool ReadString(std::string& out)
+        {
+            out = ReadString();
+            return !m_Failed;
+        }
+
+        /**
+         * @brief Move the cursor to an absolute offset; an offset past the end fails the reader.
+         */
+        void Seek(size_t offset)
+        {
+            if (offset > m_Size)
+                m_Failed = true;
+            else
+                m_Offset = offset;
+        }
+
+        const uint8_t* Data() const { return m_Data; }
+        size_t Size() const { return m_Size; }
+        size_t GetOffset() const { return m_Offset; }
+        size_t GetRemaining() const { return m_Size - m_Offset; }
+        bool Failed() const { return m_Failed; }
+
+    private:
+        const uint8_t* m_Data = nullptr;
+        size_t m_Size = 0;
+        size_t m_Offset = 0;
+        bool m_Failed = false;
+    };
+}
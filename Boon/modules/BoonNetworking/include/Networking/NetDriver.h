@@ -145,6 +145,11 @@ namespace Boon
 
         virtual EventBus& GetEventBus() = 0;
 
+        /**
+         * @brief Settings the driver was initialized with.
+         */
+        virtual const NetworkSettings& GetSettings() const = 0;
+
         virtual bool IsStandalone() const = 0;
         virtual bool IsClient() const = 0;
         virtual bool IsServer() const = 0;
@@ -18,6 +18,8 @@ namespace Boon
         Component,
         LoadScene,
         InitScene,
+        SceneSnapshot,
+        SpawnBatch,
 
         // Data Flow
         Replication,
@@ -2,8 +2,10 @@
 #include "Core/Variant.h"
 #include "NetPacket.h"
 #include "Core/UUID.h"
+#include "Networking/NetRPCArgs.h"
 #include <vector>
 #include <string>
+#include <type_traits>
 
 namespace Boon
 {
@@ -30,13 +32,73 @@ namespace Boon
 		 */
 		void CallClient(uint64_t clientId, uint32_t classId, uint32_t fnId, const UUID& uuid, const std::vector<Variant>& args);
 
+		// Generated stub typed RPC calls
+		/**
+		 * @brief Issue a typed RPC from client to server.
+		 *
+		 * Arguments are serialized straight into the packet through the
+		 * function's generated send stub, converted to the declared parameter
+		 * types the way a direct call would. Arguments that do not convert are
+		 * rejected and logged. Falls back to the Variant path when the function
+		 * has no stubs.
+		 */
+		template<typename... Args>
+		void CallServer(uint32_t classId, uint32_t fnId, const UUID& uuid, const Args&... args)
+		{
+			const NetRPCArgRef argRefs[] = { MakeNetRPCArgRef(args)..., NetRPCArgRef{ nullptr, typeid(void) } };
+
+			NetPacket pkt(ENetPacketType::RPC);
+			const TypedCallResult result = WriteTypedCall(pkt, classId, fnId, uuid, true, argRefs, sizeof...(Args));
+			if (result == TypedCallResult::Written)
+				SendToServer(pkt);
+			if (result != TypedCallResult::NoStubs)
+				return;
+
+			if constexpr ((std::is_constructible_v<Variant, const Args&> && ...))
+				CallServer(classId, fnId, uuid, std::vector<Variant>{ Variant(args)... });
+		}
+
+		/**
+		 * @brief Issue a typed RPC from server to a particular client.
+		 *
+		 * @see CallServer(uint32_t, uint32_t, const UUID&, const Args&...)
+		 */
+		template<typename... Args>
+		void CallClient(uint64_t clientId, uint32_t classId, uint32_t fnId, const UUID& uuid, const Args&... args)
+		{
+			const NetRPCArgRef argRefs[] = { MakeNetRPCArgRef(args)..., NetRPCArgRef{ nullptr, typeid(void) } };
+
+			NetPacket pkt(ENetPacketType::RPC);
+			const TypedCallResult result = WriteTypedCall(pkt, classId, fnId, uuid, false, argRefs, sizeof...(Args));
+			if (result == TypedCallResult::Written)
+				SendToClient(clientId, pkt);
+			if (result != TypedCallResult::NoStubs)
+				return;
+
+			if constexpr ((std::is_constructible_v<Variant, const Args&> && ...))
+				CallClient(clientId, classId, fnId, uuid, std::vector<Variant>{ Variant(args)... });
+		}
+
 		/**
 		 * @brief Process an incoming RPC packet.
 		 *
 		 * @param pkt Packet containing RPC data.
 		 * @param isServerSide true when processing on the server side.
 		 */
-		void Process(const NetPacket& pkt, bool isServerSide);
+		void Process(NetPacket& pkt, bool isServerSide);
+
+	private:
+		enum class TypedCallResult
+		{
+			Written,
+			NoStubs,
+			ArgumentMismatch
+		};
+
+		TypedCallResult WriteTypedCall(NetPacket& pkt, uint32_t classId, uint32_t fnId, const UUID& uuid,
+			bool toServer, const NetRPCArgRef* args, size_t argCount);
+		void SendToServer(NetPacket& pkt);
+		void SendToClient(uint64_t clientId, NetPacket& pkt);
 
 	private:
 		NetScene* m_Scene;
@@ -8,6 +8,10 @@
 #include "Event/Event.h"
 
 #include <memory>
+#include <mutex>
+#include <span>
+#include <vector>
+#include <chrono>
 
 namespace Boon
 {
@@ -17,6 +21,7 @@ namespace Boon
     class NetRepCore;
     class NetRPC;
     class SceneManager;
+    class BufferReader;
 
     class NetScene
     {
@@ -128,6 +133,8 @@ namespace Boon
         void HandleComponentPacket(NetConnection* sender, NetPacket& pkt);
         void HandleLoadScenePacket(NetConnection* sender, NetPacket& pkt);
         void HandleClientSceneInitPacket(NetConnection* sender, NetPacket& pkt);
+        void HandleSceneSnapshotPacket(NetConnection* sender, NetPacket& pkt);
+        void HandleSpawnBatchPacket(NetConnection* sender, NetPacket& pkt);
 
         void SendSpawnTo(NetConnection* conn, const GameObject& obj);
         void SendDespawnTo(NetConnection* conn, const UUID& uuid);
@@ -136,9 +143,18 @@ namespace Boon
         void BroadcastDespawn(const UUID& uuid);
         void BroadcastComponent(const UUID& uuid, const BClassID& component, bool add);
         void BroadcastLoadScene(const SceneID& sceneId);
+        void BroadcastSpawnBatch(std::span<const GameObjectID> objects);
+
+        void InitDynamicIdentity(GameObject gameObject, uint64_t ownerConnection);
 
         void InitClientScene(NetConnection* conn);
 
+        // Join-in-progress snapshot
+        void WriteSnapshotObject(BinarySerializer& ser, GameObject obj, uint64_t owner, bool dynamic,
+            const std::vector<const BClass*>& classes);
+        void ReadSnapshotObject(BufferReader& in);
+        void ApplySceneSnapshot();
+
     private:
         Scene* m_Scene = nullptr;
         SceneManager* m_pSceneManager = nullptr;
@@ -150,10 +166,29 @@ namespace Boon
         std::unordered_map<UUID, uint64_t> m_DynamicOwnership;
         bool m_bRegisterDynamicObject{ true };
 
+        // Client: snapshot chunks received so far, applied once all arrived
+        struct PendingSnapshot
+        {
+            uint32_t Id = 0;
+            uint32_t ObjectCount = 0;
+            uint16_t ChunksReceived = 0;
+            std::vector<Buffer> Chunks;
+            std::vector<uint32_t> ChunkObjectCounts;
+            std::chrono::steady_clock::time_point FirstChunkTime;
+        };
+        PendingSnapshot m_PendingSnapshot;
+        uint32_t m_NextSnapshotId = 1;
+
+        // Server: connections waiting for their snapshot. Filled from the event bus,
+        // drained on the game thread so the scene is never read while it is updated
+        std::mutex m_PendingJoinsMutex;
+        std::vector<uint64_t> m_PendingJoins;
+
         EventListenerID m_ClientConnectedEvent;
         Delegate<void(GameObject)>::Handle m_OnObjectSpawnedHandle;
+        Delegate<void(std::span<const GameObjectID>)>::Handle m_OnObjectsSpawnedHandle;
         Delegate<void(GameObject)>::Handle m_OnObjectDestroyedHandle;
-        Delegate<void(GameObject)>::Handle m_OnComponentAddedHandle;
-        Delegate<void(GameObject)>::Handle m_OnComponentRemovedHandle;
+        Delegate<void(GameObject, const BClass*)>::Handle m_OnComponentAddedHandle;
+        Delegate<void(GameObject, const BClass*)>::Handle m_OnComponentRemovedHandle;
     };
 }
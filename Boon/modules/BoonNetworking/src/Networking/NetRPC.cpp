@@ -4,6 +4,7 @@
 #include "Networking/NetRepRegistry.h"
 #include "Reflection/BFunction.h"
 #include "Reflection/BClass.h"
+#include "BoonDebug/Logger.h"
 
 namespace Boon
 {
@@ -54,6 +55,32 @@ namespace Boon
         }
     }
 
+    // ============================================
+    // Check the Variant path's arguments fit in the packet
+    // ============================================
+    static bool ParamsFit(const BinarySerializer& ser, const BFunction& fn, uint32_t argCount)
+    {
+        BufferReader in = NetRPCDetail::UnreadBytes(ser);
+        for (uint32_t i = 0; i < argCount && !in.Failed(); ++i)
+        {
+            switch (fn.params[i].typeId)
+            {
+            case BTypeId::Int:      in.Skip(sizeof(int)); break;
+            case BTypeId::Float:    in.Skip(sizeof(float)); break;
+            case BTypeId::Bool:     in.Skip(sizeof(bool)); break;
+            case BTypeId::String:   in.Skip(in.Read<uint32_t>()); break;
+            case BTypeId::Int64:    in.Skip(sizeof(int64_t)); break;
+
+            case BTypeId::Float2:   in.Skip(sizeof(glm::vec2)); break;
+            case BTypeId::Float3:   in.Skip(sizeof(glm::vec3)); break;
+            case BTypeId::Float4:   in.Skip(sizeof(glm::vec4)); break;
+
+            default: break;
+            }
+        }
+        return !in.Failed();
+    }
+
     // ============================================
     // SEND TO SERVER
     // ============================================
@@ -103,12 +130,60 @@ namespace Boon
         m_Scene->GetDriver()->Send(m_Scene->GetDriver()->GetConnection(clientId), pkt);
     }
 
+    // ============================================
+    // TYPED SEND (generated stubs)
+    // ============================================
+    NetRPC::TypedCallResult NetRPC::WriteTypedCall(NetPacket& pkt, uint32_t classId, uint32_t fnId, const UUID& uuid,
+        bool toServer, const NetRPCArgRef* args, size_t argCount)
+    {
+        const auto& rep = NetRepRegistry::Get().GetClass(classId);
+        const BFunction* fn = toServer ? rep.FindServerRPC(fnId) : rep.FindClientRPC(fnId);
+        if (!fn || !fn->netWrite)
+            return TypedCallResult::NoStubs;
+
+        if (fn->params.size() != argCount)
+        {
+            BOON_LOG_ERROR("[NetRPC] RPC {:#x} takes {} arguments, called with {}", fnId, fn->params.size(), argCount);
+            return TypedCallResult::ArgumentMismatch;
+        }
+
+        auto& ser = pkt.GetSerializer();
+
+        ser.Write<uint32_t>(classId);
+        ser.Write<uint32_t>(fnId);
+        ser.Write<UUID>(uuid);
+        ser.Write<uint32_t>((uint32_t)argCount);
+
+        if (!fn->netWrite(ser, args))
+        {
+            BOON_LOG_ERROR("[NetRPC] RPC {:#x} called with arguments that do not convert to its parameter types", fnId);
+            return TypedCallResult::ArgumentMismatch;
+        }
+
+        return TypedCallResult::Written;
+    }
+
+    void NetRPC::SendToServer(NetPacket& pkt)
+    {
+        m_Scene->GetDriver()->SendToServer(pkt);
+    }
+
+    void NetRPC::SendToClient(uint64_t clientId, NetPacket& pkt)
+    {
+        m_Scene->GetDriver()->Send(m_Scene->GetDriver()->GetConnection(clientId), pkt);
+    }
+
     // ============================================
     // RECEIVED RPC (Server OR Client)
     // ============================================
-    void NetRPC::Process(const NetPacket& pkt, bool isServerSide)
+    void NetRPC::Process(NetPacket& pkt, bool isServerSide)
     {
-        auto ser = pkt.GetSerializer();
+        auto& ser = pkt.GetSerializer();
+
+        // Everything below comes off the wire and the serializer only asserts its bounds
+        BufferReader header = NetRPCDetail::UnreadBytes(ser);
+        if (!header.Has(sizeof(uint32_t) * 3 + sizeof(UUID)))
+            return;
 
         uint32_t classId = ser.Read<uint32_t>();
         uint32_t fnId = ser.Read<uint32_t>();
@@ -124,7 +199,36 @@ namespace Boon
             return;
 
         uint32_t argCount = ser.Read<uint32_t>();
-        Variant args[16];
+        if (argCount > fn->params.size())
+            return;
+
+        GameObject obj = m_Scene->GetGameObjectByUUID(uuid);
+        if (!obj.IsValid())
+            return;
+
+        void* component = obj.GetComponentByClass(rep.cls);
+        if (!component)
+            return;
+
+        // Fast path: generated thunk reads the typed arguments in place
+        if (fn->netThunk && argCount == fn->params.size())
+        {
+            if (!fn->netThunk(component, ser))
+                BOON_LOG_ERROR("[NetRPC] Dropped RPC {:#x}: arguments run past the end of the packet", fnId);
+            return;
+        }
+
+        constexpr uint32_t MaxVariantArgs = 16;
+        if (argCount > MaxVariantArgs)
+            return;
+
+        if (!ParamsFit(ser, *fn, argCount))
+        {
+            BOON_LOG_ERROR("[NetRPC] Dropped RPC {:#x}: arguments run past the end of the packet", fnId);
+            return;
+        }
+
+        Variant args[MaxVariantArgs];
 
         for (uint32_t i = 0; i < argCount; i++)
         {
@@ -132,11 +236,6 @@ namespace Boon
             args[i] = ReadParam(ser, type);
         }
 
-        GameObject obj = m_Scene->GetGameObjectByUUID(uuid);
-        if (!obj.IsValid())
-            return;
-
-        void* component = obj.GetComponentByClass(rep.cls);
         fn->thunk(component, args, argCount);
     }
 
@@ -13,8 +13,13 @@
 #include "Event/EventBus.h"
 #include "Networking/Events/NetConnectionEvent.h"
 
+#include "Core/Memory/Compression.h"
+#include "Serialization/BufferReader.h"
+
 #include "BoonDebug/Logger.h"
 
+#include <algorithm>
+
 namespace Boon
 {
     NetScene::NetScene(Scene* scene, NetDriver* driver, SceneManager* sceneManager)
@@ -24,15 +29,16 @@ namespace Boon
 
         if (m_Driver->GetMode() != ENetDriverMode::Client)
         {
-            m_Scene->GetOnGameObjectSpawned().Bind([this](GameObject obj) { RegisterDynamicGameObject(obj, 1); });
-            m_Scene->GetOnGameObjectDestroyed() += [this](GameObject obj) { BroadcastDespawn(obj.GetUUID()); };
-            m_Scene->GetOnComponentAdded() += [this](GameObject  obj, const BClass* cls) {BroadcastComponent(obj.GetUUID(), cls->hash, true); };
-            m_Scene->GetOnComponentRemoved() += [this](GameObject  obj, const BClass* cls) {BroadcastComponent(obj.GetUUID(), cls->hash, false); };
+            m_OnObjectSpawnedHandle = m_Scene->GetOnGameObjectSpawned().Bind([this](GameObject obj) { RegisterDynamicGameObject(obj, 1); });
+            m_OnObjectsSpawnedHandle = m_Scene->GetOnGameObjectsSpawned() += [this](std::span<const GameObjectID> objects) { BroadcastSpawnBatch(objects); };
+            m_OnObjectDestroyedHandle = m_Scene->GetOnGameObjectDestroyed() += [this](GameObject obj) { BroadcastDespawn(obj.GetUUID()); };
+            m_OnComponentAddedHandle = m_Scene->GetOnComponentAdded() += [this](GameObject  obj, const BClass* cls) {BroadcastComponent(obj.GetUUID(), cls->hash, true); };
+            m_OnComponentRemovedHandle = m_Scene->GetOnComponentRemoved() += [this](GameObject  obj, const BClass* cls) {BroadcastComponent(obj.GetUUID(), cls->hash, false); };
 
             m_ClientConnectedEvent = driver->GetEventBus().Subscribe<NetConnectionEvent>([this](const NetConnectionEvent& e)
                 {
-                    NetConnection con{ e.ConnectionId, GetDriver() };
-                    InitClientScene(&con);
+                    std::scoped_lock lock(m_PendingJoinsMutex);
+                    m_PendingJoins.push_back(e.ConnectionId);
                 });
         }
     }
@@ -42,9 +48,10 @@ namespace Boon
         if (m_Scene)
         {
             m_Scene->GetOnGameObjectSpawned().Unbind(m_OnObjectSpawnedHandle);
-            m_Scene->GetOnGameObjectSpawned().Unbind(m_OnObjectDestroyedHandle);
-            m_Scene->GetOnGameObjectSpawned().Unbind(m_OnComponentAddedHandle);
-            m_Scene->GetOnGameObjectSpawned().Unbind(m_OnComponentRemovedHandle);
+            m_Scene->GetOnGameObjectsSpawned().Unbind(m_OnObjectsSpawnedHandle);
+            m_Scene->GetOnGameObjectDestroyed().Unbind(m_OnObjectDestroyedHandle);
+            m_Scene->GetOnComponentAdded().Unbind(m_OnComponentAddedHandle);
+            m_Scene->GetOnComponentRemoved().Unbind(m_OnComponentRemovedHandle);
         }
 
         m_DynamicOwnership = {};
@@ -53,8 +60,22 @@ namespace Boon
 
     void NetScene::Update()
     {
-        if (m_Driver->IsServer())
-            m_Replication->Update(*this);
+        if (!m_Driver->IsServer())
+            return;
+
+        std::vector<uint64_t> joins;
+        {
+            std::scoped_lock lock(m_PendingJoinsMutex);
+            joins.swap(m_PendingJoins);
+        }
+
+        for (uint64_t connectionId : joins)
+        {
+            NetConnection con{ connectionId, GetDriver() };
+            InitClientScene(&con);
+        }
+
+        m_Replication->Update(*this);
     }
 
     // -------------------------------------------------------------------------
@@ -91,6 +112,19 @@ namespace Boon
             return gameObject;
         }
 
+        InitDynamicIdentity(gameObject, ownerConnection);
+
+        // Broadcast spawn packet
+        NetPacket pkt(ENetPacketType::Spawn);
+        pkt.Write(gameObject.GetComponent<UUIDComponent>().Uuid);
+        pkt.Write(ownerConnection);
+        m_Driver->Broadcast(pkt, true);
+
+        return gameObject;
+    }
+
+    void NetScene::InitDynamicIdentity(GameObject gameObject, uint64_t ownerConnection)
+    {
         auto& id = gameObject.GetComponent<UUIDComponent>().Uuid;
 
         NetIdentity& ni = gameObject.GetOrAddComponent<NetIdentity>();
@@ -102,14 +136,6 @@ namespace Boon
         if (ni.onNetAwake) ni.onNetAwake(gameObject, &ni);
 
         m_DynamicOwnership[id] = ownerConnection;
-
-        // Broadcast spawn packet
-        NetPacket pkt(ENetPacketType::Spawn);
-        pkt.Write(id);
-        pkt.Write(ownerConnection);
-        m_Driver->Broadcast(pkt, true);
-
-        return gameObject;
     }
 
     // -------------------------------------------------------------------------
@@ -156,6 +182,10 @@ namespace Boon
             HandleLoadScenePacket(sender, pkt); break;
         case ENetPacketType::InitScene:
             HandleClientSceneInitPacket(sender, pkt); break;
+        case ENetPacketType::SceneSnapshot:
+            HandleSceneSnapshotPacket(sender, pkt); break;
+        case ENetPacketType::SpawnBatch:
+            HandleSpawnBatchPacket(sender, pkt); break;
         case ENetPacketType::Replication:
             m_Replication->ProcessPacket(*this, pkt, sender); break;
         case ENetPacketType::RPC:
@@ -333,31 +363,429 @@ namespace Boon
         m_Driver->Broadcast(pkt, true);
     }
 
+    // -------------------------------------------------------------------------
+    // Join-in-progress snapshot
+    //
+    // Server gathers every networked object with its component list and full
+    // replicated state into a few large chunks (split on object boundaries,
+    // optionally compressed). The client buffers the chunks and applies them
+    // in a single pass once the last one arrived.
+    // -------------------------------------------------------------------------
+    enum ESnapshotObjectFlags : uint8_t
+    {
+        SnapshotObject_Dynamic = 1 << 0
+    };
+
+    // Upper bounds a well formed snapshot never reaches; anything above is rejected before allocating
+    constexpr uint32_t MaxSnapshotObjects = 1u << 22;
+    constexpr uint32_t MaxSnapshotChunkBytes = 64u * 1024u * 1024u;
+
+    // Walks a chunk's layout without applying it, so every count and size off the wire is
+    // checked against the bytes actually received before the scene is touched
+    static bool IsWellFormedSnapshotChunk(BufferReader in, uint32_t objectCount)
+    {
+        for (uint32_t obj = 0; obj < objectCount && !in.Failed(); ++obj)
+        {
+            in.Skip(sizeof(uint64_t) + sizeof(uint64_t));
+            const uint8_t flags = in.Read<uint8_t>();
+            if (flags & SnapshotObject_Dynamic)
+                in.Skip(static_cast<size_t>(in.Read<uint16_t>()) * sizeof(BClassID));
+
+            const uint16_t stateCount = in.Read<uint16_t>();
+            for (uint16_t state = 0; state < stateCount && !in.Failed(); ++state)
+            {
+                in.Skip(sizeof(BClassID));
+                in.Skip(in.Read<uint32_t>());
+            }
+        }
+        return !in.Failed() && in.GetRemaining() == 0;
+    }
+
     void NetScene::InitClientScene(NetConnection* conn)
     {
-        if (m_DynamicOwnership.empty())
+        const auto startTime = std::chrono::steady_clock::now();
+
+        const NetworkSettings& settings = m_Driver->GetSettings();
+        const size_t chunkLimit = std::max<size_t>(settings.SnapshotChunkSize, 1024u);
+
+        std::vector<const BClass*> classes;
+        BClassRegistry::Get().ForEach([&classes](const BClass& cls) { classes.push_back(&cls); });
+
+        struct Chunk
+        {
+            Buffer Data;
+            uint32_t ObjectCount = 0;
+        };
+        std::vector<Chunk> chunks;
+
+        BinarySerializer current;
+        uint32_t currentCount = 0;
+        uint32_t totalCount = 0;
+
+        auto flush = [&]()
+            {
+                if (currentCount == 0)
+                    return;
+                chunks.push_back({ std::move(current.GetBuffer()), currentCount });
+                current = BinarySerializer();
+                currentCount = 0;
+            };
+
+        m_Scene->ForeachGameObjectWith<NetIdentity>([&](GameObject obj)
+            {
+                const NetIdentity& ni = obj.GetComponent<NetIdentity>();
+                auto it = m_DynamicOwnership.find(ni.NetId);
+                const bool dynamic = it != m_DynamicOwnership.end();
+
+                // Static, non replicated objects already match the level on the client
+                if (!dynamic && !ni.bReplicates)
+                    return;
+
+                WriteSnapshotObject(current, obj, dynamic ? it->second : ni.OwnerConnectionId, dynamic, classes);
+                ++currentCount;
+                ++totalCount;
+
+                if (current.Size() >= chunkLimit)
+                    flush();
+            });
+        flush();
+
+        if (chunks.empty())
             return;
 
-        NetPacket pkt(ENetPacketType::InitScene);
-        pkt.Write<uint32_t>(static_cast<uint32_t>(m_DynamicOwnership.size()));
-        for (auto& [obj, owner] : m_DynamicOwnership)
+        if (chunks.size() > UINT16_MAX)
+        {
+            BOON_LOG_ERROR("[NetScene] Scene snapshot for {} needs {} chunks, more than {} fit in the header. Raise SnapshotChunkSize",
+                conn->GetId(), chunks.size(), UINT16_MAX);
+            return;
+        }
+
+        const uint32_t snapshotId = m_NextSnapshotId++;
+        const uint16_t chunkCount = static_cast<uint16_t>(chunks.size());
+        size_t rawBytes = 0;
+        size_t sentBytes = 0;
+
+        Buffer packed;
+        for (uint16_t i = 0; i < chunkCount; ++i)
         {
-            GameObject instance = m_Scene->GetGameObject(obj);
-            pkt.Write(obj);
-            pkt.Write(owner);
+            const Buffer& raw = chunks[i].Data;
 
-            std::vector<BClassID> comps;
+            bool compressed = false;
+            if (settings.bCompressSnapshots)
+            {
+                packed.Clear();
+                compressed = Compression::Compress(raw.Data(), raw.Size(), packed) < raw.Size();
+            }
+            const Buffer& payload = compressed ? packed : raw;
+
+            NetPacket pkt(ENetPacketType::SceneSnapshot);
+            pkt.Write<uint32_t>(snapshotId);
+            pkt.Write<uint16_t>(i);
+            pkt.Write<uint16_t>(chunkCount);
+            pkt.Write<uint32_t>(totalCount);
+            pkt.Write<uint32_t>(chunks[i].ObjectCount);
+            pkt.Write<bool>(compressed);
+            pkt.Write<uint32_t>(static_cast<uint32_t>(raw.Size()));
+            pkt.Write<uint32_t>(static_cast<uint32_t>(payload.Size()));
+            pkt.WriteBytes(payload.Data(), payload.Size());
+
+            m_Driver->Send(conn, pkt, true);
+
+            rawBytes += raw.Size();
+            sentBytes += payload.Size();
+        }
 
-            BClassRegistry::Get().ForEach([&comps, &instance](const BClass& cls)
+        const float ms = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+        BOON_LOG("[NetScene] Sent scene snapshot to {}: {} objects, {} chunks, {} -> {} bytes in {:.2f} ms",
+            conn->GetId(), totalCount, chunkCount, rawBytes, sentBytes, ms);
+    }
+
+    void NetScene::WriteSnapshotObject(BinarySerializer& ser, GameObject obj, uint64_t owner, bool dynamic,
+        const std::vector<const BClass*>& classes)
+    {
+        const NetIdentity& ni = obj.GetComponent<NetIdentity>();
+
+        ser.Write<UUID>(ni.NetId);
+        ser.Write<uint64_t>(owner);
+        ser.Write<uint8_t>(dynamic ? SnapshotObject_Dynamic : 0);
+
+        // Component layout (only needed to rebuild dynamic objects)
+        if (dynamic)
+        {
+            const size_t countPos = ser.Size();
+            ser.Write<uint16_t>(0);
+
+            uint16_t compCount = 0;
+            for (const BClass* cls : classes)
+            {
+                if (!obj.HasComponentByClass(cls))
+                    continue;
+                ser.Write<BClassID>(cls->hash);
+                ++compCount;
+            }
+            std::memcpy(ser.GetBuffer().DataAt(countPos), &compCount, sizeof(compCount));
+        }
+
+        // Full replicated state
+        const size_t stateCountPos = ser.Size();
+        ser.Write<uint16_t>(0);
+        uint16_t stateCount = 0;
+
+        NetRepRegistry::Get().ForEach([&](ReplicatedClass& comp)
+            {
+                if (!ni.bReplicates || !obj.HasComponentByClass(comp.cls))
+                    return;
+
+                ser.Write<BClassID>(comp.cls->hash);
+                const size_t sizePos = ser.Size();
+                ser.Write<uint32_t>(0);
+                const size_t dataStart = ser.Size();
+
+                if (comp.serializer)
                 {
-                    if (instance.HasComponentByClass(&cls))
-                        comps.push_back(cls.hash);
-                });
-            pkt.Write<uint32_t>(static_cast<uint32_t>(comps.size()));
-            pkt.WriteBytes(comps.data(), comps.size() * sizeof(BClassID));
+                    BinarySerializer compSerializer{};
+                    comp.serializer->Serialize(compSerializer, obj);
+                    ser.WriteBytes(compSerializer.Data(), compSerializer.Size());
+                }
+                else
+                {
+                    const uint8_t* inst = static_cast<const uint8_t*>(comp.cls->getComponent(obj));
+                    for (auto& propSet : comp.fields)
+                        for (auto& [flag, rf] : propSet)
+                            ser.WriteBytes(inst + rf.Offset(), rf.Size());
+                }
+
+                const uint32_t size = static_cast<uint32_t>(ser.Size() - dataStart);
+                std::memcpy(ser.GetBuffer().DataAt(sizePos), &size, sizeof(size));
+                ++stateCount;
+            });
+
+        std::memcpy(ser.GetBuffer().DataAt(stateCountPos), &stateCount, sizeof(stateCount));
+    }
+
+    void NetScene::HandleSceneSnapshotPacket(NetConnection*, NetPacket& pkt)
+    {
+        auto& s = pkt.GetSerializer();
+
+        const uint32_t snapshotId = s.Read<uint32_t>();
+        const uint16_t index = s.Read<uint16_t>();
+        const uint16_t chunkCount = s.Read<uint16_t>();
+        const uint32_t totalCount = s.Read<uint32_t>();
+        const uint32_t chunkObjects = s.Read<uint32_t>();
+        const bool compressed = s.Read<bool>();
+        const uint32_t rawSize = s.Read<uint32_t>();
+        const uint32_t dataSize = s.Read<uint32_t>();
+
+        // Sizes come off the wire, check them before anything is allocated
+        s.AlignRead();
+        const size_t readPos = s.GetReadBitPos() >> 3;
+        const size_t available = readPos <= s.Size() ? s.Size() - readPos : 0;
+
+        if (chunkCount == 0 || index >= chunkCount ||
+            totalCount > MaxSnapshotObjects || chunkObjects > totalCount ||
+            rawSize == 0 || rawSize > MaxSnapshotChunkBytes || dataSize > available ||
+            (!compressed && dataSize != rawSize))
+        {
+            BOON_LOG_ERROR("[NetScene] Rejected malformed scene snapshot chunk {}/{}", index + 1, chunkCount);
+            return;
         }
 
-        m_Driver->Send(conn, pkt);
+        PendingSnapshot& pending = m_PendingSnapshot;
+        if (pending.Id != snapshotId || pending.Chunks.size() != chunkCount)
+        {
+            pending = PendingSnapshot{};
+            pending.Id = snapshotId;
+            pending.ObjectCount = totalCount;
+            pending.Chunks.resize(chunkCount);
+            pending.ChunkObjectCounts.resize(chunkCount, 0);
+            pending.FirstChunkTime = std::chrono::steady_clock::now();
+        }
+
+        if (index >= chunkCount || !pending.Chunks[index].Empty())
+            return;
+
+        Buffer chunk(rawSize);
+        if (compressed)
+        {
+            const uint8_t* src = s.Data() + readPos;
+            if (!Compression::Decompress(src, dataSize, chunk.Data(), rawSize))
+            {
+                BOON_LOG_ERROR("[NetScene] Corrupt scene snapshot chunk {}/{}", index + 1, chunkCount);
+                pending = PendingSnapshot{};
+                return;
+            }
+        }
+        else
+        {
+            s.ReadBytes(chunk.Data(), rawSize);
+        }
+
+        pending.Chunks[index] = std::move(chunk);
+        pending.ChunkObjectCounts[index] = chunkObjects;
+
+        if (++pending.ChunksReceived == chunkCount)
+            ApplySceneSnapshot();
+    }
+
+    void NetScene::ApplySceneSnapshot()
+    {
+        PendingSnapshot& pending = m_PendingSnapshot;
+        const auto applyStart = std::chrono::steady_clock::now();
+
+        // Reject the whole snapshot up front rather than applying half of it
+        uint64_t chunkObjectTotal = 0;
+        for (size_t i = 0; i < pending.Chunks.size(); ++i)
+        {
+            chunkObjectTotal += pending.ChunkObjectCounts[i];
+            if (!IsWellFormedSnapshotChunk(BufferReader(pending.Chunks[i]), pending.ChunkObjectCounts[i]))
+            {
+                BOON_LOG_ERROR("[NetScene] Rejected scene snapshot with malformed chunk {}/{}", i + 1, pending.Chunks.size());
+                pending = PendingSnapshot{};
+                return;
+            }
+        }
+
+        if (chunkObjectTotal != pending.ObjectCount)
+        {
+            BOON_LOG_ERROR("[NetScene] Rejected scene snapshot: chunks hold {} objects, header announced {}",
+                chunkObjectTotal, pending.ObjectCount);
+            pending = PendingSnapshot{};
+            return;
+        }
+
+        m_Scene->ReserveGameObjects(pending.ObjectCount);
+        m_DynamicOwnership.reserve(m_DynamicOwnership.size() + pending.ObjectCount);
+
+        for (size_t i = 0; i < pending.Chunks.size(); ++i)
+        {
+            BufferReader in(pending.Chunks[i]);
+            for (uint32_t obj = 0; obj < pending.ChunkObjectCounts[i]; ++obj)
+                ReadSnapshotObject(in);
+        }
+
+        const auto now = std::chrono::steady_clock::now();
+        BOON_LOG("[NetScene] Applied scene snapshot: {} objects, {} chunks, apply {:.2f} ms, join {:.2f} ms",
+            pending.ObjectCount, pending.Chunks.size(),
+            std::chrono::duration<float, std::milli>(now - applyStart).count(),
+            std::chrono::duration<float, std::milli>(now - pending.FirstChunkTime).count());
+
+        pending = PendingSnapshot{};
+    }
+
+    void NetScene::ReadSnapshotObject(BufferReader& in)
+    {
+        const UUID uuid = in.Read<uint64_t>();
+        const uint64_t owner = in.Read<uint64_t>();
+        const uint8_t flags = in.Read<uint8_t>();
+
+        // A repeated or late snapshot updates the object it already created instead of spawning a duplicate
+        GameObject obj = m_Scene->GetGameObject(uuid);
+        if (!obj.IsValid() && (flags & SnapshotObject_Dynamic))
+            obj = CreateReplicatedGameObject(uuid, owner);
+
+        if (flags & SnapshotObject_Dynamic)
+        {
+            const uint16_t compCount = in.Read<uint16_t>();
+            for (uint16_t comp = 0; comp < compCount; ++comp)
+            {
+                const BClassID compId = in.Read<BClassID>();
+                const BClass* cls = BClassRegistry::Get().Find(compId);
+                if (cls && obj.IsValid())
+                    obj.GetOrAddComponentByClass(cls);
+            }
+        }
+
+        NetRepRegistry& reg = NetRepRegistry::Get();
+
+        const uint16_t stateCount = in.Read<uint16_t>();
+        for (uint16_t state = 0; state < stateCount; ++state)
+        {
+            const BClassID compId = in.Read<BClassID>();
+            const uint32_t size = in.Read<uint32_t>();
+            const uint8_t* data = in.Take(size);
+            if (in.Failed())
+                return;
+
+            ReplicatedClass& comp = reg.GetClass(compId);
+            if (!obj.IsValid() || !comp.cls)
+                continue;
+
+            if (!comp.cls->hasComponent(obj))
+                comp.cls->addComponent(obj);
+
+            if (comp.serializer)
+            {
+                BinarySerializer compSerializer{ data, size };
+                comp.serializer->Deserialize(compSerializer, obj);
+                continue;
+            }
+
+            if (size != comp.size)
+                continue;
+
+            uint8_t* inst = static_cast<uint8_t*>(comp.cls->getComponent(obj));
+            for (auto& propSet : comp.fields)
+                for (auto& [flag, rf] : propSet)
+                {
+                    std::memcpy(inst + rf.Offset(), data, rf.Size());
+                    data += rf.Size();
+                }
+        }
+    }
+
+    // -------------------------------------------------------------------------
+    // Batch spawn
+    //
+    // A batch instantiate goes out as one message holding every object with its
+    // components and replicated state, in the same layout as a snapshot chunk,
+    // instead of a spawn packet plus one component packet per component.
+    // -------------------------------------------------------------------------
+    void NetScene::BroadcastSpawnBatch(std::span<const GameObjectID> objects)
+    {
+        if (!m_bRegisterDynamicObject || objects.empty())
+            return;
+
+        std::vector<const BClass*> classes;
+        BClassRegistry::Get().ForEach([&classes](const BClass& cls) { classes.push_back(&cls); });
+
+        BinarySerializer batch;
+        for (GameObjectID id : objects)
+        {
+            GameObject obj{ id, m_Scene };
+            InitDynamicIdentity(obj, 1);
+            WriteSnapshotObject(batch, obj, 1, true, classes);
+        }
+
+        NetPacket pkt(ENetPacketType::SpawnBatch);
+        pkt.Write<uint32_t>(static_cast<uint32_t>(objects.size()));
+        pkt.Write<uint32_t>(static_cast<uint32_t>(batch.Size()));
+        pkt.WriteBytes(batch.Data(), batch.Size());
+        m_Driver->Broadcast(pkt, true);
+    }
+
+    void NetScene::HandleSpawnBatchPacket(NetConnection*, NetPacket& pkt)
+    {
+        auto& s = pkt.GetSerializer();
+
+        const uint32_t objectCount = s.Read<uint32_t>();
+        const uint32_t dataSize = s.Read<uint32_t>();
+
+        s.AlignRead();
+        const size_t readPos = s.GetReadBitPos() >> 3;
+        const size_t available = readPos <= s.Size() ? s.Size() - readPos : 0;
+
+        if (objectCount > MaxSnapshotObjects || dataSize > available ||
+            !IsWellFormedSnapshotChunk(BufferReader(s.Data() + readPos, dataSize), objectCount))
+        {
+            BOON_LOG_ERROR("[NetScene] Rejected malformed spawn batch of {} objects", objectCount);
+            return;
+        }
+
+        m_Scene->ReserveGameObjects(objectCount);
+
+        BufferReader in(s.Data() + readPos, dataSize);
+        for (uint32_t obj = 0; obj < objectCount; ++obj)
+            ReadSnapshotObject(in);
     }
 
     void NetScene::HandleClientSceneInitPacket(NetConnection*, NetPacket& pkt)
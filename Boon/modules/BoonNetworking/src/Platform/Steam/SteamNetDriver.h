@@ -54,7 +54,7 @@ namespace Boon
         ENetDriverMode GetMode() const override { return m_Settings.NetMode; }
         uint64_t GetLocalConnectionId() const override { return IsServer() ? 1 : m_LocalConnectionId; }
 
-        const NetworkSettings& GetSettings() const { return m_Settings; }
+        const NetworkSettings& GetSettings() const override { return m_Settings; }
 
         // Client connect
         virtual bool Connect(const char* host, uint16_t port) override;
@@ -0,0 +1,94 @@
+#include "Asset/SpriteAnimatorSystem.h"
+#include "Component/SpriteAnimatorComponent.h"
+#include "Component/SpriteRendererComponent.h"
+#include "Core/Threading/JobSystem.h"
+#include "Scene/Scene.h"
+#include "Scene/GameObject.h"
+
+#include <mutex>
+#include <vector>
+
+namespace Boon
+{
+    namespace
+    {
+        // Awake points pRenderer at the animator's own game object
+        bool DrivesOwnRenderer(const SpriteAnimatorComponent& animator, GameObjectID entity)
+        {
+            const GameObject target = animator.pRenderer.Owner();
+            return !target.IsValid() || static_cast<GameObjectID>(target) == entity;
+        }
+
+        void ResolveAndAdvance(SpriteAnimatorComponent& animator, SpriteRendererComponent& renderer, float deltaTime)
+        {
+            if (animator.NeedsAtlas(renderer))
+                animator.BindAtlas(renderer.SpriteAtlasHandle.Handle(), renderer.SpriteAtlasHandle.Instance());
+
+            animator.Advance(deltaTime, renderer);
+        }
+    }
+
+    void SpriteAnimatorSystem::Update(Scene& scene, float deltaTime)
+    {
+        auto& registry = scene.GetRegistry();
+        auto view = registry.view<SpriteAnimatorComponent, SpriteRendererComponent>();
+
+        // Rare cases the parallel pass hands back: atlas changes and renderers on other game objects
+        std::mutex deferredMutex;
+        std::vector<GameObjectID> rebind;
+        std::vector<GameObjectID> external;
+
+        auto advance = [&](GameObjectID entity)
+            {
+                SpriteAnimatorComponent& animator = view.get<SpriteAnimatorComponent>(entity);
+                SpriteRendererComponent& renderer = view.get<SpriteRendererComponent>(entity);
+
+                if (!DrivesOwnRenderer(animator, entity))
+                {
+                    std::lock_guard lock(deferredMutex);
+                    external.push_back(entity);
+                    return;
+                }
+
+                if (animator.NeedsAtlas(renderer))
+                {
+                    std::lock_guard lock(deferredMutex);
+                    rebind.push_back(entity);
+                    return;
+                }
+
+                animator.Advance(deltaTime, renderer);
+            };
+
+        if (JobSystem* jobs = JobSystem::Get())
+        {
+            jobs->ParallelForEach(view, BatchSize, advance);
+        }
+        else
+        {
+            for (GameObjectID entity : view)
+                advance(entity);
+        }
+
+        // Asset lookups stay on this thread
+        for (GameObjectID entity : rebind)
+        {
+            auto [animator, renderer] = view.get<SpriteAnimatorComponent, SpriteRendererComponent>(entity);
+            ResolveAndAdvance(animator, renderer, deltaTime);
+        }
+
+        auto driveExternal = [deltaTime](SpriteAnimatorComponent& animator)
+            {
+                if (!animator.pRenderer.IsValid())
+                    return;
+
+                ResolveAndAdvance(animator, *animator.pRenderer.Get(), deltaTime);
+            };
+
+        for (GameObjectID entity : external)
+            driveExternal(view.get<SpriteAnimatorComponent>(entity));
+
+        for (auto [entity, animator] : registry.view<SpriteAnimatorComponent>(entt::exclude<SpriteRendererComponent>).each())
+            driveExternal(animator);
+    }
+}
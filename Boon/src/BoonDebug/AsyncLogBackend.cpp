@@ -0,0 +1,269 @@
+#include "BoonDebug/AsyncLogBackend.h"
+
+#include <chrono>
+
+using namespace Boon;
+
+std::atomic<AsyncLogBackend*> AsyncLogBackend::s_Active{ nullptr };
+std::atomic<uint64_t> AsyncLogBackend::s_NextGeneration{ 1 };
+
+namespace
+{
+	// Records handled per ring before moving on, keeps one chatty thread from starving the others
+	constexpr size_t MaxRecordsPerPass = 256;
+	constexpr auto IdleWait = std::chrono::milliseconds(10);
+}
+
+AsyncLogBackend::AsyncLogBackend(size_t ringCapacity, WriteFn write)
+	: m_Write(std::move(write))
+	, m_RingCapacity(ringCapacity)
+	, m_Generation(s_NextGeneration.fetch_add(1, std::memory_order_relaxed))
+{
+	m_Worker = std::thread([this]() { Run(); });
+	s_Active.store(this, std::memory_order_release);
+}
+
+AsyncLogBackend::~AsyncLogBackend()
+{
+	AsyncLogBackend* self = this;
+	s_Active.compare_exchange_strong(self, nullptr, std::memory_order_acq_rel);
+
+	{
+		std::lock_guard lock(m_WakeMutex);
+		m_Running.store(false, std::memory_order_release);
+	}
+	m_WakeCV.notify_one();
+
+	if (m_Worker.joinable())
+		m_Worker.join();
+}
+
+void AsyncLogBackend::PushText(LogLevel level, std::string_view text)
+{
+	ThreadRing& ring = GetThreadRing();
+	LogRecord* record = ring.Ring.BeginPush();
+	if (!record)
+	{
+		ring.Dropped.fetch_add(1, std::memory_order_relaxed);
+		return;
+	}
+
+	record->Header.Format = nullptr;
+	record->Header.Fmt = nullptr;
+	record->Header.FmtSize = 0;
+	record->Header.Level = level;
+
+	if (text.size() <= LogRecord::PayloadCapacity)
+	{
+		record->Header.Kind = LogRecord::EKind::Text;
+		record->Header.PayloadSize = static_cast<uint16_t>(text.size());
+		std::memcpy(record->Payload, text.data(), text.size());
+	}
+	else
+	{
+		// Rare: long messages (shader logs, dumps) are moved to the heap
+		std::string* heapText = new std::string(text);
+		record->Header.Kind = LogRecord::EKind::HeapText;
+		record->Header.PayloadSize = sizeof(heapText);
+		std::memcpy(record->Payload, &heapText, sizeof(heapText));
+	}
+
+	Commit(ring);
+}
+
+void AsyncLogBackend::Flush()
+{
+	if (std::this_thread::get_id() == m_Worker.get_id())
+		return;
+
+	const uint64_t ticket = m_FlushRequests.fetch_add(1, std::memory_order_acq_rel) + 1;
+
+	std::unique_lock lock(m_WakeMutex);
+	m_WakeCV.notify_one();
+	m_FlushCV.wait(lock, [&]()
+		{
+			return m_FlushServed.load(std::memory_order_acquire) >= ticket || !m_Running.load(std::memory_order_acquire);
+		});
+}
+
+AsyncLogBackend::ThreadRing& AsyncLogBackend::GetThreadRing()
+{
+	struct Holder
+	{
+		std::shared_ptr<ThreadRing> Ring;
+		uint64_t Generation = 0;
+
+		~Holder()
+		{
+			// The worker drains and releases the ring once the thread is gone
+			if (Ring)
+				Ring->Retired.store(true, std::memory_order_release);
+		}
+	};
+	thread_local Holder t_Holder;
+
+	if (t_Holder.Ring && t_Holder.Generation == m_Generation)
+		return *t_Holder.Ring;
+
+	if (t_Holder.Ring)
+		t_Holder.Ring->Retired.store(true, std::memory_order_release);
+
+	auto ring = std::make_shared<ThreadRing>(m_RingCapacity);
+	{
+		std::lock_guard lock(m_RingsMutex);
+		m_Rings.push_back(ring);
+	}
+
+	t_Holder.Ring = ring;
+	t_Holder.Generation = m_Generation;
+	return *ring;
+}
+
+void AsyncLogBackend::Commit(ThreadRing& ring)
+{
+	ring.Ring.EndPush();
+
+	// Pairs with the fence in Run(): either the worker sees the new record
+	// before sleeping, or we see it sleeping and wake it.
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if (m_WorkerSleeping.load(std::memory_order_relaxed))
+	{
+		std::lock_guard lock(m_WakeMutex);
+		m_WakeCV.notify_one();
+	}
+}
+
+void AsyncLogBackend::Run()
+{
+	while (true)
+	{
+		const uint64_t flushTarget = m_FlushRequests.load(std::memory_order_acquire);
+
+		if (DrainAll())
+			continue;
+
+		// Every ring was empty after flushTarget was read, so all records
+		// pushed before those flush requests have been written.
+		if (m_FlushServed.load(std::memory_order_relaxed) < flushTarget)
+		{
+			{
+				std::lock_guard lock(m_WakeMutex);
+				m_FlushServed.store(flushTarget, std::memory_order_release);
+			}
+			m_FlushCV.notify_all();
+		}
+
+		if (!m_Running.load(std::memory_order_acquire))
+			break;
+
+		m_WorkerSleeping.store(true, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+
+		bool pending = false;
+		{
+			std::lock_guard lock(m_RingsMutex);
+			for (auto& ring : m_Rings)
+				pending |= !ring->Ring.Empty();
+		}
+
+		if (!pending)
+		{
+			std::unique_lock lock(m_WakeMutex);
+			m_WakeCV.wait_for(lock, IdleWait, [this]()
+				{
+					return !m_Running.load(std::memory_order_acquire)
+						|| m_FlushRequests.load(std::memory_order_acquire) > m_FlushServed.load(std::memory_order_acquire);
+				});
+		}
+
+		m_WorkerSleeping.store(false, std::memory_order_relaxed);
+	}
+
+	{
+		std::lock_guard lock(m_WakeMutex);
+		m_FlushServed.store(m_FlushRequests.load(std::memory_order_acquire), std::memory_order_release);
+	}
+	m_FlushCV.notify_all();
+}
+
+bool AsyncLogBackend::DrainAll()
+{
+	std::vector<std::shared_ptr<ThreadRing>> rings;
+	{
+		std::lock_guard lock(m_RingsMutex);
+		rings = m_Rings;
+	}
+
+	bool didWork = false;
+	bool anyRetired = false;
+
+	for (auto& ring : rings)
+	{
+		size_t processed = 0;
+		while (processed < MaxRecordsPerPass)
+		{
+			LogRecord* record = ring->Ring.Front();
+			if (!record)
+				break;
+
+			WriteRecord(*record);
+			ring->Ring.Pop();
+			++processed;
+		}
+		didWork |= processed > 0;
+
+		if (const uint64_t dropped = ring->Dropped.exchange(0, std::memory_order_relaxed))
+		{
+			m_TotalDropped.fetch_add(dropped, std::memory_order_relaxed);
+			m_Write(LogLevel::Warning, std::format("[Logger] Dropped {} log messages, producer ring full", dropped));
+		}
+
+		anyRetired |= ring->Retired.load(std::memory_order_acquire);
+	}
+
+	if (anyRetired)
+	{
+		std::lock_guard lock(m_RingsMutex);
+		std::erase_if(m_Rings, [](const std::shared_ptr<ThreadRing>& ring)
+			{
+				return ring->Retired.load(std::memory_order_acquire) && ring->Ring.Empty();
+			});
+	}
+
+	return didWork;
+}
+
+void AsyncLogBackend::WriteRecord(LogRecord& record)
+{
+	const LogLevel level = record.Header.Level;
+
+	switch (record.Header.Kind)
+	{
+	case LogRecord::EKind::Deferred:
+	{
+		const std::string_view fmt(record.Header.Fmt, record.Header.FmtSize);
+		try
+		{
+			record.Header.Format(m_FormatBuffer, fmt, record.Payload);
+		}
+		catch (const std::format_error&)
+		{
+			m_FormatBuffer.assign(fmt);
+		}
+		m_Write(level, m_FormatBuffer);
+		break;
+	}
+	case LogRecord::EKind::Text:
+		m_FormatBuffer.assign(reinterpret_cast<const char*>(record.Payload), record.Header.PayloadSize);
+		m_Write(level, m_FormatBuffer);
+		break;
+	case LogRecord::EKind::HeapText:
+	{
+		std::string* heapText = nullptr;
+		std::memcpy(&heapText, record.Payload, sizeof(heapText));
+		m_Write(level, *heapText);
+		delete heapText;
+		break;
+	}
+	}
+}
@@ -0,0 +1,81 @@
+#include "BoonDebug/DebugRenderer.h"
+
+#include "Renderer/Renderer2D.h"
+
+using namespace Boon;
+
+namespace
+{
+	const glm::vec4 QuadCorners[4] = {
+		{ -0.5f, -0.5f, 0.0f, 1.0f },
+		{  0.5f, -0.5f, 0.0f, 1.0f },
+		{  0.5f,  0.5f, 0.0f, 1.0f },
+		{ -0.5f,  0.5f, 0.0f, 1.0f }
+	};
+}
+
+void DebugDrawList::AddLine(const glm::vec3& p0, const glm::vec3& p1, const glm::vec4& color)
+{
+	m_Lines.push_back({ p0, p1, color });
+}
+
+void DebugDrawList::AddRect(const glm::vec3& position, const glm::vec2& size, const glm::vec4& color)
+{
+	glm::vec3 corners[4];
+	for (int i = 0; i < 4; ++i)
+		corners[i] = position + glm::vec3(QuadCorners[i]) * glm::vec3(size.x, size.y, 1.0f);
+
+	for (int i = 0; i < 4; ++i)
+		m_Lines.push_back({ corners[i], corners[(i + 1) % 4], color });
+}
+
+void DebugDrawList::AddRect(const glm::mat4& transform, const glm::vec2& size, const glm::vec4& color)
+{
+	glm::vec3 corners[4];
+	for (int i = 0; i < 4; ++i)
+		corners[i] = glm::vec3(transform * (QuadCorners[i] * glm::vec4(size.x, size.y, 1.0f, 1.0f)));
+
+	for (int i = 0; i < 4; ++i)
+		m_Lines.push_back({ corners[i], corners[(i + 1) % 4], color });
+}
+
+DebugDrawHandle DebugRenderer::CreateRetained(float lifetime)
+{
+	const DebugDrawHandle handle = m_NextHandle++;
+	m_Retained[handle].Lifetime = lifetime;
+	return handle;
+}
+
+DebugDrawList* DebugRenderer::GetRetained(DebugDrawHandle handle)
+{
+	auto it = m_Retained.find(handle);
+	return it != m_Retained.end() ? &it->second.Lines : nullptr;
+}
+
+void DebugRenderer::DestroyRetained(DebugDrawHandle handle)
+{
+	m_Retained.erase(handle);
+}
+
+void DebugRenderer::BeginFrame(float deltaTime)
+{
+	m_FrameList.Clear();
+
+	std::erase_if(m_Retained, [deltaTime](auto& entry)
+		{
+			RetainedList& list = entry.second;
+			if (list.Lifetime < 0.0f)
+				return false;
+
+			list.Lifetime -= deltaTime;
+			return list.Lifetime <= 0.0f;
+		});
+}
+
+void DebugRenderer::Flush(Renderer2D& renderer) const
+{
+	renderer.SubmitLines(m_FrameList.GetLines());
+
+	for (const auto& [handle, list] : m_Retained)
+		renderer.SubmitLines(list.Lines.GetLines());
+}
@@ -1,4 +1,5 @@
 #include "BoonDebug/Logger.h"
+#include "BoonDebug/RotatingFileLogSink.h"
 
 #include <iostream>
 #include <memory>
@@ -35,20 +36,58 @@ namespace
 	};
 }
 
-void Logger::Init()
+void Logger::Init(const LogSettings& settings)
 {
 	auto logger = std::make_shared<Logger>();
 	logger->AddSink(std::make_shared<StdoutLogSink>());
+
+	if (!settings.File.empty())
+		logger->AddSink(std::make_shared<RotatingFileLogSink>(settings.File, settings.MaxFileSize, settings.MaxFiles));
+
+	if (settings.bAsync)
+		logger->EnableAsync(settings.RingCapacity);
+
 	ServiceLocator::Register(logger);
 }
 
+Logger::~Logger()
+{
+	DisableAsync();
+}
+
+void Logger::EnableAsync(size_t ringCapacity)
+{
+	if (m_pAsync)
+		return;
+
+	m_pAsync = std::make_unique<AsyncLogBackend>(ringCapacity,
+		[this](LogLevel level, const std::string& msg)
+		{
+			WriteToSinks(level, msg);
+		});
+}
+
+void Logger::DisableAsync()
+{
+	// Destroying the backend drains every ring before the worker exits
+	m_pAsync.reset();
+}
+
+void Logger::Flush()
+{
+	if (m_pAsync)
+		m_pAsync->Flush();
+}
+
 void Logger::AddSink(const std::shared_ptr<ILogSink>& sink)
 {
+	std::scoped_lock lock(m_SinkMutex);
 	m_Sinks.push_back(sink);
 }
 
 void Boon::Logger::RemoveSink(ILogSink* sink)
 {
+	std::scoped_lock lock(m_SinkMutex);
 	m_Sinks.erase(
 		std::remove_if(m_Sinks.begin(), m_Sinks.end(),
 			[sink](const std::shared_ptr<ILogSink>& s)
@@ -75,6 +114,18 @@ void Logger::Error(const std::string& msg)
 
 void Logger::Write(LogLevel level, const std::string& msg)
 {
+	if (m_pAsync)
+	{
+		m_pAsync->PushText(level, msg);
+		return;
+	}
+
+	WriteToSinks(level, msg);
+}
+
+void Logger::WriteToSinks(LogLevel level, const std::string& msg)
+{
+	std::scoped_lock lock(m_SinkMutex);
 	for (const auto& sink : m_Sinks)
 	{
 		sink->Write(level, msg);
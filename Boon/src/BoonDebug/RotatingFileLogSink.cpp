@@ -0,0 +1,75 @@
+#include "BoonDebug/RotatingFileLogSink.h"
+
+using namespace Boon;
+
+namespace
+{
+	std::filesystem::path IndexedPath(const std::filesystem::path& path, uint32_t index)
+	{
+		std::filesystem::path result = path;
+		result += "." + std::to_string(index);
+		return result;
+	}
+}
+
+RotatingFileLogSink::RotatingFileLogSink(const std::filesystem::path& path, uint32_t maxFileSize, uint32_t maxFiles)
+	: m_Path(path), m_MaxFileSize(maxFileSize), m_MaxFiles(maxFiles)
+{
+	std::error_code ec;
+	if (m_Path.has_parent_path())
+		std::filesystem::create_directories(m_Path.parent_path(), ec);
+
+	Open();
+}
+
+void RotatingFileLogSink::Write(LogLevel level, const std::string& message)
+{
+	if (!m_File.is_open())
+		return;
+
+	const char* prefix = "[Info] ";
+	switch (level)
+	{
+	case LogLevel::Warning: prefix = "[Warning] "; break;
+	case LogLevel::Error:   prefix = "[Error] ";   break;
+	default: break;
+	}
+
+	m_File << prefix << message << '\n';
+	m_Size += std::char_traits<char>::length(prefix) + message.size() + 1;
+
+	if (level == LogLevel::Error)
+		m_File.flush();
+
+	if (m_MaxFileSize > 0 && m_Size >= m_MaxFileSize)
+		Rotate();
+}
+
+void RotatingFileLogSink::Open()
+{
+	m_File.open(m_Path, std::ios::out | std::ios::app);
+
+	std::error_code ec;
+	const auto size = std::filesystem::file_size(m_Path, ec);
+	m_Size = ec ? 0 : size;
+}
+
+void RotatingFileLogSink::Rotate()
+{
+	m_File.close();
+
+	std::error_code ec;
+	if (m_MaxFiles == 0)
+	{
+		std::filesystem::remove(m_Path, ec);
+	}
+	else
+	{
+		std::filesystem::remove(IndexedPath(m_Path, m_MaxFiles), ec);
+		for (uint32_t i = m_MaxFiles; i > 1; --i)
+			std::filesystem::rename(IndexedPath(m_Path, i - 1), IndexedPath(m_Path, i), ec);
+		std::filesystem::rename(m_Path, IndexedPath(m_Path, 1), ec);
+	}
+
+	Open();
+}
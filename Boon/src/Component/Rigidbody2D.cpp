@@ -8,6 +8,7 @@ void Rigidbody2D::SetVelocity(const glm::vec2& velocity)
     HasPendingSetVelocity = true;
     DirtyVelocity = true;
     WakeRequested = true;
+    HasPendingCommands = true;
 }
 
 void Rigidbody2D::SetAngularVelocity(float angularVelocity)
@@ -16,6 +17,7 @@ void Rigidbody2D::SetAngularVelocity(float angularVelocity)
     HasPendingSetAngularVelocity = true;
     DirtyVelocity = true;
     WakeRequested = true;
+    HasPendingCommands = true;
 }
 
 void Rigidbody2D::SetPosition(const glm::vec2& position)
@@ -25,6 +27,7 @@ void Rigidbody2D::SetPosition(const glm::vec2& position)
     HasPendingSetTransform = true;
     DirtyTransform = true;
     WakeRequested = true;
+    HasPendingCommands = true;
 }
 
 void Rigidbody2D::SetRotation(float degrees)
@@ -34,6 +37,7 @@ void Rigidbody2D::SetRotation(float degrees)
     HasPendingSetTransform = true;
     DirtyTransform = true;
     WakeRequested = true;
+    HasPendingCommands = true;
 }
 
 void Rigidbody2D::SetTransform(const glm::vec2& position, float degrees)
@@ -43,6 +47,7 @@ void Rigidbody2D::SetTransform(const glm::vec2& position, float degrees)
     HasPendingSetTransform = true;
     DirtyTransform = true;
     WakeRequested = true;
+    HasPendingCommands = true;
 }
 
 void Rigidbody2D::AddForce(const glm::vec2& force, ForceMode mode, bool wake)
@@ -54,6 +59,7 @@ void Rigidbody2D::AddForce(const glm::vec2& force, ForceMode mode, bool wake)
 
     if (wake)
         WakeRequested = true;
+    HasPendingCommands = true;
 }
 
 void Rigidbody2D::AddTorque(float torque, bool wake)
@@ -62,6 +68,7 @@ void Rigidbody2D::AddTorque(float torque, bool wake)
 
     if (wake)
         WakeRequested = true;
+    HasPendingCommands = true;
 }
 
 void Rigidbody2D::AddImpulse(const glm::vec2& impulse, bool wake)
@@ -70,4 +77,5 @@ void Rigidbody2D::AddImpulse(const glm::vec2& impulse, bool wake)
 
     if (wake)
         WakeRequested = true;
+    HasPendingCommands = true;
 }
\ No newline at end of file
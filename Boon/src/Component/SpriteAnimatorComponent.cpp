@@ -6,6 +6,10 @@
 #include "Core/ServiceLocator.h"
 #include "Core/Time.h"
 
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
 using namespace Boon;
 
 void Boon::SpriteAnimatorComponent::Awake(GameObject obj)
@@ -13,41 +17,45 @@ void Boon::SpriteAnimatorComponent::Awake(GameObject obj)
 	pRenderer = obj;
 }
 
-void Boon::SpriteAnimatorComponent::Update(GameObject obj)
+void Boon::SpriteAnimatorComponent::BindAtlas(AssetHandle handle, std::shared_ptr<SpriteAtlas> atlas)
 {
-	if (!pRenderer.IsValid())
-		return;
+	if (Atlas != atlas)
+		m_Dirty = true;
 
-	Atlas = pRenderer->SpriteAtlasHandle.Instance();
-	if (!Atlas)
-		return;
+	Atlas = std::move(atlas);
+	m_AtlasHandle = handle;
+}
 
-	if (Atlas->GetClips().size() <= Clip)
+void Boon::SpriteAnimatorComponent::Advance(float deltaTime, SpriteRendererComponent& renderer)
+{
+	if (!Atlas || !Atlas->IsValidClip(Clip))
 		return;
 
-	SpriteAnimClip& clip = GetClip();
+	const SpriteAnimClip& clip = std::as_const(*Atlas).GetClip(Clip);
 
 	if (clip.Frames.empty())
 		return;
 
-	if (m_Current >= clip.Frames.size())
-		m_Current = static_cast<int>(clip.Frames.size()) - 1;
+	const int frameCount = static_cast<int>(clip.Frames.size());
+	if (m_Current >= frameCount)
+		m_Current = frameCount - 1;
 
-	float frameTime = 1.0f / std::max(clip.FPS, 0.001f);
+	const float frameTime = 1.0f / std::max(clip.FPS, 0.001f);
 
-	m_Timer += obj.GetScene()->GetTime().GetDeltaTime() * clip.Speed;
+	m_Timer += deltaTime * clip.Speed;
 	if (m_Timer >= frameTime)
 	{
-		m_Timer = 0.f;
-
-		if (++m_Current == clip.Frames.size())
-			m_Current = 0;
+		// Keep the remainder; a long frame may skip several animation frames
+		const float steps = std::floor(m_Timer / frameTime);
+		m_Timer -= steps * frameTime;
 
+		m_Current = static_cast<int>((static_cast<int64_t>(m_Current) + static_cast<int64_t>(steps)) % frameCount);
 		m_Dirty = true;
 	}
+
 	if (m_Dirty)
 	{
-		pRenderer->Sprite = clip.Frames[m_Current];
+		renderer.Sprite = clip.Frames[m_Current];
 		m_Dirty = false;
 	}
 }
@@ -3,6 +3,7 @@
 #include "Core/Time.h"
 #include "Core/ServiceLocator.h"
 #include <Core/SubsystemRegistry.h>
+#include "Core/Threading/JobSystem.h"
 
 #include "Asset/AssetLibrary.h"
 
@@ -11,12 +12,14 @@
 #include "Input/Input.h"
 
 #include "Renderer/Renderer.h"
+#include "Renderer/ShaderCompiler/ShaderCache.h"
 
 #include "Scene/SceneManager.h"
 
 #include "Module/StaticModules.h"
 
 #include "BoonDebug/Logger.h"
+#include "BoonDebug/DebugRenderer.h"
 
 #include <Reflection/BClassBase.h>
 #include <Reflection/BClass.h>
@@ -65,6 +68,8 @@ void Boon::Application::Initialize(std::shared_ptr<AppState>&& pState)
 	m_pInput = std::make_unique<Input>();
 	m_pEventBus = std::make_unique<EventBus>();
 	m_pTime = std::make_unique<Time>();
+	if (m_Desc.Physics.FixedTimeStep > 0.0f)
+		m_pTime->SetFixedTimeStep(m_Desc.Physics.FixedTimeStep);
 	m_pSubsystems = std::make_unique<SubsystemRegistry>();
 
 	Window::WindowDesc windowDesc{};
@@ -99,6 +104,9 @@ void Boon::Application::Initialize(std::shared_ptr<AppState>&& pState)
 
 	BOON_REGISTER_FN(BClassRegistry::Get(), NetRepRegistry::Get());
 
+	if (m_Desc.Render.bShaderCache && !m_Desc.IntermediateRoot.empty())
+		ShaderCache::SetDirectory(m_Desc.IntermediateRoot / "ShaderCache");
+
 	m_pAssets = std::make_unique<AssetLibrary>(m_Desc.AssetsRoot);
 	m_pAssets->LoadManifest("AssetManifest.json");
 	m_pScenes = std::make_unique<SceneManager>(&m_Context);
@@ -112,7 +120,13 @@ void Boon::Application::Initialize(std::shared_ptr<AppState>&& pState)
 	m_Context.ProjectConfig = &m_Desc;
 	m_Context.Subsystems = m_pSubsystems.get();
 
-	BOON_INIT_LOGGER();
+	LogSettings logSettings = m_Desc.Log;
+	if (!logSettings.File.empty() && std::filesystem::path(logSettings.File).is_relative() && !m_Desc.SavedRoot.empty())
+		logSettings.File = (m_Desc.SavedRoot / logSettings.File).string();
+	BOON_INIT_LOGGER(logSettings);
+
+	// Registered first so every other subsystem can schedule work from OnInit
+	m_pSubsystems->Register<JobSystem>(m_Desc.Jobs.WorkerCount);
 
 	m_ModuleContext.BClasses = m_pClsRegistry.get();
 	m_ModuleContext.NetReps = m_pNetRepRegistry.get();
@@ -134,6 +148,7 @@ void Boon::Application::Tick()
 {
 	Time& time{ *m_pTime };
 	time.Step();
+	DebugRenderer::Get().BeginFrame(time.GetDeltaTime());
 	m_bShouldQuit = m_pWindow->Update();
 	m_pSubsystems->UpdateAll(m_Context);
 	m_pStateMachine->Update();
@@ -0,0 +1,170 @@
+#include "Core/Memory/Compression.h"
+
+#include <cstring>
+
+namespace Boon
+{
+	// Stream layout, repeated until the input is consumed:
+	//   token   : high nibble literal length, low nibble (match length - MinMatch)
+	//   [ext]   : 255-run length extension for either nibble == 15
+	//   literals
+	//   offset  : uint16 little endian back reference (absent in the final sequence)
+	static constexpr size_t MinMatch = 4;
+	static constexpr size_t MaxOffset = 0xFFFF;
+	static constexpr size_t HashBits = 14;
+	static constexpr size_t LastLiterals = 5;
+
+	static inline uint32_t Read32(const uint8_t* p)
+	{
+		uint32_t v;
+		std::memcpy(&v, p, sizeof(v));
+		return v;
+	}
+
+	static inline uint32_t Hash(uint32_t v)
+	{
+		return (v * 2654435761u) >> (32 - HashBits);
+	}
+
+	static inline void WriteLength(Buffer& out, size_t len)
+	{
+		while (len >= 255)
+		{
+			out.Write<uint8_t>(255);
+			len -= 255;
+		}
+		out.Write<uint8_t>(static_cast<uint8_t>(len));
+	}
+
+	static void WriteSequence(Buffer& out, const uint8_t* literals, size_t literalLen, size_t matchLen, size_t offset)
+	{
+		const size_t litNibble = literalLen < 15 ? literalLen : 15;
+		const size_t matchCode = matchLen ? matchLen - MinMatch : 0;
+		const size_t matchNibble = matchCode < 15 ? matchCode : 15;
+
+		out.Write<uint8_t>(static_cast<uint8_t>((litNibble << 4) | matchNibble));
+		if (litNibble == 15)
+			WriteLength(out, literalLen - 15);
+
+		out.Append(literals, literalLen);
+
+		if (!matchLen)
+			return;
+
+		out.Write<uint8_t>(static_cast<uint8_t>(offset & 0xFF));
+		out.Write<uint8_t>(static_cast<uint8_t>(offset >> 8));
+		if (matchNibble == 15)
+			WriteLength(out, matchCode - 15);
+	}
+
+	static bool ReadLength(const uint8_t*& ip, const uint8_t* end, size_t& len)
+	{
+		uint8_t b;
+		do
+		{
+			if (ip >= end)
+				return false;
+			b = *ip++;
+			len += b;
+		} while (b == 255);
+		return true;
+	}
+}
+
+size_t Boon::Compression::CompressBound(size_t size)
+{
+	return size + size / 255 + 16;
+}
+
+size_t Boon::Compression::Compress(const uint8_t* src, size_t size, Buffer& out)
+{
+	const size_t start = out.Size();
+	out.Reserve(start + CompressBound(size));
+
+	if (size < MinMatch + LastLiterals)
+	{
+		WriteSequence(out, src, size, 0, 0);
+		return out.Size() - start;
+	}
+
+	uint32_t table[1u << HashBits];
+	std::memset(table, 0xFF, sizeof(table));
+
+	const size_t matchLimit = size - LastLiterals;
+	size_t anchor = 0;
+	size_t pos = 0;
+
+	while (pos + MinMatch <= matchLimit)
+	{
+		const uint32_t seq = Read32(src + pos);
+		const uint32_t h = Hash(seq);
+		const uint32_t candidate = table[h];
+		table[h] = static_cast<uint32_t>(pos);
+
+		if (candidate == 0xFFFFFFFFu || pos - candidate > MaxOffset || Read32(src + candidate) != seq)
+		{
+			++pos;
+			continue;
+		}
+
+		size_t matchLen = MinMatch;
+		while (pos + matchLen < matchLimit && src[candidate + matchLen] == src[pos + matchLen])
+			++matchLen;
+
+		WriteSequence(out, src + anchor, pos - anchor, matchLen, pos - candidate);
+
+		pos += matchLen;
+		anchor = pos;
+	}
+
+	WriteSequence(out, src + anchor, size - anchor, 0, 0);
+	return out.Size() - start;
+}
+
+bool Boon::Compression::Decompress(const uint8_t* src, size_t size, uint8_t* dst, size_t rawSize)
+{
+	const uint8_t* ip = src;
+	const uint8_t* const ipEnd = src + size;
+	size_t op = 0;
+
+	while (ip < ipEnd)
+	{
+		const uint8_t token = *ip++;
+
+		size_t literalLen = token >> 4;
+		if (literalLen == 15 && !ReadLength(ip, ipEnd, literalLen))
+			return false;
+
+		if (literalLen > static_cast<size_t>(ipEnd - ip) || op + literalLen > rawSize)
+			return false;
+
+		std::memcpy(dst + op, ip, literalLen);
+		ip += literalLen;
+		op += literalLen;
+
+		if (ip == ipEnd)
+			break;
+
+		if (ipEnd - ip < 2)
+			return false;
+
+		const size_t offset = static_cast<size_t>(ip[0]) | (static_cast<size_t>(ip[1]) << 8);
+		ip += 2;
+
+		size_t matchLen = token & 0x0F;
+		if (matchLen == 15 && !ReadLength(ip, ipEnd, matchLen))
+			return false;
+		matchLen += MinMatch;
+
+		if (offset == 0 || offset > op || op + matchLen > rawSize)
+			return false;
+
+		// Byte copy: matches may overlap their own output
+		const uint8_t* match = dst + op - offset;
+		for (size_t i = 0; i < matchLen; ++i)
+			dst[op + i] = match[i];
+		op += matchLen;
+	}
+
+	return op == rawSize;
+}
@@ -0,0 +1,293 @@
+#include "Core/Threading/JobSystem.h"
+
+#include <algorithm>
+
+using namespace Boon;
+
+JobSystem* JobSystem::s_Instance = nullptr;
+
+namespace
+{
+	constexpr uint32_t SpinsBeforeSleep = 64;
+	constexpr size_t RingProbes = 16;
+
+	thread_local JobSystem* t_Owner = nullptr;
+	thread_local uint32_t t_QueueIndex = 0;
+
+	struct JobRing
+	{
+		std::unique_ptr<Job[]> Jobs;
+		size_t Next = 0;
+	};
+	thread_local JobRing t_JobRing;
+
+	class CounterLock
+	{
+	public:
+		explicit CounterLock(std::atomic<bool>& flag) : m_Flag(flag)
+		{
+			while (m_Flag.exchange(true, std::memory_order_acquire))
+			{
+				while (m_Flag.load(std::memory_order_relaxed))
+					std::this_thread::yield();
+			}
+		}
+		~CounterLock() { m_Flag.store(false, std::memory_order_release); }
+
+	private:
+		std::atomic<bool>& m_Flag;
+	};
+}
+
+JobSystem::JobSystem(uint32_t workerCount)
+	: m_RequestedWorkers(workerCount)
+{
+}
+
+JobSystem::~JobSystem()
+{
+	Stop();
+}
+
+void JobSystem::OnInit(EngineContext&)
+{
+	uint32_t workerCount = m_RequestedWorkers;
+#if defined(BOON_PLATFORM_WEB)
+	workerCount = 0;
+#else
+	if (workerCount == 0)
+	{
+		const uint32_t hw = std::thread::hardware_concurrency();
+		workerCount = hw > 1 ? hw - 1 : 0;
+	}
+#endif
+
+	m_Queues.clear();
+	for (uint32_t i = 0; i <= workerCount; ++i)
+		m_Queues.emplace_back(std::make_unique<ThreadQueue>());
+
+	t_Owner = this;
+	t_QueueIndex = 0;
+	s_Instance = this;
+
+	m_Running.store(true, std::memory_order_release);
+
+	m_Workers.reserve(workerCount);
+	for (uint32_t i = 1; i <= workerCount; ++i)
+		m_Workers.emplace_back([this, i]() { WorkerLoop(i); });
+}
+
+void JobSystem::OnShutdown(EngineContext&)
+{
+	Stop();
+}
+
+void JobSystem::Stop()
+{
+	if (!m_Running.exchange(false, std::memory_order_acq_rel))
+		return;
+
+	m_WakeEpoch.fetch_add(1, std::memory_order_release);
+	m_WakeEpoch.notify_all();
+
+	for (std::thread& worker : m_Workers)
+	{
+		if (worker.joinable())
+			worker.join();
+	}
+	m_Workers.clear();
+
+	// Whatever is still queued runs here so counters are never left hanging
+	while (Job* job = FindJob(0))
+		Execute(job);
+
+	if (s_Instance == this)
+		s_Instance = nullptr;
+	if (t_Owner == this)
+		t_Owner = nullptr;
+}
+
+void JobSystem::Wait(const JobCounter& counter)
+{
+	const uint32_t self = t_Owner == this ? t_QueueIndex : UINT32_MAX;
+
+	while (!counter.IsDone())
+	{
+		if (Job* job = FindJob(self))
+			Execute(job);
+		else
+			std::this_thread::yield();
+	}
+
+	// The thread that finished the last job may still be releasing the counter's lock;
+	// wait for it so the caller can safely destroy the counter.
+	CounterLock lock(counter.m_Lock);
+}
+
+Job* JobSystem::AllocateJob()
+{
+	JobRing& ring = t_JobRing;
+	if (!ring.Jobs)
+		ring.Jobs = std::make_unique<Job[]>(2 * JobsPerThread);
+
+	// Only the owning thread takes slots, any thread may hand them back after running the job
+	constexpr size_t mask = 2 * JobsPerThread - 1;
+	for (size_t probe = 0; probe < RingProbes; ++probe)
+	{
+		Job* job = &ring.Jobs[ring.Next];
+		ring.Next = (ring.Next + 1) & mask;
+
+		if (!job->InUse.load(std::memory_order_acquire))
+		{
+			job->InUse.store(true, std::memory_order_relaxed);
+			return job;
+		}
+	}
+
+	// Ring is full of queued, running or parked jobs
+	Job* job = new Job();
+	job->FromHeap = true;
+	return job;
+}
+
+void JobSystem::ReleaseJob(Job* job)
+{
+	if (job->FromHeap)
+		delete job;
+	else
+		job->InUse.store(false, std::memory_order_release);
+}
+
+void JobSystem::Submit(Job* job)
+{
+	if (!m_Running.load(std::memory_order_acquire) || m_Workers.empty())
+	{
+		Execute(job);
+		return;
+	}
+
+	bool queued = false;
+	if (t_Owner == this)
+		queued = m_Queues[t_QueueIndex]->Deque.Push(job);
+	else
+		queued = m_Injected.TryPush(job);
+
+	if (!queued)
+	{
+		Execute(job);
+		return;
+	}
+
+	WakeWorkers(1);
+}
+
+void JobSystem::AddContinuation(JobCounter& dependency, Job* job)
+{
+	{
+		CounterLock lock(dependency.m_Lock);
+		if (!dependency.IsDone())
+		{
+			dependency.m_Continuations.push_back(job);
+			return;
+		}
+	}
+
+	Submit(job);
+}
+
+void JobSystem::Execute(Job* job)
+{
+	job->Invoke(*job);
+	job->Destroy(*job);
+
+	JobCounter* counter = job->Counter;
+	ReleaseJob(job);
+
+	if (!counter)
+		return;
+
+	std::vector<Job*> ready;
+	{
+		CounterLock lock(counter->m_Lock);
+		if (counter->m_Pending.fetch_sub(1, std::memory_order_acq_rel) == 1 && !counter->m_Continuations.empty())
+			ready.swap(counter->m_Continuations);
+	}
+
+	for (Job* continuation : ready)
+		Submit(continuation);
+}
+
+Job* JobSystem::FindJob(uint32_t selfIndex)
+{
+	Job* job = nullptr;
+
+	if (selfIndex < m_Queues.size() && m_Queues[selfIndex]->Deque.Pop(job))
+		return job;
+
+	if (m_Injected.TryPop([&job](Job*& j) { job = j; }))
+		return job;
+
+	const size_t queueCount = m_Queues.size();
+	const size_t start = selfIndex < queueCount ? selfIndex + 1 : 0;
+	for (size_t i = 0; i < queueCount; ++i)
+	{
+		const size_t victim = (start + i) % queueCount;
+		if (victim == selfIndex)
+			continue;
+
+		if (m_Queues[victim]->Deque.Steal(job))
+			return job;
+	}
+
+	return nullptr;
+}
+
+void JobSystem::WorkerLoop(uint32_t index)
+{
+	t_Owner = this;
+	t_QueueIndex = index;
+
+	uint32_t idleSpins = 0;
+	while (m_Running.load(std::memory_order_acquire))
+	{
+		if (Job* job = FindJob(index))
+		{
+			Execute(job);
+			idleSpins = 0;
+			continue;
+		}
+
+		if (++idleSpins < SpinsBeforeSleep)
+		{
+			std::this_thread::yield();
+			continue;
+		}
+
+		const uint32_t epoch = m_WakeEpoch.load(std::memory_order_acquire);
+		m_Sleeping.fetch_add(1, std::memory_order_seq_cst);
+
+		// Re-check after announcing ourselves, a job may have been pushed in between
+		bool pending = !m_Injected.Empty();
+		for (size_t i = 0; i < m_Queues.size() && !pending; ++i)
+			pending = !m_Queues[i]->Deque.Empty();
+
+		if (!pending && m_Running.load(std::memory_order_acquire))
+			m_WakeEpoch.wait(epoch, std::memory_order_acquire);
+
+		m_Sleeping.fetch_sub(1, std::memory_order_relaxed);
+		idleSpins = 0;
+	}
+}
+
+void JobSystem::WakeWorkers(uint32_t count)
+{
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if (m_Sleeping.load(std::memory_order_relaxed) == 0)
+		return;
+
+	m_WakeEpoch.fetch_add(1, std::memory_order_release);
+	if (count == 1)
+		m_WakeEpoch.notify_one();
+	else
+		m_WakeEpoch.notify_all();
+}
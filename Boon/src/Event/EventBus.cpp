@@ -1,3 +1,48 @@
 #include "Event/EventBus.h"
 
-using namespace Boon;
\ No newline at end of file
+using namespace Boon;
+
+EventBus::EventBus()
+{
+	m_WorkerThread = std::thread([this]() { ProcessQueueThread(); });
+}
+
+EventBus::~EventBus()
+{
+	m_Stop.store(true, std::memory_order_release);
+	m_WakeEpoch.fetch_add(1, std::memory_order_release);
+	m_WakeEpoch.notify_one();
+
+	if (m_WorkerThread.joinable())
+		m_WorkerThread.join();
+}
+
+void EventBus::WakeWorker()
+{
+	m_WakeEpoch.fetch_add(1, std::memory_order_seq_cst);
+
+	// Only pay for the wake call when the worker actually went to sleep
+	if (m_WorkerWaiting.load(std::memory_order_seq_cst))
+		m_WakeEpoch.notify_one();
+}
+
+void EventBus::ProcessQueueThread()
+{
+	while (true)
+	{
+		while (m_EventQueue.TryPop([this](PostedEvent& e) { e.Dispatch(*this); }))
+		{
+		}
+
+		if (m_Stop.load(std::memory_order_acquire) && m_EventQueue.Empty())
+			break;
+
+		const uint32_t epoch = m_WakeEpoch.load(std::memory_order_acquire);
+
+		m_WorkerWaiting.store(true, std::memory_order_seq_cst);
+		// A producer may have pushed between draining and publishing the wait flag
+		if (m_EventQueue.Empty() && !m_Stop.load(std::memory_order_acquire))
+			m_WakeEpoch.wait(epoch, std::memory_order_acquire);
+		m_WorkerWaiting.store(false, std::memory_order_relaxed);
+	}
+}
@@ -5,14 +5,245 @@
 
 #include "Component/Rigidbody2D.h"
 #include "Component/BoxCollider2D.h"
+#include "Component/TilemapCollider2D.h"
+#include "Component/TilemapRendererComponent.h"
 
 #include "Core/EngineContext.h"
 #include "Core/Time.h"
+#include "Core/Threading/JobSystem.h"
 
+#include "Project/RuntimeConfig.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
 #include <iostream>
 
 using namespace Boon;
 
+namespace
+{
+	// b2_maxWorkers
+	constexpr uint32_t MaxPhysicsWorkers = 64;
+
+	void ApplyPendingCommands(Rigidbody2D& rb, b2BodyId body)
+	{
+		if (rb.HasPendingSetTransform)
+		{
+			b2Body_SetTransform(
+				body,
+				{ rb.PendingSetPosition.x, rb.PendingSetPosition.y },
+				b2MakeRot(glm::radians(rb.PendingSetRotation))
+			);
+
+			// No move event comes for a body that does not move afterwards, and a teleport is not interpolated
+			rb.Position = rb.PendingSetPosition;
+			rb.Rotation = rb.PendingSetRotation;
+			rb.PreviousPosition = rb.Position;
+			rb.PreviousRotation = rb.Rotation;
+			rb.HasPendingSetTransform = false;
+		}
+
+		if (rb.HasPendingSetVelocity)
+		{
+			b2Body_SetLinearVelocity(body, { rb.PendingSetVelocity.x, rb.PendingSetVelocity.y });
+			rb.HasPendingSetVelocity = false;
+		}
+
+		if (rb.HasPendingSetAngularVelocity)
+		{
+			b2Body_SetAngularVelocity(body, rb.PendingSetAngularVelocity);
+			rb.HasPendingSetAngularVelocity = false;
+		}
+
+		if (rb.PendingForce != glm::vec2(0.0f))
+		{
+			b2Body_ApplyForceToCenter(body, { rb.PendingForce.x, rb.PendingForce.y }, rb.WakeRequested);
+			rb.PendingForce = {};
+		}
+
+		if (rb.PendingImpulse != glm::vec2(0.0f))
+		{
+			b2Body_ApplyLinearImpulseToCenter(body, { rb.PendingImpulse.x, rb.PendingImpulse.y }, rb.WakeRequested);
+			rb.PendingImpulse = {};
+		}
+
+		if (rb.PendingTorque != 0.0f)
+		{
+			b2Body_ApplyTorque(body, rb.PendingTorque, rb.WakeRequested);
+			rb.PendingTorque = 0.0f;
+		}
+
+		rb.WakeRequested = false;
+		rb.HasPendingCommands = false;
+	}
+
+	b2QueryFilter ToBox2DFilter(const QueryFilter2D& filter)
+	{
+		b2QueryFilter out = b2DefaultQueryFilter();
+		out.categoryBits = filter.CategoryBits;
+		out.maskBits = filter.MaskBits;
+		return out;
+	}
+
+	HitResult2D MakeHit(b2ShapeId shape, b2Vec2 point, b2Vec2 normal, float distance)
+	{
+		const b2BodyId body = b2Shape_GetBody(shape);
+
+		HitResult2D hit{};
+		hit.gameObject = static_cast<GameObjectID>(reinterpret_cast<uintptr_t>(b2Body_GetUserData(body)));
+		hit.point = { point.x, point.y };
+		hit.normal = { normal.x, normal.y };
+		hit.distance = distance;
+		return hit;
+	}
+
+	b2ShapeProxy MakeProxy(const ShapeCast2D& cast)
+	{
+		const b2Vec2 center{ cast.Center.x, cast.Center.y };
+		const b2Rot rotation = b2MakeRot(glm::radians(cast.Rotation));
+
+		if (cast.HalfExtents.x <= 0.0f && cast.HalfExtents.y <= 0.0f)
+		{
+			const b2Vec2 origin{ 0.0f, 0.0f };
+			return b2MakeOffsetProxy(&origin, 1, cast.Radius, center, rotation);
+		}
+
+		const b2Vec2 corners[4]{
+			{ -cast.HalfExtents.x, -cast.HalfExtents.y },
+			{  cast.HalfExtents.x, -cast.HalfExtents.y },
+			{  cast.HalfExtents.x,  cast.HalfExtents.y },
+			{ -cast.HalfExtents.x,  cast.HalfExtents.y }
+		};
+		return b2MakeOffsetProxy(corners, 4, cast.Radius, center, rotation);
+	}
+
+	/**
+	 * @brief Keeps the closest hits of one cast in a fixed slice of the caller's buffer.
+	 *
+	 * Once the slice is full the cast is clipped to the farthest kept hit, so
+	 * Box2D stops reporting anything that would not make it in.
+	 */
+	struct HitCollector
+	{
+		HitResult2D* Hits;
+		uint32_t Max;
+		float Length;
+		uint32_t Count = 0;
+
+		static float OnHit(b2ShapeId shape, b2Vec2 point, b2Vec2 normal, float fraction, void* context)
+		{
+			HitCollector& self = *static_cast<HitCollector*>(context);
+			const HitResult2D hit = MakeHit(shape, point, normal, fraction * self.Length);
+
+			if (self.Count < self.Max)
+			{
+				self.Hits[self.Count++] = hit;
+				return self.Count < self.Max ? 1.0f : self.FarthestFraction();
+			}
+
+			HitResult2D* farthest = std::max_element(self.Hits, self.Hits + self.Count,
+				[](const HitResult2D& a, const HitResult2D& b) { return a.distance < b.distance; });
+
+			if (hit.distance < farthest->distance)
+				*farthest = hit;
+
+			return self.FarthestFraction();
+		}
+
+		float FarthestFraction() const
+		{
+			if (Length <= 0.0f)
+				return 0.0f;
+
+			float farthest = 0.0f;
+			for (uint32_t i = 0; i < Count; ++i)
+				farthest = std::max(farthest, Hits[i].distance);
+			return farthest / Length;
+		}
+
+		uint32_t Finish()
+		{
+			std::sort(Hits, Hits + Count, [](const HitResult2D& a, const HitResult2D& b) { return a.distance < b.distance; });
+			return Count;
+		}
+	};
+
+	struct OverlapCollector
+	{
+		GameObjectID* Hits;
+		uint32_t Max;
+		uint32_t Count = 0;
+
+		static bool OnOverlap(b2ShapeId shape, void* context)
+		{
+			OverlapCollector& self = *static_cast<OverlapCollector*>(context);
+
+			const b2BodyId body = b2Shape_GetBody(shape);
+			const GameObjectID id = static_cast<GameObjectID>(reinterpret_cast<uintptr_t>(b2Body_GetUserData(body)));
+
+			// Every shape of a body overlaps on its own, report the object once
+			if (std::find(self.Hits, self.Hits + self.Count, id) != self.Hits + self.Count)
+				return true;
+
+			self.Hits[self.Count++] = id;
+			return self.Count < self.Max;
+		}
+	};
+
+	/**
+	 * @brief Run query(i) for every query, in batches on the job threads when there are enough.
+	 */
+	template<typename Fn>
+	void RunQueries(size_t count, Fn&& query)
+	{
+		constexpr size_t BatchSize = 32;
+
+		JobSystem* jobs = JobSystem::Get();
+		if (!jobs || count <= BatchSize)
+		{
+			for (size_t i = 0; i < count; ++i)
+				query(i);
+			return;
+		}
+
+		jobs->ParallelFor(count, BatchSize, [&](size_t begin, size_t end)
+			{
+				for (size_t i = begin; i < end; ++i)
+					query(i);
+			});
+	}
+
+	void WritePose(TransformComponent& transform, const Rigidbody2D& rb, const glm::vec2& position, float rotation)
+	{
+		glm::vec3 pos3 = transform.GetWorldPosition();
+		pos3.x = position.x;
+		pos3.y = position.y;
+		transform.SetLocalPosition(pos3);
+
+		if (!rb.FixedRotation)
+			transform.SetLocalRotation({ 0.f, 0.f, rotation });
+	}
+}
+
+/**
+ * @brief Completion counters for the tasks Box2D enqueues during one step.
+ *
+ * Box2D enqueues and finishes tasks from the stepping thread only, and every
+ * task is finished before b2World_Step returns, so the slots are handed out
+ * in order and recycled at the start of the next step.
+ */
+struct PhysicsWorld2D::TaskPool
+{
+	static constexpr int MaxTasks = 2 * MaxPhysicsWorkers;
+
+	JobSystem* Jobs = nullptr;
+	uint32_t WorkerCount = 1;
+
+	std::array<JobCounter, MaxTasks> Counters;
+	int Next = 0;
+};
+
 Boon::PhysicsWorld2D::~PhysicsWorld2D()
 {
 	if (b2World_IsValid(m_PhysicsWorldId))
@@ -29,25 +260,73 @@ void Boon::PhysicsWorld2D::Begin(Scene* pScene)
 
 	b2WorldDef worldDef = b2DefaultWorldDef();
 	worldDef.gravity = { 0.0f, -9.8f };
+
+	// Box2D's solver workers wait on each other, so never ask for more than there are threads to run them
+	JobSystem* jobs = JobSystem::Get();
+	const uint32_t available = jobs ? jobs->GetWorkerCount() + 1 : 1;
+
+	const RuntimeConfig* config = pScene->GetEngineContext().ProjectConfig;
+	const uint32_t requested = config ? config->Physics.WorkerCount : 0;
+
+	m_WorkerCount = std::min(requested == 0 ? available : std::min(requested, available), MaxPhysicsWorkers);
+
+	if (m_WorkerCount > 1)
+	{
+		m_pTasks = std::make_unique<TaskPool>();
+		m_pTasks->Jobs = jobs;
+		m_pTasks->WorkerCount = m_WorkerCount;
+
+		worldDef.workerCount = static_cast<int>(m_WorkerCount);
+		worldDef.enqueueTask = &PhysicsWorld2D::EnqueueTask;
+		worldDef.finishTask = &PhysicsWorld2D::FinishTask;
+		worldDef.userTaskContext = m_pTasks.get();
+	}
+
 	m_PhysicsWorldId = b2CreateWorld(&worldDef);
 
+	SceneRegistry& registry = pScene->m_Registry;
+	registry.on_construct<Rigidbody2D>().connect<&PhysicsWorld2D::OnRigidbodyAdded>(*this);
+	registry.on_destroy<Rigidbody2D>().connect<&PhysicsWorld2D::OnRigidbodyRemoved>(*this);
+	registry.on_destroy<TilemapCollider2D>().connect<&PhysicsWorld2D::OnTilemapColliderRemoved>(*this);
+
 	auto view = pScene->GetAllGameObjectsWith<Rigidbody2D>();
 	for (auto e : view)
 	{
 		GameObject gameObject( e, pScene);
 		SpawnRigidbody(&gameObject);
 	}
+
+	SyncTilemapColliders(pScene);
 }
 
-void Boon::PhysicsWorld2D::End(Scene*)
+void Boon::PhysicsWorld2D::End(Scene* pScene)
 {
-	m_RigidbodyRuntime = {};
+	SceneRegistry& registry = pScene->m_Registry;
+	registry.on_construct<Rigidbody2D>().disconnect<&PhysicsWorld2D::OnRigidbodyAdded>(*this);
+	registry.on_destroy<Rigidbody2D>().disconnect<&PhysicsWorld2D::OnRigidbodyRemoved>(*this);
+	registry.on_destroy<TilemapCollider2D>().disconnect<&PhysicsWorld2D::OnTilemapColliderRemoved>(*this);
+
+	for (auto [entity, rb] : registry.view<Rigidbody2D>().each())
+		rb.BodyHandle = 0;
+
+	for (auto [entity, collider] : registry.view<TilemapCollider2D>().each())
+	{
+		collider.BodyCount = 0;
+		collider.ShapeCount = 0;
+	}
+
+	m_PendingSpawns.clear();
+	m_Interpolated.clear();
+	m_TilemapColliders.clear();
 
 	if (b2World_IsValid(m_PhysicsWorldId))
 	{
 		b2DestroyWorld(m_PhysicsWorldId);
 		m_PhysicsWorldId = b2_nullWorldId;
 	}
+
+	m_pTasks.reset();
+	m_WorkerCount = 1;
 }
 
 void PhysicsWorld2D::Step(Scene* pScene)
@@ -55,143 +334,270 @@ void PhysicsWorld2D::Step(Scene* pScene)
 	if (!b2World_IsValid(m_PhysicsWorldId))
 		return;
 
-	pScene->ForeachGameObjectWith<Rigidbody2D, TransformComponent>(
-		[this](GameObject obj)
-		{
-			auto id = (GameObjectID)obj;
-			auto& rb = obj.GetComponent<Rigidbody2D>();
-			auto& transform = obj.GetTransform();
+	SceneRegistry& registry = pScene->m_Registry;
 
-			auto* runtime = GetRuntime(id);
-			if (!runtime || !b2Body_IsValid(runtime->Body))
-			{
-				SpawnRigidbody(&obj);
-				runtime = GetRuntime(id);
-				if (!runtime) return;
-			}
+	for (GameObjectID id : m_PendingSpawns)
+	{
+		if (!registry.valid(id) || !registry.all_of<Rigidbody2D, TransformComponent>(id))
+			continue;
 
-			b2BodyId body = runtime->Body;
+		GameObject gameObject(id, pScene);
+		SpawnRigidbody(&gameObject);
+	}
+	m_PendingSpawns.clear();
 
-			if (rb.HasPendingSetTransform)
-			{
-				b2Body_SetTransform(
-					body,
-					{ rb.PendingSetPosition.x, rb.PendingSetPosition.y },
-					b2MakeRot(glm::radians(rb.PendingSetRotation))
-				);
-				rb.HasPendingSetTransform = false;
-			}
+	SyncTilemapColliders(pScene);
 
-			if (rb.HasPendingSetVelocity)
-			{
-				b2Body_SetLinearVelocity(body, { rb.PendingSetVelocity.x, rb.PendingSetVelocity.y });
-				rb.HasPendingSetVelocity = false;
-			}
+	// Bodies that stop moving get no more events; leave them at their final pose rather than mid-interpolation
+	for (GameObjectID id : m_Interpolated)
+	{
+		if (!registry.valid(id))
+			continue;
 
-			if (rb.HasPendingSetAngularVelocity)
-			{
-				b2Body_SetAngularVelocity(body, rb.PendingSetAngularVelocity);
-				rb.HasPendingSetAngularVelocity = false;
-			}
+		Rigidbody2D* rb = registry.try_get<Rigidbody2D>(id);
+		if (rb && (Rigidbody2D::BodyType)rb->Type == Rigidbody2D::BodyType::Dynamic)
+			WritePose(registry.get<TransformComponent>(id), *rb, rb->Position, rb->Rotation);
+	}
+	m_Interpolated.clear();
 
-			if (rb.PendingForce != glm::vec2(0.0f))
-			{
-				b2Body_ApplyForceToCenter(body, { rb.PendingForce.x, rb.PendingForce.y }, rb.WakeRequested);
-				rb.PendingForce = {};
-			}
+	// Straight over the component array: only bodies with requests or driven by their transform do any work
+	for (auto [entity, rb] : registry.view<Rigidbody2D>().each())
+	{
+		const bool kinematic = (Rigidbody2D::BodyType)rb.Type == Rigidbody2D::BodyType::Kinematic;
+		if (!rb.HasPendingCommands && !kinematic)
+			continue;
 
-			if (rb.PendingImpulse != glm::vec2(0.0f))
-			{
-				b2Body_ApplyLinearImpulseToCenter(body, { rb.PendingImpulse.x, rb.PendingImpulse.y }, rb.WakeRequested);
-				rb.PendingImpulse = {};
-			}
+		const b2BodyId body = GetBody(rb);
+		if (B2_IS_NULL(body))
+			continue;
 
-			if (rb.PendingTorque != 0.0f)
-			{
-				b2Body_ApplyTorque(body, rb.PendingTorque, rb.WakeRequested);
-				rb.PendingTorque = 0.0f;
-			}
+		if (rb.HasPendingCommands)
+			ApplyPendingCommands(rb, body);
 
-			rb.WakeRequested = false;
+		if (kinematic)
+		{
+			auto& transform = registry.get<TransformComponent>(entity);
 
-			if ((Rigidbody2D::BodyType)rb.Type == Rigidbody2D::BodyType::Kinematic)
-			{
-				glm::vec3 pos = transform.GetWorldPosition();
-				glm::vec3 rot = transform.GetWorldEulerRotation();
+			glm::vec3 pos = transform.GetWorldPosition();
+			glm::vec3 rot = transform.GetWorldEulerRotation();
 
-				b2Body_SetTransform(body, { pos.x, pos.y }, b2MakeRot(glm::radians(rot.z)));
-			}
-		});
+			b2Body_SetTransform(body, { pos.x, pos.y }, b2MakeRot(glm::radians(rot.z)));
+		}
+	}
+
+	if (m_pTasks)
+		m_pTasks->Next = 0;
 
 	Time& time = *pScene->GetEngineContext().Time;
 	b2World_Step(m_PhysicsWorldId, time.GetFixedTimeStep(), 3);
 
-	pScene->ForeachGameObjectWith<Rigidbody2D, TransformComponent>(
-		[this](GameObject obj)
+	SyncMovedBodies(pScene);
+	HandleEvents(pScene);
+}
+
+void Boon::PhysicsWorld2D::Update(Scene* pScene)
+{
+	if (!b2World_IsValid(m_PhysicsWorldId) || m_Interpolated.empty())
+		return;
+
+	SceneRegistry& registry = pScene->m_Registry;
+	const float alpha = pScene->GetEngineContext().Time->GetInterpolationAlpha();
+
+	for (GameObjectID id : m_Interpolated)
+	{
+		if (!registry.valid(id))
+			continue;
+
+		Rigidbody2D* rb = registry.try_get<Rigidbody2D>(id);
+		if (!rb)
+			continue;
+
+		// Shortest way round, so 179 to -179 turns two degrees rather than 358
+		float deltaRotation = std::fmod(rb->Rotation - rb->PreviousRotation + 540.0f, 360.0f) - 180.0f;
+
+		const glm::vec2 position = glm::mix(rb->PreviousPosition, rb->Position, alpha);
+		const float rotation = rb->PreviousRotation + deltaRotation * alpha;
+
+		WritePose(registry.get<TransformComponent>(id), *rb, position, rotation);
+	}
+}
+
+bool Boon::PhysicsWorld2D::Raycast(const Ray2D& ray, HitResult2D& result, const QueryFilter2D& filter) const
+{
+	if (!b2World_IsValid(m_PhysicsWorldId))
+		return false;
+
+	// Box2D takes the ray as origin plus displacement, not an end point
+	const b2Vec2 origin{ ray.Origin.x, ray.Origin.y };
+	const b2Vec2 translation{ ray.Direction.x * ray.Distance, ray.Direction.y * ray.Distance };
+
+	b2RayResult out = b2World_CastRayClosest(m_PhysicsWorldId, origin, translation, ToBox2DFilter(filter));
+	if (out.hit)
+		result = MakeHit(out.shapeId, out.point, out.normal, out.fraction * b2Length(translation));
+
+	return out.hit;
+}
+
+void Boon::PhysicsWorld2D::RaycastBatch(std::span<const Ray2D> rays, std::span<HitResult2D> hits, std::span<uint32_t> hitCounts,
+	uint32_t maxHitsPerRay, const QueryFilter2D& filter) const
+{
+	if (maxHitsPerRay == 0 || hits.size() < rays.size() * maxHitsPerRay || hitCounts.size() < rays.size())
+		return;
+
+	const b2QueryFilter b2Filter = ToBox2DFilter(filter);
+
+	RunQueries(rays.size(), [&](size_t i)
 		{
-			auto id = (GameObjectID)obj;
-			auto* runtime = GetRuntime(id);
-			if (!runtime || !b2Body_IsValid(runtime->Body))
+			hitCounts[i] = 0;
+			if (!b2World_IsValid(m_PhysicsWorldId))
 				return;
 
-			auto& rb = obj.GetComponent<Rigidbody2D>();
-			auto& transform = obj.GetTransform();
+			const Ray2D& ray = rays[i];
+			const b2Vec2 translation{ ray.Direction.x * ray.Distance, ray.Direction.y * ray.Distance };
+
+			HitCollector collector{ &hits[i * maxHitsPerRay], maxHitsPerRay, b2Length(translation) };
+			b2World_CastRay(m_PhysicsWorldId, { ray.Origin.x, ray.Origin.y }, translation, b2Filter, &HitCollector::OnHit, &collector);
+
+			hitCounts[i] = collector.Finish();
+		});
+}
+
+void Boon::PhysicsWorld2D::ShapeCastBatch(std::span<const ShapeCast2D> casts, std::span<HitResult2D> hits, std::span<uint32_t> hitCounts,
+	uint32_t maxHitsPerCast, const QueryFilter2D& filter) const
+{
+	if (maxHitsPerCast == 0 || hits.size() < casts.size() * maxHitsPerCast || hitCounts.size() < casts.size())
+		return;
+
+	const b2QueryFilter b2Filter = ToBox2DFilter(filter);
 
-			b2BodyId body = runtime->Body;
-			b2Transform t = b2Body_GetTransform(body);
+	RunQueries(casts.size(), [&](size_t i)
+		{
+			hitCounts[i] = 0;
+			if (!b2World_IsValid(m_PhysicsWorldId))
+				return;
 
-			rb.Position = { t.p.x, t.p.y };
-			rb.Rotation = glm::degrees(b2Rot_GetAngle(t.q));
+			const ShapeCast2D& cast = casts[i];
+			const b2Vec2 translation{ cast.Direction.x * cast.Distance, cast.Direction.y * cast.Distance };
 
-			b2Vec2 vel = b2Body_GetLinearVelocity(body);
-			rb.Velocity = { vel.x, vel.y };
-			rb.AngularVelocity = b2Body_GetAngularVelocity(body);
-			rb.Awake = b2Body_IsAwake(body);
+			const b2ShapeProxy proxy = MakeProxy(cast);
 
-			if ((Rigidbody2D::BodyType)rb.Type == Rigidbody2D::BodyType::Dynamic)
-			{
-				glm::vec3 pos3 = transform.GetWorldPosition();
-				pos3.x = rb.Position.x;
-				pos3.y = rb.Position.y;
-				transform.SetLocalPosition(pos3);
+			HitCollector collector{ &hits[i * maxHitsPerCast], maxHitsPerCast, b2Length(translation) };
+			b2World_CastShape(m_PhysicsWorldId, &proxy, translation, b2Filter, &HitCollector::OnHit, &collector);
 
-				if (!rb.FixedRotation)
-					transform.SetLocalRotation({ 0.f, 0.f, rb.Rotation });
-			}
+			hitCounts[i] = collector.Finish();
 		});
+}
 
-	HandleEvents(pScene);
+void Boon::PhysicsWorld2D::OverlapBatch(std::span<const AABB2D> boxes, std::span<GameObjectID> hits, std::span<uint32_t> hitCounts,
+	uint32_t maxHitsPerBox, const QueryFilter2D& filter) const
+{
+	if (maxHitsPerBox == 0 || hits.size() < boxes.size() * maxHitsPerBox || hitCounts.size() < boxes.size())
+		return;
+
+	const b2QueryFilter b2Filter = ToBox2DFilter(filter);
+
+	RunQueries(boxes.size(), [&](size_t i)
+		{
+			hitCounts[i] = 0;
+			if (!b2World_IsValid(m_PhysicsWorldId))
+				return;
+
+			const AABB2D& box = boxes[i];
+
+			OverlapCollector collector{ &hits[i * maxHitsPerBox], maxHitsPerBox };
+			b2World_OverlapAABB(m_PhysicsWorldId, { { box.Min.x, box.Min.y }, { box.Max.x, box.Max.y } }, b2Filter, &OverlapCollector::OnOverlap, &collector);
+
+			hitCounts[i] = collector.Count;
+		});
 }
 
-void Boon::PhysicsWorld2D::Update(Scene*)
+float Boon::PhysicsWorld2D::GetStepMilliseconds() const
 {
 	if (!b2World_IsValid(m_PhysicsWorldId))
-		return;
+		return 0.0f;
+
+	return b2World_GetProfile(m_PhysicsWorldId).step;
 }
 
-bool Boon::PhysicsWorld2D::Raycast(const Ray2D& ray, HitResult2D& result) const
+void Boon::PhysicsWorld2D::SyncMovedBodies(Scene* pScene)
 {
-	b2RayCastInput b2Ray;
-	b2Ray.origin = { ray.Origin.x, ray.Origin.y };
-	b2Ray.translation = { ray.Origin.x + ray.Direction.x * ray.Distance, ray.Origin.y + ray.Direction.y * ray.Distance };
-	b2Ray.maxFraction = 1.0f;
+	SceneRegistry& registry = pScene->m_Registry;
 
-	b2QueryFilter filter{b2DefaultQueryFilter()};
+	// Box2D reports every body that moved this step; sleeping bodies are never touched
+	const b2BodyEvents events = b2World_GetBodyEvents(m_PhysicsWorldId);
+	for (int i = 0; i < events.moveCount; ++i)
+	{
+		const b2BodyMoveEvent& ev = events.moveEvents[i];
+		const GameObjectID id = static_cast<GameObjectID>(reinterpret_cast<uintptr_t>(ev.userData));
 
-	if (!b2World_IsValid(m_PhysicsWorldId))
-		return false;
+		Rigidbody2D* rb = registry.try_get<Rigidbody2D>(id);
+		if (!rb)
+			continue;
 
-	b2RayResult out = b2World_CastRayClosest(m_PhysicsWorldId, b2Ray.origin, b2Ray.translation, filter);
-	if (out.hit)
+		rb->PreviousPosition = rb->Position;
+		rb->PreviousRotation = rb->Rotation;
+
+		rb->Position = { ev.transform.p.x, ev.transform.p.y };
+		rb->Rotation = glm::degrees(b2Rot_GetAngle(ev.transform.q));
+
+		const b2Vec2 vel = b2Body_GetLinearVelocity(ev.bodyId);
+		rb->Velocity = { vel.x, vel.y };
+		rb->AngularVelocity = b2Body_GetAngularVelocity(ev.bodyId);
+		rb->Awake = !ev.fellAsleep;
+
+		if ((Rigidbody2D::BodyType)rb->Type == Rigidbody2D::BodyType::Dynamic)
+		{
+			WritePose(registry.get<TransformComponent>(id), *rb, rb->Position, rb->Rotation);
+
+			if (rb->Interpolate)
+				m_Interpolated.push_back(id);
+		}
+	}
+}
+
+void* Boon::PhysicsWorld2D::EnqueueTask(void (*task)(int, int, uint32_t, void*), int itemCount, int minRange, void* taskContext, void* userContext)
+{
+	TaskPool& pool = *static_cast<TaskPool*>(userContext);
+
+	// Returning null tells Box2D the task already ran
+	if (itemCount <= 0)
+		return nullptr;
+
+	if (pool.Next >= TaskPool::MaxTasks)
 	{
-		result.point = { out.point.x, out.point.y };
-		result.normal = { out.normal.x, out.normal.y };
+		task(0, itemCount, 0, taskContext);
+		return nullptr;
+	}
 
-		b2BodyId body = b2Shape_GetBody(out.shapeId);
-		result.gameObject = static_cast<GameObjectID>(reinterpret_cast<uintptr_t>(b2Body_GetUserData(body)));
+	JobCounter& counter = pool.Counters[pool.Next++];
+
+	// One range per worker at most; the block index doubles as the worker index,
+	// which Box2D uses to pick per-worker scratch state and must stay below workerCount
+	const int rangeSize = std::max(minRange, 1);
+	const int blockCount = std::min(static_cast<int>(pool.WorkerCount), (itemCount + rangeSize - 1) / rangeSize);
+	const int blockSize = (itemCount + blockCount - 1) / blockCount;
+
+	for (int block = 0; block < blockCount; ++block)
+	{
+		const int start = block * blockSize;
+		const int end = std::min(start + blockSize, itemCount);
+		if (start >= end)
+			break;
+
+		// Never run inline here: the solver enqueues one long task per worker and they only finish together
+		pool.Jobs->Schedule([task, start, end, block, taskContext]()
+			{
+				task(start, end, static_cast<uint32_t>(block), taskContext);
+			}, &counter);
 	}
 
-	return out.hit;
+	return &counter;
+}
+
+void Boon::PhysicsWorld2D::FinishTask(void* userTask, void* userContext)
+{
+	TaskPool& pool = *static_cast<TaskPool*>(userContext);
+	pool.Jobs->Wait(*static_cast<JobCounter*>(userTask));
 }
 
 void Boon::PhysicsWorld2D::HandleEvents(Scene* pScene)
@@ -241,6 +647,10 @@ void PhysicsWorld2D::SpawnRigidbody(GameObject* obj)
 	auto& transform = obj->GetComponent<TransformComponent>();
 	auto& rb = obj->GetComponent<Rigidbody2D>();
 
+	// Pending spawns can list an object twice, or one that Begin already spawned
+	if (B2_IS_NON_NULL(GetBody(rb)))
+		return;
+
 	b2BodyDef bodyDef = b2DefaultBodyDef();
 	bodyDef.type = Rigidbody2DTypeToBox2DBody((Rigidbody2D::BodyType)rb.Type);
 	bodyDef.position = { transform.GetLocalPosition().x, transform.GetLocalPosition().y };
@@ -250,15 +660,18 @@ void PhysicsWorld2D::SpawnRigidbody(GameObject* obj)
 	bodyDef.linearDamping = rb.LinearDamping;
 	bodyDef.angularDamping = rb.AngularDamping;
 
-	RigidbodyRuntime runtime;
-	runtime.Body = b2CreateBody(m_PhysicsWorldId, &bodyDef);
-	runtime.Valid = b2Body_IsValid(runtime.Body);
+	const b2BodyId body = b2CreateBody(m_PhysicsWorldId, &bodyDef);
+	rb.BodyHandle = b2StoreBodyId(body);
 
-	b2MassData massData = b2Body_GetMassData(runtime.Body);
-	massData.mass = rb.GetMass();
-	b2Body_SetMassData(runtime.Body, massData);
+	// First interpolation starts where the body was spawned
+	rb.Position = { bodyDef.position.x, bodyDef.position.y };
+	rb.Rotation = glm::degrees(b2Rot_GetAngle(bodyDef.rotation));
+	rb.PreviousPosition = rb.Position;
+	rb.PreviousRotation = rb.Rotation;
 
-	m_RigidbodyRuntime[id] = runtime;
+	b2MassData massData = b2Body_GetMassData(body);
+	massData.mass = rb.GetMass();
+	b2Body_SetMassData(body, massData);
 
 	if (obj->HasComponent<BoxCollider2D>())
 	{
@@ -270,6 +683,8 @@ void PhysicsWorld2D::SpawnRigidbody(GameObject* obj)
 		shapeDef.enableSensorEvents = true;
 		shapeDef.material.friction = bc2d.Friction;
 		shapeDef.material.restitution = bc2d.Restitution;
+		shapeDef.filter.categoryBits = bc2d.CategoryBits;
+		shapeDef.filter.maskBits = bc2d.MaskBits;
 
 		glm::vec3 scale = transform.GetWorldScale();
 		b2Polygon box = b2MakeBox(
@@ -277,16 +692,173 @@ void PhysicsWorld2D::SpawnRigidbody(GameObject* obj)
 			bc2d.Size.y * scale.y * 0.5f
 		);
 
-		b2CreatePolygonShape(runtime.Body, &shapeDef, &box);
+		b2CreatePolygonShape(body, &shapeDef, &box);
 	}
 
 	rb.DirtyBodyDef = false;
 }
 
-PhysicsWorld2D::RigidbodyRuntime* PhysicsWorld2D::GetRuntime(GameObjectID id)
+void PhysicsWorld2D::OnRigidbodyAdded(entt::registry&, GameObjectID id)
 {
-	auto it = m_RigidbodyRuntime.find(id);
-	if (it == m_RigidbodyRuntime.end())
-		return nullptr;
-	return &it->second;
+	// Properties are usually set right after the component is added, so spawn on the next step
+	m_PendingSpawns.push_back(id);
+}
+
+void PhysicsWorld2D::OnRigidbodyRemoved(entt::registry& registry, GameObjectID id)
+{
+	Rigidbody2D& rb = registry.get<Rigidbody2D>(id);
+
+	const b2BodyId body = GetBody(rb);
+	if (B2_IS_NON_NULL(body))
+		b2DestroyBody(body);
+
+	rb.BodyHandle = 0;
+}
+
+void PhysicsWorld2D::SyncTilemapColliders(Scene* pScene)
+{
+	SceneRegistry& registry = pScene->m_Registry;
+
+	std::vector<TileRect> rects;
+
+	auto view = registry.view<TilemapCollider2D, TilemapRendererComponent, TransformComponent>();
+	for (auto [entity, collider, renderer, transform] : view.each())
+	{
+		TilemapColliderRuntime& runtime = m_TilemapColliders[entity];
+
+		const std::shared_ptr<Tilemap> map = renderer.tilemap.IsValid() ? renderer.tilemap->GetInstance() : nullptr;
+		if (!map)
+		{
+			DestroyTilemapBodies(runtime);
+			runtime.Source = nullptr;
+			collider.BodyCount = 0;
+			collider.ShapeCount = 0;
+			continue;
+		}
+
+		// Nothing painted, streamed or evicted since the last build
+		if (runtime.Source == map.get() && runtime.Revision == map->GetRevision() &&
+			runtime.UnitSize == map->GetUnitSize() && runtime.ChunkSize == map->GetChunkSize())
+			continue;
+
+		if (runtime.Source != map.get() || runtime.UnitSize != map->GetUnitSize() || runtime.ChunkSize != map->GetChunkSize())
+			DestroyTilemapBodies(runtime);
+
+		runtime.Source = map.get();
+		runtime.Revision = map->GetRevision();
+		runtime.UnitSize = map->GetUnitSize();
+		runtime.ChunkSize = map->GetChunkSize();
+
+		const Tilemap::ChunkMap& chunks = map->GetChunks();
+
+		// Chunks evicted by streaming or dropped by a resize
+		for (auto it = runtime.Chunks.begin(); it != runtime.Chunks.end();)
+		{
+			if (chunks.find(it->first) == chunks.end())
+			{
+				if (b2Body_IsValid(it->second.Body))
+					b2DestroyBody(it->second.Body);
+				it = runtime.Chunks.erase(it);
+			}
+			else
+				++it;
+		}
+
+		const float unit = map->GetUnitSize();
+		const int chunkSize = map->GetChunkSize();
+
+		const glm::vec3 position = transform.GetWorldPosition();
+		const glm::vec3 rotation = transform.GetWorldEulerRotation();
+		const glm::vec3 scale = transform.GetWorldScale();
+
+		for (const auto& [key, chunk] : chunks)
+		{
+			TilemapChunkBody& chunkBody = runtime.Chunks[key];
+			if (chunkBody.Revision == chunk.Revision)
+				continue;
+
+			chunkBody.Revision = chunk.Revision;
+
+			if (b2Body_IsValid(chunkBody.Body))
+				b2DestroyBody(chunkBody.Body);
+			chunkBody.Body = b2_nullBodyId;
+			chunkBody.ShapeCount = 0;
+
+			map->BuildCollisionRects(chunk, rects);
+			if (rects.empty())
+				continue;
+
+			b2BodyDef bodyDef = b2DefaultBodyDef();
+			bodyDef.type = b2_staticBody;
+			bodyDef.position = { position.x, position.y };
+			bodyDef.rotation = b2MakeRot(glm::radians(rotation.z));
+			bodyDef.userData = reinterpret_cast<void*>(static_cast<uintptr_t>(entity));
+
+			chunkBody.Body = b2CreateBody(m_PhysicsWorldId, &bodyDef);
+
+			b2ShapeDef shapeDef = b2DefaultShapeDef();
+			shapeDef.material.friction = collider.Friction;
+			shapeDef.material.restitution = collider.Restitution;
+			shapeDef.filter.categoryBits = collider.CategoryBits;
+			shapeDef.filter.maskBits = collider.MaskBits;
+
+			// Same layout as the tile mesh: chunk offset plus tile coordinates, one unit per tile
+			const float tileWidth = unit * scale.x;
+			const float tileHeight = unit * scale.y;
+			const float originX = chunk.ChunkX * chunkSize * tileWidth;
+			const float originY = chunk.ChunkY * chunkSize * tileHeight;
+
+			for (const TileRect& rect : rects)
+			{
+				const b2Vec2 center{
+					originX + (rect.X + rect.Width * 0.5f) * tileWidth,
+					originY + (rect.Y + rect.Height * 0.5f) * tileHeight
+				};
+
+				const b2Polygon box = b2MakeOffsetBox(rect.Width * tileWidth * 0.5f, rect.Height * tileHeight * 0.5f, center, b2Rot_identity);
+				b2CreatePolygonShape(chunkBody.Body, &shapeDef, &box);
+			}
+
+			chunkBody.ShapeCount = static_cast<uint32_t>(rects.size());
+		}
+
+		collider.BodyCount = 0;
+		collider.ShapeCount = 0;
+		for (const auto& [key, chunkBody] : runtime.Chunks)
+		{
+			collider.BodyCount += B2_IS_NON_NULL(chunkBody.Body) ? 1 : 0;
+			collider.ShapeCount += chunkBody.ShapeCount;
+		}
+	}
+}
+
+void PhysicsWorld2D::OnTilemapColliderRemoved(entt::registry&, GameObjectID id)
+{
+	auto it = m_TilemapColliders.find(id);
+	if (it == m_TilemapColliders.end())
+		return;
+
+	DestroyTilemapBodies(it->second);
+	m_TilemapColliders.erase(it);
+}
+
+void PhysicsWorld2D::DestroyTilemapBodies(TilemapColliderRuntime& runtime)
+{
+	for (auto& [key, chunkBody] : runtime.Chunks)
+	{
+		if (b2Body_IsValid(chunkBody.Body))
+			b2DestroyBody(chunkBody.Body);
+	}
+	runtime.Chunks.clear();
+}
+
+b2BodyId PhysicsWorld2D::GetBody(const Rigidbody2D& rb) const
+{
+	const b2BodyId body = b2LoadBodyId(rb.BodyHandle);
+
+	// Components copied from another scene carry a handle into that scene's world
+	if (body.world0 + 1 != m_PhysicsWorldId.index1 || !b2Body_IsValid(body))
+		return b2_nullBodyId;
+
+	return body;
 }
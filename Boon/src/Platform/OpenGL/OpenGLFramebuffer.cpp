@@ -105,6 +105,14 @@ Boon::OpenGLFramebuffer::~OpenGLFramebuffer()
 	glDeleteFramebuffers(1, &m_ID);
 	glDeleteTextures((GLsizei)m_ColorAttachments.size(), m_ColorAttachments.data());
 	glDeleteTextures(1, &m_DepthAttachment);
+
+	for (PixelReadback& readback : m_Readbacks)
+	{
+		if (readback.Fence)
+			glDeleteSync(static_cast<GLsync>(readback.Fence));
+		if (readback.Buffer)
+			glDeleteBuffers(1, &readback.Buffer);
+	}
 }
 
 void Boon::OpenGLFramebuffer::Invalidate()
@@ -215,6 +223,69 @@ int Boon::OpenGLFramebuffer::ReadPixel(uint32_t attachmentIndex, int x, int y)
 	return pixelData;
 }
 
+void Boon::OpenGLFramebuffer::RequestPixel(uint32_t attachmentIndex, int x, int y)
+{
+	if (x < 0 || y < 0 || x >= static_cast<int>(m_Desc.Width) || y >= static_cast<int>(m_Desc.Height))
+		return;
+
+	// Every slot still waiting on the GPU, skip this one rather than stall
+	PixelReadback& readback = m_Readbacks[m_NextReadback];
+	if (readback.Fence)
+		return;
+
+	if (!readback.Buffer)
+	{
+		glCreateBuffers(1, &readback.Buffer);
+		glNamedBufferStorage(readback.Buffer, sizeof(int), nullptr, GL_CLIENT_STORAGE_BIT);
+	}
+
+	glBindFramebuffer(GL_READ_FRAMEBUFFER, m_ID);
+	glReadBuffer(GL_COLOR_ATTACHMENT0 + attachmentIndex);
+
+	// With a pack buffer bound the copy lands in the buffer and the call returns right away
+	glBindBuffer(GL_PIXEL_PACK_BUFFER, readback.Buffer);
+	glReadPixels(x, y, 1, 1, GL_RED_INTEGER, GL_INT, nullptr);
+	glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+	glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+
+	readback.Fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	readback.Sequence = ++m_ReadbackSequence;
+
+	m_NextReadback = (m_NextReadback + 1) % ReadbackSlots;
+}
+
+bool Boon::OpenGLFramebuffer::PollPixel(int& outValue)
+{
+	uint64_t newest = 0;
+
+	for (PixelReadback& readback : m_Readbacks)
+	{
+		if (!readback.Fence)
+			continue;
+
+		GLsync fence = static_cast<GLsync>(readback.Fence);
+		GLenum status = glClientWaitSync(fence, 0, 0);
+		if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED)
+			continue;
+
+		int value = 0;
+		glGetNamedBufferSubData(readback.Buffer, 0, sizeof(int), &value);
+
+		glDeleteSync(fence);
+		readback.Fence = nullptr;
+
+		// Several may finish together, only the latest position matters
+		if (readback.Sequence > newest)
+		{
+			newest = readback.Sequence;
+			outValue = value;
+		}
+	}
+
+	return newest != 0;
+}
+
 void Boon::OpenGLFramebuffer::ClearAttachment(uint32_t attachmentIndex, int value)
 {
 	auto& spec = m_ColorAttachmentDescriptors[attachmentIndex];
@@ -1,5 +1,6 @@
 #include "Renderer/Framebuffer.h"
 
+#include <array>
 #include <vector>
 
 namespace Boon
@@ -17,6 +18,8 @@ namespace Boon
 
 		virtual void Resize(uint32_t width, uint32_t height) override;
 		virtual int ReadPixel(uint32_t attachmentIndex, int x, int y) override;
+		virtual void RequestPixel(uint32_t attachmentIndex, int x, int y) override;
+		virtual bool PollPixel(int& outValue) override;
 
 		virtual void ClearAttachment(uint32_t attachmentIndex, int value) override;
 
@@ -24,6 +27,16 @@ namespace Boon
 
 		inline virtual const FramebufferDescriptor& GetDescriptor() const override { return m_Desc; }
 
+	private:
+		struct PixelReadback
+		{
+			uint32_t Buffer = 0;
+			void* Fence = nullptr;
+			uint64_t Sequence = 0;
+		};
+
+		static constexpr size_t ReadbackSlots = 3;
+
 	private:
 		FramebufferDescriptor m_Desc;
 		uint32_t m_ID = 0;
@@ -33,5 +46,10 @@ namespace Boon
 
 		std::vector<uint32_t> m_ColorAttachments;
 		uint32_t m_DepthAttachment{};
+
+		// Pixel pack buffers cycled by RequestPixel, each guarded by a fence
+		std::array<PixelReadback, ReadbackSlots> m_Readbacks{};
+		size_t m_NextReadback{ 0 };
+		uint64_t m_ReadbackSequence{ 0 };
 	};
 }
\ No newline at end of file
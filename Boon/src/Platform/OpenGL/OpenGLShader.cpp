@@ -1,5 +1,6 @@
 #include "OpenGLShader.h"
 #include "BoonDebug/Logger.h"
+#include "Renderer/ShaderCompiler/ShaderCache.h"
 
 #include <glad/glad.h>
 #include <vector>
@@ -12,10 +13,42 @@ static void LogShaderError(const char* stage, const std::vector<GLchar>& infoLog
     BOON_LOG_ERROR("{} shader error:\n{}", stage, infoLog.data());
 }
 
-Boon::OpenGLShader::OpenGLShader(const std::string& vertexSrc, const std::string& fragmentSrc)
+static bool SupportsProgramBinary()
+{
+    static const bool supported = []()
+        {
+            GLint formatCount = 0;
+            glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formatCount);
+            return formatCount > 0;
+        }();
+    return supported;
+}
+
+// Program binaries are only valid for the driver that produced them
+static const std::string& GetDriverTag()
+{
+    static const std::string tag = []()
+        {
+            std::string result;
+            for (GLenum name : { GL_VENDOR, GL_RENDERER, GL_VERSION })
+            {
+                if (const GLubyte* value = glGetString(name))
+                    result += reinterpret_cast<const char*>(value);
+                result += '|';
+            }
+            return result;
+        }();
+    return tag;
+}
+
+Boon::OpenGLShader::OpenGLShader(const std::string& vertexSrc, const std::string& fragmentSrc, uint64_t cacheKey)
 {
     m_ID = 0;
 
+    const bool useBinaryCache = cacheKey != 0 && ShaderCache::IsEnabled() && SupportsProgramBinary();
+    if (useBinaryCache && LoadProgramBinary(cacheKey))
+        return;
+
     GLuint vertexShader = glCreateShader(GL_VERTEX_SHADER);
 
     const GLchar* source = vertexSrc.c_str();
@@ -66,6 +99,10 @@ Boon::OpenGLShader::OpenGLShader(const std::string& vertexSrc, const std::string
 
     glAttachShader(program, vertexShader);
     glAttachShader(program, fragmentShader);
+
+    if (useBinaryCache)
+        glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+
     glLinkProgram(program);
 
     GLint isLinked = 0;
@@ -96,6 +133,9 @@ Boon::OpenGLShader::OpenGLShader(const std::string& vertexSrc, const std::string
     glDeleteShader(fragmentShader);
 
     m_ID = program;
+
+    if (useBinaryCache)
+        StoreProgramBinary(cacheKey);
 }
 
 Boon::OpenGLShader::~OpenGLShader()
@@ -104,6 +144,47 @@ Boon::OpenGLShader::~OpenGLShader()
         glDeleteProgram(m_ID);
 }
 
+bool Boon::OpenGLShader::LoadProgramBinary(uint64_t cacheKey)
+{
+    uint32_t format = 0;
+    Buffer binary;
+    if (!ShaderCache::LoadProgramBinary(cacheKey, GetDriverTag(), format, binary))
+        return false;
+
+    GLuint program = glCreateProgram();
+    glProgramBinary(program, static_cast<GLenum>(format), binary.Data(), static_cast<GLsizei>(binary.Size()));
+
+    // Drivers reject binaries after updates; fall back to compiling from source
+    GLint isLinked = 0;
+    glGetProgramiv(program, GL_LINK_STATUS, &isLinked);
+    if (isLinked == GL_FALSE)
+    {
+        glDeleteProgram(program);
+        return false;
+    }
+
+    m_ID = program;
+    return true;
+}
+
+void Boon::OpenGLShader::StoreProgramBinary(uint64_t cacheKey) const
+{
+    GLint length = 0;
+    glGetProgramiv(m_ID, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0)
+        return;
+
+    Buffer binary(static_cast<size_t>(length));
+    GLenum format = 0;
+    GLsizei written = 0;
+    glGetProgramBinary(m_ID, length, &written, &format, binary.Data());
+    if (written <= 0)
+        return;
+
+    binary.Resize(static_cast<size_t>(written));
+    ShaderCache::StoreProgramBinary(cacheKey, GetDriverTag(), static_cast<uint32_t>(format), binary);
+}
+
 void Boon::OpenGLShader::Bind() const
 {
     if (m_ID == 0)
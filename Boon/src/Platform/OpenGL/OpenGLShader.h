@@ -7,7 +7,7 @@ namespace Boon
 	class OpenGLShader final : public Shader
 	{
 	public:
-		OpenGLShader(const std::string& vertexSrc, const std::string& fragmentSrc);
+		OpenGLShader(const std::string& vertexSrc, const std::string& fragmentSrc, uint64_t cacheKey = 0);
 		virtual ~OpenGLShader();
 
 		OpenGLShader(const OpenGLShader& other) = delete;
@@ -19,6 +19,9 @@ namespace Boon
 		virtual void Unbind() const override;
 
 	private:
+		bool LoadProgramBinary(uint64_t cacheKey);
+		void StoreProgramBinary(uint64_t cacheKey) const;
+
 		uint32_t m_ID;
 	};
 }
\ No newline at end of file
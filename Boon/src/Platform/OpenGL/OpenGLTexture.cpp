@@ -9,19 +9,36 @@ namespace Utils
 	{
 		switch (format)
 		{
-		case ImageFormat::RGB8:  return GL_RGB;
-		case ImageFormat::RGBA8: return GL_RGBA;
+		case ImageFormat::R8:      return GL_RED;
+		case ImageFormat::RGB8:    return GL_RGB;
+		case ImageFormat::RGBA8:   return GL_RGBA;
+		case ImageFormat::RGBA32F: return GL_RGBA;
+		case ImageFormat::R32I:    return GL_RED_INTEGER;
 		}
 
 		return 0;
 	}
 
+	static GLenum ImageFormatToGLDataType(ImageFormat format)
+	{
+		switch (format)
+		{
+		case ImageFormat::RGBA32F: return GL_FLOAT;
+		case ImageFormat::R32I:    return GL_INT;
+		}
+
+		return GL_UNSIGNED_BYTE;
+	}
+
 	static GLenum ImageFormatToGLInternalFormat(ImageFormat format)
 	{
 		switch (format)
 		{
-		case ImageFormat::RGB8:  return GL_RGB8;
-		case ImageFormat::RGBA8: return GL_RGBA8;
+		case ImageFormat::R8:      return GL_R8;
+		case ImageFormat::RGB8:    return GL_RGB8;
+		case ImageFormat::RGBA8:   return GL_RGBA8;
+		case ImageFormat::RGBA32F: return GL_RGBA32F;
+		case ImageFormat::R32I:    return GL_R32I;
 		}
 
 		return 0;
@@ -44,6 +61,7 @@ Boon::OpenGLTexture2D::OpenGLTexture2D(const TextureDescriptor& descriptor)
 {
 	m_InternalFormat = Utils::ImageFormatToGLInternalFormat(m_Descriptor.Format);
 	m_DataFormat = Utils::ImageFormatToGLDataFormat(m_Descriptor.Format);
+	m_DataType = Utils::ImageFormatToGLDataType(m_Descriptor.Format);
 
 	glCreateTextures(GL_TEXTURE_2D, 1, &m_RendererID);
 	glTextureStorage2D(m_RendererID, 1, m_InternalFormat, descriptor.Width, descriptor.Height);
@@ -63,7 +81,7 @@ Boon::OpenGLTexture2D::~OpenGLTexture2D()
 void Boon::OpenGLTexture2D::SetData(void* data, uint32_t)
 {
 	//uint32_t bpp = m_DataFormat == GL_RGBA ? 4 : 3;
-	glTextureSubImage2D(m_RendererID, 0, 0, 0, m_Descriptor.Width, m_Descriptor.Height, m_DataFormat, GL_UNSIGNED_BYTE, data);
+	glTextureSubImage2D(m_RendererID, 0, 0, 0, m_Descriptor.Width, m_Descriptor.Height, m_DataFormat, m_DataType, data);
 
 	if (m_Descriptor.GenerateMips)
 	{
@@ -74,7 +92,7 @@ void Boon::OpenGLTexture2D::SetData(void* data, uint32_t)
 void Boon::OpenGLTexture2D::SetData(Buffer& buffer)
 {
 	//uint32_t bpp = m_DataFormat == GL_RGBA ? 4 : 3;
-	glTextureSubImage2D(m_RendererID, 0, 0, 0, m_Descriptor.Width, m_Descriptor.Height, m_DataFormat, GL_UNSIGNED_BYTE, buffer.Data());
+	glTextureSubImage2D(m_RendererID, 0, 0, 0, m_Descriptor.Width, m_Descriptor.Height, m_DataFormat, m_DataType, buffer.Data());
 
 	if (m_Descriptor.GenerateMips)
 	{
@@ -82,6 +100,11 @@ void Boon::OpenGLTexture2D::SetData(Buffer& buffer)
 	}
 }
 
+void Boon::OpenGLTexture2D::SetSubData(const void* data, uint32_t x, uint32_t y, uint32_t width, uint32_t height)
+{
+	glTextureSubImage2D(m_RendererID, 0, x, y, width, height, m_DataFormat, m_DataType, data);
+}
+
 void Boon::OpenGLTexture2D::Bind(uint32_t slot) const
 {
 	glBindTextureUnit(slot, m_RendererID);
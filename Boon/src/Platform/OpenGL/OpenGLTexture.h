@@ -19,6 +19,7 @@ namespace Boon
 
 		virtual void SetData(void* data, uint32_t size) override;
 		virtual void SetData(Buffer& buffer) override;
+		virtual void SetSubData(const void* data, uint32_t x, uint32_t y, uint32_t width, uint32_t height) override;
 
 		virtual void Bind(uint32_t slot = 0) const override;
 
@@ -30,6 +31,6 @@ namespace Boon
 		TextureDescriptor m_Descriptor;
 
 		uint32_t m_RendererID;
-		GLenum m_InternalFormat, m_DataFormat;
+		GLenum m_InternalFormat, m_DataFormat, m_DataType;
 	};
 }
\ No newline at end of file
@@ -32,3 +32,26 @@ void Boon::OpenGLUniformBuffer::SetData(const void* data, size_t size, uint32_t
 
     glNamedBufferSubData(m_ID, offset, size, data);
 }
+
+void Boon::OpenGLUniformBuffer::BindRange(uint32_t binding, uint32_t offset, size_t size)
+{
+    if (offset + size > m_Size)
+    {
+        BOON_LOG_ERROR("UniformBuffer BindRange out of bounds. Offset: {}, Size: {}, BufferSize: {}", offset, size, m_Size);
+        return;
+    }
+
+    glBindBufferRange(GL_UNIFORM_BUFFER, binding, m_ID, offset, size);
+}
+
+uint32_t Boon::OpenGLUniformBuffer::GetOffsetAlignment()
+{
+    static uint32_t s_Alignment = 0;
+    if (s_Alignment == 0)
+    {
+        GLint alignment = 256;
+        glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+        s_Alignment = alignment > 0 ? static_cast<uint32_t>(alignment) : 256u;
+    }
+    return s_Alignment;
+}
@@ -15,8 +15,11 @@ namespace Boon
 		OpenGLUniformBuffer& operator=(const OpenGLUniformBuffer& other) = delete;
 		OpenGLUniformBuffer& operator=(OpenGLUniformBuffer&& other) = delete;
 
+		static uint32_t GetOffsetAlignment();
+
 	private:
 		void SetData(const void* data, size_t size, uint32_t offset) override;
+		void BindRange(uint32_t binding, uint32_t offset, size_t size) override;
 
 		uint32_t m_ID = 0;
 		size_t m_Size = 0;
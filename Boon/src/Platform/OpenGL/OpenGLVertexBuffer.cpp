@@ -35,6 +35,12 @@ void Boon::OpenGLVertexBuffer::SetData(const void* data, uint32_t size)
 	glBufferSubData(GL_ARRAY_BUFFER, 0, size, data);
 }
 
+void Boon::OpenGLVertexBuffer::SetSubData(const void* data, uint32_t size, uint32_t offset)
+{
+	glBindBuffer(GL_ARRAY_BUFFER, m_ID);
+	glBufferSubData(GL_ARRAY_BUFFER, offset, size, data);
+}
+
 void Boon::OpenGLVertexBuffer::Init(float* vertices, uint32_t size)
 {
 	glCreateBuffers(1, &m_ID);
@@ -18,6 +18,7 @@ namespace Boon
 		virtual void Bind() const override;
 		virtual void Unbind() const override;
 		virtual void SetData(const void* data, uint32_t size) override;
+		virtual void SetSubData(const void* data, uint32_t size, uint32_t offset) override;
 
 		inline virtual const VertexBufferLayout& GetLayout() const override { return m_Layout; }
 		inline virtual void SetLayout(const VertexBufferLayout& layout) override { m_Layout = layout; }
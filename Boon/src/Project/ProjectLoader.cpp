@@ -73,12 +73,38 @@ namespace Boon
     {
         if (j.contains("bVSync"))   j.at("bVSync").get_to(r.bVSync);
         if (j.contains("Renderer")) j.at("Renderer").get_to(r.Renderer);
+        if (j.contains("bShaderCache")) j.at("bShaderCache").get_to(r.bShaderCache);
     }
     void to_json(json& j, const RuntimeConfig::RenderSettings& r)
     {
         j = json{
-            { "bVSync",   r.bVSync },
-            { "Renderer", r.Renderer }
+            { "bVSync",       r.bVSync },
+            { "Renderer",     r.Renderer },
+            { "bShaderCache", r.bShaderCache }
+        };
+    }
+
+    void from_json(const json& j, RuntimeConfig::JobSettings& js)
+    {
+        if (j.contains("WorkerCount")) j.at("WorkerCount").get_to(js.WorkerCount);
+    }
+    void to_json(json& j, const RuntimeConfig::JobSettings& js)
+    {
+        j = json{
+            { "WorkerCount", js.WorkerCount }
+        };
+    }
+
+    void from_json(const json& j, RuntimeConfig::PhysicsSettings& ps)
+    {
+        if (j.contains("WorkerCount"))   j.at("WorkerCount").get_to(ps.WorkerCount);
+        if (j.contains("FixedTimeStep")) j.at("FixedTimeStep").get_to(ps.FixedTimeStep);
+    }
+    void to_json(json& j, const RuntimeConfig::PhysicsSettings& ps)
+    {
+        j = json{
+            { "WorkerCount",   ps.WorkerCount },
+            { "FixedTimeStep", ps.FixedTimeStep }
         };
     }
 
@@ -93,6 +119,25 @@ namespace Boon
         };
     }
 
+    void from_json(const json& j, LogSettings& l)
+    {
+        if (j.contains("bAsync"))       j.at("bAsync").get_to(l.bAsync);
+        if (j.contains("RingCapacity")) j.at("RingCapacity").get_to(l.RingCapacity);
+        if (j.contains("File"))         j.at("File").get_to(l.File);
+        if (j.contains("MaxFileSize"))  j.at("MaxFileSize").get_to(l.MaxFileSize);
+        if (j.contains("MaxFiles"))     j.at("MaxFiles").get_to(l.MaxFiles);
+    }
+    void to_json(json& j, const LogSettings& l)
+    {
+        j = json{
+            { "bAsync",       l.bAsync },
+            { "RingCapacity", l.RingCapacity },
+            { "File",         l.File },
+            { "MaxFileSize",  l.MaxFileSize },
+            { "MaxFiles",     l.MaxFiles }
+        };
+    }
+
     void from_json(const json& j, RuntimeConfig& r)
     {
         //if (j.contains("ProjectRoot"))       j.at("ProjectRoot").get_to(r.ProjectRoot);
@@ -112,8 +157,17 @@ namespace Boon
         if (j.contains("Render"))
             j.at("Render").get_to(r.Render);
 
+        if (j.contains("Jobs"))
+            j.at("Jobs").get_to(r.Jobs);
+
+        if (j.contains("Physics"))
+            j.at("Physics").get_to(r.Physics);
+
         if (j.contains("Network"))
             j.at("Network").get_to(r.Network);
+
+        if (j.contains("Log"))
+            j.at("Log").get_to(r.Log);
     }
     void to_json(json& j, const RuntimeConfig& r)
     {
@@ -127,7 +181,10 @@ namespace Boon
             { "EnabledModules",   r.EnabledModules },
             { "Window",           r.Window },
             { "Render",           r.Render },
-            { "Network",          r.Network }
+            { "Jobs",             r.Jobs },
+            { "Physics",          r.Physics },
+            { "Network",          r.Network },
+            { "Log",              r.Log }
         };
     }
 
@@ -0,0 +1,495 @@
+#include "Renderer/AtlasPacker.h"
+#include "Core/Threading/JobSystem.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <limits>
+
+namespace Boon
+{
+    namespace
+    {
+        struct PackRect
+        {
+            uint32_t X = 0;
+            uint32_t Y = 0;
+            uint32_t W = 0;
+            uint32_t H = 0;
+        };
+
+        enum class Heuristic
+        {
+            BestShortSideFit,
+            BestAreaFit,
+            BottomLeft
+        };
+
+        constexpr uint32_t MaxSupportedPageSize = 16384;
+
+        constexpr Heuristic Heuristics[] = {
+            Heuristic::BestShortSideFit,
+            Heuristic::BestAreaFit,
+            Heuristic::BottomLeft
+        };
+
+        bool Contains(const PackRect& outer, const PackRect& inner)
+        {
+            return inner.X >= outer.X && inner.Y >= outer.Y &&
+                inner.X + inner.W <= outer.X + outer.W &&
+                inner.Y + inner.H <= outer.Y + outer.H;
+        }
+
+        bool Intersects(const PackRect& a, const PackRect& b)
+        {
+            return a.X < b.X + b.W && b.X < a.X + a.W &&
+                a.Y < b.Y + b.H && b.Y < a.Y + a.H;
+        }
+
+        uint32_t NextPowerOfTwo(uint32_t value)
+        {
+            uint32_t result = 1;
+            while (result < value)
+                result <<= 1;
+            return result;
+        }
+
+        class MaxRectsBin
+        {
+        public:
+            MaxRectsBin(uint32_t width, uint32_t height)
+            {
+                m_Free.push_back({ 0, 0, width, height });
+            }
+
+            bool Insert(uint32_t width, uint32_t height, bool allowRotation, Heuristic heuristic, PackRect& outRect, bool& outRotated)
+            {
+                int64_t bestPrimary = std::numeric_limits<int64_t>::max();
+                int64_t bestSecondary = std::numeric_limits<int64_t>::max();
+                bool found = false;
+
+                auto consider = [&](const PackRect& free, uint32_t w, uint32_t h, bool rotated)
+                    {
+                        if (w > free.W || h > free.H)
+                            return;
+
+                        int64_t primary = 0;
+                        int64_t secondary = 0;
+
+                        const int64_t leftoverX = static_cast<int64_t>(free.W) - w;
+                        const int64_t leftoverY = static_cast<int64_t>(free.H) - h;
+
+                        switch (heuristic)
+                        {
+                        case Heuristic::BestShortSideFit:
+                            primary = std::min(leftoverX, leftoverY);
+                            secondary = std::max(leftoverX, leftoverY);
+                            break;
+                        case Heuristic::BestAreaFit:
+                            primary = static_cast<int64_t>(free.W) * free.H - static_cast<int64_t>(w) * h;
+                            secondary = std::min(leftoverX, leftoverY);
+                            break;
+                        case Heuristic::BottomLeft:
+                            primary = static_cast<int64_t>(free.Y) + h;
+                            secondary = free.X;
+                            break;
+                        }
+
+                        if (primary < bestPrimary || (primary == bestPrimary && secondary < bestSecondary))
+                        {
+                            bestPrimary = primary;
+                            bestSecondary = secondary;
+                            outRect = { free.X, free.Y, w, h };
+                            outRotated = rotated;
+                            found = true;
+                        }
+                    };
+
+                for (const PackRect& free : m_Free)
+                {
+                    consider(free, width, height, false);
+                    if (allowRotation && width != height)
+                        consider(free, height, width, true);
+                }
+
+                if (found)
+                    Place(outRect);
+
+                return found;
+            }
+
+        private:
+            void Place(const PackRect& used)
+            {
+                // Rects that survive untouched were already free of containment among themselves,
+                // and none of them can sit inside a split of a free rect they did not overlap
+                std::vector<PackRect> next;
+                next.reserve(m_Free.size() + 4);
+
+                for (const PackRect& free : m_Free)
+                {
+                    if (!Intersects(free, used))
+                        next.push_back(free);
+                }
+
+                const size_t firstSplit = next.size();
+
+                for (const PackRect& free : m_Free)
+                {
+                    if (!Intersects(free, used))
+                        continue;
+
+                    if (used.X > free.X)
+                        next.push_back({ free.X, free.Y, used.X - free.X, free.H });
+                    if (used.X + used.W < free.X + free.W)
+                        next.push_back({ used.X + used.W, free.Y, free.X + free.W - (used.X + used.W), free.H });
+                    if (used.Y > free.Y)
+                        next.push_back({ free.X, free.Y, free.W, used.Y - free.Y });
+                    if (used.Y + used.H < free.Y + free.H)
+                        next.push_back({ free.X, used.Y + used.H, free.W, free.Y + free.H - (used.Y + used.H) });
+                }
+
+                std::vector<bool> removed(next.size(), false);
+                for (size_t i = firstSplit; i < next.size(); ++i)
+                {
+                    for (size_t j = 0; j < next.size() && !removed[i]; ++j)
+                    {
+                        if (i == j || removed[j])
+                            continue;
+
+                        // Of two identical splits keep the first
+                        if (Contains(next[j], next[i]) && (j < i || !Contains(next[i], next[j])))
+                            removed[i] = true;
+                    }
+                }
+
+                m_Free.clear();
+                for (size_t i = 0; i < next.size(); ++i)
+                {
+                    if (!removed[i])
+                        m_Free.push_back(next[i]);
+                }
+            }
+
+            std::vector<PackRect> m_Free;
+        };
+
+        struct PageCandidate
+        {
+            uint32_t Width = 0;
+            uint32_t Height = 0;
+            Heuristic Method = Heuristic::BestShortSideFit;
+
+            // Parallel to the remaining inputs; W == 0 marks an input that did not fit
+            std::vector<PackRect> Placed;
+            std::vector<bool> Rotated;
+            size_t PlacedCount = 0;
+            uint64_t PlacedArea = 0;
+        };
+
+        void PackCandidate(
+            PageCandidate& candidate,
+            const std::vector<size_t>& remaining,
+            const std::vector<AtlasPackInput>& footprints,
+            const AtlasPackSettings& settings)
+        {
+            // The bin reaches one padding past the page edge, so the last column and row need none
+            MaxRectsBin bin(candidate.Width + settings.Padding, candidate.Height + settings.Padding);
+
+            candidate.Placed.assign(remaining.size(), PackRect{});
+            candidate.Rotated.assign(remaining.size(), false);
+
+            for (size_t i = 0; i < remaining.size(); ++i)
+            {
+                const AtlasPackInput& footprint = footprints[remaining[i]];
+
+                PackRect rect{};
+                bool rotated = false;
+                if (!bin.Insert(footprint.Width, footprint.Height, settings.AllowRotation, candidate.Method, rect, rotated))
+                    continue;
+
+                candidate.Placed[i] = rect;
+                candidate.Rotated[i] = rotated;
+                ++candidate.PlacedCount;
+                candidate.PlacedArea += static_cast<uint64_t>(rect.W) * rect.H;
+            }
+        }
+
+        std::vector<PageCandidate> MakeCandidates(
+            const std::vector<size_t>& remaining,
+            const std::vector<AtlasPackInput>& footprints,
+            const AtlasPackSettings& settings)
+        {
+            uint64_t area = 0;
+            uint32_t needWidth = 1;
+            uint32_t needHeight = 1;
+            for (size_t index : remaining)
+            {
+                const AtlasPackInput& footprint = footprints[index];
+                area += static_cast<uint64_t>(footprint.Width) * footprint.Height;
+
+                if (settings.AllowRotation)
+                {
+                    const uint32_t side = std::min(footprint.Width, footprint.Height);
+                    needWidth = std::max(needWidth, side);
+                    needHeight = std::max(needHeight, side);
+                }
+                else
+                {
+                    needWidth = std::max(needWidth, footprint.Width);
+                    needHeight = std::max(needHeight, footprint.Height);
+                }
+            }
+
+            const uint32_t maxSize = settings.MaxPageSize;
+            auto minPageSize = [&](uint32_t need)
+                {
+                    return std::min(NextPowerOfTwo(need > settings.Padding ? need - settings.Padding : 1), maxSize);
+                };
+
+            const uint32_t minWidth = minPageSize(needWidth);
+            const uint32_t minHeight = minPageSize(needHeight);
+
+            std::vector<PageCandidate> candidates;
+
+            for (uint32_t width = minWidth; width <= maxSize; width <<= 1)
+            {
+                for (uint32_t height = std::max(width / 2, minHeight); height <= std::min(width * 2, maxSize); height <<= 1)
+                {
+                    const bool isMax = width == maxSize && height == maxSize;
+                    const uint64_t pageArea = static_cast<uint64_t>(width + settings.Padding) * (height + settings.Padding);
+
+                    // Smaller pages cannot take everything, and only the largest page is kept when nothing fits
+                    if (!isMax && pageArea < area)
+                        continue;
+
+                    for (Heuristic heuristic : Heuristics)
+                    {
+                        PageCandidate candidate{};
+                        candidate.Width = width;
+                        candidate.Height = height;
+                        candidate.Method = heuristic;
+                        candidates.push_back(std::move(candidate));
+                    }
+                }
+
+                if (width > maxSize / 2)
+                    break;
+            }
+
+            return candidates;
+        }
+
+        const PageCandidate* SelectCandidate(const std::vector<PageCandidate>& candidates, size_t remainingCount)
+        {
+            const PageCandidate* best = nullptr;
+
+            for (const PageCandidate& candidate : candidates)
+            {
+                if (candidate.PlacedCount != remainingCount)
+                    continue;
+
+                const uint64_t area = static_cast<uint64_t>(candidate.Width) * candidate.Height;
+                if (!best)
+                {
+                    best = &candidate;
+                    continue;
+                }
+
+                const uint64_t bestArea = static_cast<uint64_t>(best->Width) * best->Height;
+                const uint32_t skew = std::max(candidate.Width, candidate.Height) - std::min(candidate.Width, candidate.Height);
+                const uint32_t bestSkew = std::max(best->Width, best->Height) - std::min(best->Width, best->Height);
+
+                if (area < bestArea || (area == bestArea && skew < bestSkew))
+                    best = &candidate;
+            }
+
+            if (best)
+                return best;
+
+            for (const PageCandidate& candidate : candidates)
+            {
+                if (candidate.PlacedCount == 0)
+                    continue;
+
+                if (!best || candidate.PlacedArea > best->PlacedArea)
+                    best = &candidate;
+            }
+
+            return best;
+        }
+    }
+
+    AtlasPackResult AtlasPacker::Pack(const std::vector<AtlasPackInput>& inputs, const AtlasPackSettings& settings)
+    {
+        using Clock = std::chrono::steady_clock;
+        const Clock::time_point start = Clock::now();
+
+        AtlasPackResult result{};
+        result.Rects.resize(inputs.size());
+
+        const uint32_t border = settings.Extrude * 2 + settings.Padding;
+        const uint32_t maxSize = NextPowerOfTwo(std::clamp(settings.MaxPageSize, 1u, MaxSupportedPageSize));
+
+        AtlasPackSettings pageSettings = settings;
+        pageSettings.MaxPageSize = maxSize;
+
+        std::vector<AtlasPackInput> footprints(inputs.size());
+        std::vector<size_t> remaining;
+        remaining.reserve(inputs.size());
+
+        for (size_t i = 0; i < inputs.size(); ++i)
+        {
+            const AtlasPackInput& input = inputs[i];
+            footprints[i] = { input.Width + border, input.Height + border };
+
+            const uint32_t limit = maxSize + settings.Padding;
+            const bool fits = (footprints[i].Width <= limit && footprints[i].Height <= limit);
+
+            if (input.Width == 0 || input.Height == 0 || !fits)
+                result.Rejected.push_back(i);
+            else
+                remaining.push_back(i);
+        }
+
+        // Large images first, they constrain the layout the most
+        std::stable_sort(remaining.begin(), remaining.end(), [&](size_t a, size_t b)
+            {
+                const uint32_t sideA = std::max(footprints[a].Width, footprints[a].Height);
+                const uint32_t sideB = std::max(footprints[b].Width, footprints[b].Height);
+                if (sideA != sideB)
+                    return sideA > sideB;
+
+                return static_cast<uint64_t>(footprints[a].Width) * footprints[a].Height >
+                    static_cast<uint64_t>(footprints[b].Width) * footprints[b].Height;
+            });
+
+        uint64_t imageArea = 0;
+        uint64_t pageArea = 0;
+
+        while (!remaining.empty())
+        {
+            std::vector<PageCandidate> candidates = MakeCandidates(remaining, footprints, pageSettings);
+
+            auto packRange = [&](size_t begin, size_t end)
+                {
+                    for (size_t i = begin; i < end; ++i)
+                        PackCandidate(candidates[i], remaining, footprints, pageSettings);
+                };
+
+            if (JobSystem* jobs = JobSystem::Get())
+                jobs->ParallelFor(candidates.size(), 1, packRange);
+            else
+                packRange(0, candidates.size());
+
+            const PageCandidate* best = SelectCandidate(candidates, remaining.size());
+            if (!best)
+            {
+                result.Rejected.insert(result.Rejected.end(), remaining.begin(), remaining.end());
+                break;
+            }
+
+            const int pageIndex = static_cast<int>(result.Pages.size());
+            AtlasPage page{};
+            page.Width = best->Width;
+            page.Height = best->Height;
+
+            std::vector<size_t> leftover;
+            for (size_t i = 0; i < remaining.size(); ++i)
+            {
+                const size_t index = remaining[i];
+                const PackRect& placed = best->Placed[i];
+
+                if (placed.W == 0)
+                {
+                    leftover.push_back(index);
+                    continue;
+                }
+
+                AtlasPackedRect& rect = result.Rects[index];
+                rect.Page = pageIndex;
+                rect.X = placed.X + settings.Extrude;
+                rect.Y = placed.Y + settings.Extrude;
+                rect.Rotated = best->Rotated[i];
+                rect.Width = rect.Rotated ? inputs[index].Height : inputs[index].Width;
+                rect.Height = rect.Rotated ? inputs[index].Width : inputs[index].Height;
+
+                page.UsedArea += static_cast<uint64_t>(rect.Width) * rect.Height;
+            }
+
+            imageArea += page.UsedArea;
+            pageArea += static_cast<uint64_t>(page.Width) * page.Height;
+
+            result.Pages.push_back(page);
+            remaining = std::move(leftover);
+        }
+
+        std::sort(result.Rejected.begin(), result.Rejected.end());
+
+        result.Efficiency = pageArea > 0 ? static_cast<float>(static_cast<double>(imageArea) / static_cast<double>(pageArea)) : 0.0f;
+        result.Milliseconds = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        return result;
+    }
+
+    void AtlasPacker::Blit(
+        uint8_t* pagePixels,
+        uint32_t pageWidth,
+        uint32_t pageHeight,
+        const uint8_t* imagePixels,
+        const AtlasPackedRect& rect,
+        uint32_t extrude)
+    {
+        constexpr size_t Channels = 4;
+
+        if (!pagePixels || !imagePixels || !rect.IsPacked() ||
+            rect.X + rect.Width > pageWidth || rect.Y + rect.Height > pageHeight)
+            return;
+
+        auto texel = [&](uint32_t x, uint32_t y) -> uint8_t*
+            {
+                return pagePixels + (static_cast<size_t>(y) * pageWidth + x) * Channels;
+            };
+
+        if (!rect.Rotated)
+        {
+            const size_t rowBytes = static_cast<size_t>(rect.Width) * Channels;
+            for (uint32_t y = 0; y < rect.Height; ++y)
+                std::memcpy(texel(rect.X, rect.Y + y), imagePixels + y * rowBytes, rowBytes);
+        }
+        else
+        {
+            // Source is Height x Width; its row y becomes page column (Width - 1 - y)
+            const uint32_t sourceWidth = rect.Height;
+            for (uint32_t sy = 0; sy < rect.Width; ++sy)
+            {
+                for (uint32_t sx = 0; sx < sourceWidth; ++sx)
+                {
+                    const uint8_t* src = imagePixels + (static_cast<size_t>(sy) * sourceWidth + sx) * Channels;
+                    std::memcpy(texel(rect.X + rect.Width - 1 - sy, rect.Y + sx), src, Channels);
+                }
+            }
+        }
+
+        const uint32_t left = std::min(extrude, rect.X);
+        const uint32_t right = std::min(extrude, pageWidth - (rect.X + rect.Width));
+        const uint32_t top = std::min(extrude, rect.Y);
+        const uint32_t bottom = std::min(extrude, pageHeight - (rect.Y + rect.Height));
+
+        for (uint32_t y = rect.Y; y < rect.Y + rect.Height; ++y)
+        {
+            for (uint32_t e = 1; e <= left; ++e)
+                std::memcpy(texel(rect.X - e, y), texel(rect.X, y), Channels);
+            for (uint32_t e = 1; e <= right; ++e)
+                std::memcpy(texel(rect.X + rect.Width - 1 + e, y), texel(rect.X + rect.Width - 1, y), Channels);
+        }
+
+        // Whole extruded rows, which fills the corners as well
+        const uint32_t rowX = rect.X - left;
+        const size_t rowBytes = static_cast<size_t>(left + rect.Width + right) * Channels;
+
+        for (uint32_t e = 1; e <= top; ++e)
+            std::memcpy(texel(rowX, rect.Y - e), texel(rowX, rect.Y), rowBytes);
+        for (uint32_t e = 1; e <= bottom; ++e)
+            std::memcpy(texel(rowX, rect.Y + rect.Height - 1 + e), texel(rowX, rect.Y + rect.Height - 1), rowBytes);
+    }
+}
@@ -3,6 +3,8 @@
 
 #include "Platform/OpenGL/OpenGLIndexBuffer.h"
 
+#include <vector>
+
 using namespace Boon;
 
 std::shared_ptr<IndexBuffer> Boon::IndexBuffer::Create(uint32_t* indices, uint32_t count)
@@ -13,4 +15,25 @@ std::shared_ptr<IndexBuffer> Boon::IndexBuffer::Create(uint32_t* indices, uint32
 		return std::make_shared<OpenGLIndexBuffer>(indices, count);
 	}
 	return nullptr;
+}
+
+std::shared_ptr<IndexBuffer> Boon::IndexBuffer::CreateQuadPattern(uint32_t quadCount)
+{
+	std::vector<uint32_t> indices(static_cast<size_t>(quadCount) * 6);
+
+	uint32_t offset = 0;
+	for (size_t i = 0; i < indices.size(); i += 6)
+	{
+		indices[i + 0] = offset + 0;
+		indices[i + 1] = offset + 1;
+		indices[i + 2] = offset + 2;
+
+		indices[i + 3] = offset + 2;
+		indices[i + 4] = offset + 3;
+		indices[i + 5] = offset + 0;
+
+		offset += 4;
+	}
+
+	return Create(indices.data(), static_cast<uint32_t>(indices.size()));
 }
\ No newline at end of file
@@ -0,0 +1,139 @@
+#include "Renderer/Material.h"
+#include "Core/Hash.h"
+
+using namespace Boon;
+
+namespace
+{
+	uint64_t HashPipelineState(const Pipeline* pipeline)
+	{
+		uint64_t hash = FnvOffset;
+		if (!pipeline)
+			return hash;
+
+		const PipelineDescriptor& desc = pipeline->GetDescriptor();
+		hash = HashValue(hash, desc.Shader.get());
+		hash = HashValue(hash, desc.Layout.GetStride());
+		hash = HashValue(hash, desc.Primitive);
+		hash = HashValue(hash, desc.Blend);
+		hash = HashValue(hash, desc.Depth);
+		hash = HashValue(hash, desc.Cull);
+		return hash;
+	}
+
+	bool SamePipelineState(const Pipeline* a, const Pipeline* b)
+	{
+		if (a == b)
+			return true;
+		if (!a || !b)
+			return false;
+
+		const PipelineDescriptor& da = a->GetDescriptor();
+		const PipelineDescriptor& db = b->GetDescriptor();
+		return da.Shader == db.Shader
+			&& da.Layout.GetStride() == db.Layout.GetStride()
+			&& da.Primitive == db.Primitive
+			&& da.Blend == db.Blend
+			&& da.Depth == db.Depth
+			&& da.Cull == db.Cull;
+	}
+
+	bool SameBytes(const Buffer& a, const Buffer& b)
+	{
+		return a.Size() == b.Size() && (a.Size() == 0 || std::memcmp(a.Data(), b.Data(), a.Size()) == 0);
+	}
+
+	// Bindings are compared in ID order; materials built from the same layout
+	// declare their textures identically, and unbound entries are skipped.
+	bool SameTextures(
+		const std::vector<MaterialTextureBinding>& a, uint32_t ignoreA,
+		const std::vector<MaterialTextureBinding>& b, uint32_t ignoreB)
+	{
+		auto nextBound = [](const std::vector<MaterialTextureBinding>& bindings, uint32_t ignore, size_t i)
+			{
+				while (i < bindings.size() && (!bindings[i].Texture || i == ignore))
+					++i;
+				return i;
+			};
+
+		size_t i = nextBound(a, ignoreA, 0);
+		size_t j = nextBound(b, ignoreB, 0);
+
+		while (i < a.size() && j < b.size())
+		{
+			if (a[i].Texture != b[j].Texture || a[i].Slot != b[j].Slot || a[i].Name != b[j].Name)
+				return false;
+
+			i = nextBound(a, ignoreA, i + 1);
+			j = nextBound(b, ignoreB, j + 1);
+		}
+
+		return i == a.size() && j == b.size();
+	}
+}
+
+uint64_t Material::GetContentHash() const
+{
+	if (m_HashDirty)
+		UpdateHashes();
+	return m_ContentHash;
+}
+
+uint64_t Material::GetBatchHash() const
+{
+	if (m_HashDirty)
+		UpdateHashes();
+	return m_BatchHash;
+}
+
+uint64_t Material::GetParameterHash() const
+{
+	if (m_HashDirty)
+		UpdateHashes();
+	return m_ParameterHash;
+}
+
+bool Material::HasSameContent(const Material& other) const
+{
+	return SamePipelineState(m_Pipeline.get(), other.m_Pipeline.get())
+		&& SameBytes(m_Data, other.m_Data)
+		&& SameTextures(m_Textures, MaterialTextureID::Invalid, other.m_Textures, MaterialTextureID::Invalid);
+}
+
+bool Material::IsBatchCompatible(const Material& other) const
+{
+	if (!SamePipelineState(m_Pipeline.get(), other.m_Pipeline.get()))
+		return false;
+
+	return SameTextures(m_Textures, m_SpriteTextureID.Index, other.m_Textures, other.m_SpriteTextureID.Index);
+}
+
+void Material::UpdateHashes() const
+{
+	const uint64_t pipelineHash = HashPipelineState(m_Pipeline.get());
+	const uint64_t dataHash = HashBytes(FnvOffset, m_Data.Data(), m_Data.Size());
+
+	uint64_t textureHash = FnvOffset;
+	uint64_t batchTextureHash = FnvOffset;
+	for (size_t i = 0; i < m_Textures.size(); ++i)
+	{
+		const MaterialTextureBinding& binding = m_Textures[i];
+		if (!binding.Texture)
+			continue;
+
+		uint64_t h = HashBytes(FnvOffset, binding.Name.data(), binding.Name.size());
+		h = HashValue(h, binding.Texture.get());
+		h = HashValue(h, binding.Slot);
+
+		textureHash = HashValue(textureHash, h);
+		if (i != m_SpriteTextureID.Index)
+			batchTextureHash = HashValue(batchTextureHash, h);
+	}
+
+	m_ContentHash = HashValue(HashValue(pipelineHash, dataHash), textureHash);
+
+	m_BatchHash = HashValue(pipelineHash, batchTextureHash);
+	m_ParameterHash = dataHash;
+
+	m_HashDirty = false;
+}
@@ -0,0 +1,58 @@
+#include "Renderer/MaterialInstanceCache.h"
+
+using namespace Boon;
+
+std::unordered_multimap<uint64_t, std::weak_ptr<Material>> MaterialInstanceCache::s_Entries;
+uint32_t MaterialInstanceCache::s_AcquiresSincePurge = 0;
+
+namespace
+{
+	constexpr uint32_t PurgeInterval = 256;
+}
+
+std::shared_ptr<Material> MaterialInstanceCache::Acquire(const std::shared_ptr<Material>& material)
+{
+	if (!material)
+		return nullptr;
+
+	if (++s_AcquiresSincePurge >= PurgeInterval)
+		PurgeExpired();
+
+	const uint64_t hash = material->GetContentHash();
+
+	auto [begin, end] = s_Entries.equal_range(hash);
+	for (auto it = begin; it != end; ++it)
+	{
+		std::shared_ptr<Material> canonical = it->second.lock();
+		if (canonical && canonical->HasSameContent(*material))
+			return canonical;
+	}
+
+	s_Entries.emplace(hash, material);
+	return material;
+}
+
+size_t MaterialInstanceCache::GetSize()
+{
+	PurgeExpired();
+	return s_Entries.size();
+}
+
+void MaterialInstanceCache::Clear()
+{
+	s_Entries.clear();
+	s_AcquiresSincePurge = 0;
+}
+
+void MaterialInstanceCache::PurgeExpired()
+{
+	s_AcquiresSincePurge = 0;
+
+	for (auto it = s_Entries.begin(); it != s_Entries.end();)
+	{
+		if (it->second.expired())
+			it = s_Entries.erase(it);
+		else
+			++it;
+	}
+}
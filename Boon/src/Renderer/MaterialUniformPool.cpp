@@ -0,0 +1,139 @@
+#include "Renderer/MaterialUniformPool.h"
+
+using namespace Boon;
+
+std::vector<MaterialUniformPool::Page> MaterialUniformPool::s_Pages;
+std::unordered_map<uint32_t, std::vector<MaterialUniformPool::FreeRange>> MaterialUniformPool::s_FreeRanges;
+
+MaterialUniformAllocation::~MaterialUniformAllocation()
+{
+	Release();
+}
+
+MaterialUniformAllocation::MaterialUniformAllocation(MaterialUniformAllocation&& other) noexcept
+	: m_pPage(std::move(other.m_pPage))
+	, m_Offset(other.m_Offset)
+	, m_Size(other.m_Size)
+	, m_PageSize(other.m_PageSize)
+{
+	other.m_pPage = nullptr;
+	other.m_Size = 0;
+}
+
+MaterialUniformAllocation& MaterialUniformAllocation::operator=(MaterialUniformAllocation&& other) noexcept
+{
+	if (this != &other)
+	{
+		Release();
+
+		m_pPage = std::move(other.m_pPage);
+		m_Offset = other.m_Offset;
+		m_Size = other.m_Size;
+		m_PageSize = other.m_PageSize;
+
+		other.m_pPage = nullptr;
+		other.m_Size = 0;
+	}
+	return *this;
+}
+
+void MaterialUniformAllocation::Upload(const void* data, size_t size)
+{
+	if (!m_pPage)
+		return;
+
+	m_pPage->SetData(data, size < m_Size ? size : m_Size, m_Offset);
+}
+
+void MaterialUniformAllocation::Bind(uint32_t binding) const
+{
+	if (m_pPage)
+		m_pPage->BindRange(binding, m_Offset, m_Size);
+}
+
+void MaterialUniformAllocation::Release()
+{
+	if (!m_pPage)
+		return;
+
+	MaterialUniformPool::Free(m_pPage, m_Offset, m_Size);
+	m_pPage = nullptr;
+	m_Size = 0;
+}
+
+uint32_t MaterialUniformPool::AlignSize(uint32_t size)
+{
+	const uint32_t alignment = UniformBuffer::GetOffsetAlignment();
+	return (size + alignment - 1) / alignment * alignment;
+}
+
+MaterialUniformAllocation MaterialUniformPool::Allocate(uint32_t size, uint32_t binding)
+{
+	MaterialUniformAllocation allocation;
+	if (size == 0)
+		return allocation;
+
+	const uint32_t alignedSize = AlignSize(size);
+
+	auto& freeRanges = s_FreeRanges[alignedSize];
+	while (!freeRanges.empty())
+	{
+		FreeRange range = freeRanges.back();
+		freeRanges.pop_back();
+
+		if (auto page = range.Page.lock())
+		{
+			allocation.m_pPage = std::move(page);
+			allocation.m_Offset = range.Offset;
+			allocation.m_Size = alignedSize;
+			allocation.m_PageSize = PageSize;
+			return allocation;
+		}
+	}
+
+	// Oversized blocks get a dedicated buffer
+	if (alignedSize > PageSize)
+	{
+		allocation.m_pPage = UniformBuffer::Create(alignedSize, binding);
+		allocation.m_Offset = 0;
+		allocation.m_Size = alignedSize;
+		allocation.m_PageSize = alignedSize;
+		return allocation;
+	}
+
+	if (s_Pages.empty() || s_Pages.back().Used + alignedSize > PageSize)
+	{
+		Page page{};
+		page.Buffer = UniformBuffer::Create(PageSize, binding);
+		if (!page.Buffer)
+			return allocation;
+		s_Pages.push_back(std::move(page));
+	}
+
+	Page& page = s_Pages.back();
+	allocation.m_pPage = page.Buffer;
+	allocation.m_Offset = page.Used;
+	allocation.m_Size = alignedSize;
+	allocation.m_PageSize = PageSize;
+	page.Used += alignedSize;
+
+	return allocation;
+}
+
+void MaterialUniformPool::Clear()
+{
+	s_Pages.clear();
+	s_FreeRanges.clear();
+}
+
+void MaterialUniformPool::Free(const std::shared_ptr<UniformBuffer>& page, uint32_t offset, uint32_t size)
+{
+	for (const Page& p : s_Pages)
+	{
+		if (p.Buffer == page)
+		{
+			s_FreeRanges[size].push_back({ page, offset });
+			return;
+		}
+	}
+}
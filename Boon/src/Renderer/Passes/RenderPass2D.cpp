@@ -3,6 +3,7 @@
 #include <Renderer/Renderer2D.h>
 #include <Renderer/Renderer3D.h>
 #include <Renderer/Material.h>
+#include <Renderer/MaterialInstanceCache.h>
 
 #include <Scene/Scene.h>
 
@@ -17,12 +18,17 @@
 #include <Asset/SpriteAtlasAsset.h>
 #include <Asset/MaterialAsset.h>
 
+#include <algorithm>
+
 namespace
 {
+	// bShared: the instance is never modified per entity, so identical overrides
+	// can resolve to one canonical material and batch together.
 	template<typename Component>
 	std::shared_ptr<Boon::Material> ResolveMaterialInstance(
 		Component& component,
-		const std::shared_ptr<Boon::Material>& fallbackMaterial)
+		const std::shared_ptr<Boon::Material>& fallbackMaterial,
+		bool bShared = false)
 	{
 		Boon::MaterialAsset* materialAsset = nullptr;
 		Boon::AssetHandle sourceHandle = 0;
@@ -43,7 +49,9 @@ namespace
 				component.MaterialInstanceSource != sourceHandle ||
 				component.MaterialInstanceVersion != sourceVersion)
 			{
-				component.MaterialInstance = materialAsset->CreateMaterial();
+				component.MaterialInstance = bShared
+					? Boon::MaterialInstanceCache::Acquire(materialAsset->CreateMaterial())
+					: materialAsset->CreateMaterial();
 				component.MaterialInstanceSource = sourceHandle;
 				component.MaterialInstanceVersion = sourceVersion;
 			}
@@ -101,12 +109,12 @@ void Boon::SpriteRenderPass::Execute(RenderContext& context)
 		if (sprite.MaterialOverride.IsValid())
 		{
 			std::shared_ptr<Material> material =
-				ResolveMaterialInstance(sprite, m_pMaterial);
+				ResolveMaterialInstance(sprite, m_pMaterial, true);
 
 			if (!material)
 				continue;
 
-			material->SetTexture("u_Texture", texture, 0);
+			// The sprite texture travels with the item, Renderer2D binds it through the batch slots
 			item.MaterialOverride = material;
 		}
 
@@ -142,12 +150,11 @@ void Boon::TextureRenderPass::Execute(RenderContext& context)
 		if (tc.MaterialOverride.IsValid())
 		{
 			std::shared_ptr<Material> material =
-				ResolveMaterialInstance(tc, m_pMaterial);
+				ResolveMaterialInstance(tc, m_pMaterial, true);
 
 			if (!material)
 				continue;
 
-			material->SetTexture("u_Texture", texture, 0);
 			item.MaterialOverride = material;
 		}
 
@@ -181,21 +188,59 @@ void Boon::TilemapRenderPass::Execute(RenderContext& context)
 		if (!texture)
 			continue;
 
+		const bool bLookup =
+			tilemap.Mode == static_cast<int>(TilemapRendererComponent::RenderMode::TileLookup) && m_pLookupMaterial;
+
+		// The fallback material depends on the mode, drop the cached instance when it changes
+		const int mode = bLookup ? tilemap.Mode : static_cast<int>(TilemapRendererComponent::RenderMode::Mesh);
+		if (tilemap.MaterialInstanceMode != mode)
+		{
+			tilemap.MaterialInstance = nullptr;
+			tilemap.MaterialInstanceMode = mode;
+		}
+
 		std::shared_ptr<Material> material =
-			ResolveMaterialInstance(tilemap, m_pMaterial);
+			ResolveMaterialInstance(tilemap, bLookup ? m_pLookupMaterial : m_pMaterial);
 
 		if (!material)
 			continue;
 
-		material->SetTexture("u_Texture", texture, 0);
+		MaterialTextureID textureID = material->GetSpriteTextureID();
+		if (!textureID.IsValid())
+			textureID = material->GetOrAddTextureID(Material::SpriteTextureName);
+
+		material->SetTexture(textureID, texture, 0);
+
+		if (tilemapAsset->IsStreaming())
+		{
+			// Camera in tilemap space, in tiles
+			const glm::vec4 local = glm::inverse(transform.GetWorld()) * glm::vec4(context.CameraPosition, 1.0f);
+			tilemapAsset->UpdateStreaming(glm::vec2(local) / tilemapAsset->GetUnitSize(), tilemap.StreamRadius);
+		}
+
+		if (bLookup)
+		{
+			tilemapAsset->UpdateLookupTextures();
 
-		tilemapAsset->RebuildDirtyChunks();
+			if (!tilemapAsset->GetTileIndexTexture() || !tilemapAsset->GetFrameTableTexture())
+				continue;
 
-		for (auto& chunk : tilemapAsset->GetChunks())
+			material->SetTexture(material->GetOrAddTextureID("u_TileIndices"), tilemapAsset->GetTileIndexTexture(), 1);
+			material->SetTexture(material->GetOrAddTextureID("u_FrameTable"), tilemapAsset->GetFrameTableTexture(), 2);
+		}
+		else
 		{
+			tilemapAsset->RebuildDirtyChunks(static_cast<uint32_t>(std::max(tilemap.RebuildBudget, 0)));
+		}
+
+		for (const auto& [key, chunk] : tilemapAsset->GetChunks())
+		{
+			if (chunk.TileCount == 0)
+				continue;
+
 			GeometryRenderItem3D item{};
 			item.Transform = transform.GetWorld();
-			item.VertexInput = chunk.VertexInput;
+			item.VertexInput = bLookup ? chunk.LookupQuad : chunk.VertexInput;
 			item.Material = material;
 			item.EntityID = static_cast<int>((GameObjectID)gameObject);
 
@@ -47,15 +47,16 @@ namespace Boon
         if (!m_pMaterial || m_VertexCount == 0)
             return;
 
-        if (m_PreFlushFunc)
-            m_PreFlushFunc();
-
         uint32_t dataSize = static_cast<uint32_t>(m_BufferPtr - m_BufferBase);
         if (dataSize > 0)
             m_VertexBuffer->SetData(m_BufferBase, dataSize);
 
         m_pMaterial->Bind();
 
+        // After the material, so the callback can override what it bound
+        if (m_PreFlushFunc)
+            m_PreFlushFunc();
+
         switch (m_pMaterial->GetPipeline()->GetDescriptor().Primitive)
         {
         case PrimitiveType::Triangles:
@@ -1,5 +1,7 @@
 #include "Renderer/Renderer.h"
 #include "Renderer/RenderAPI.h"
+#include "Renderer/MaterialUniformPool.h"
+#include "Renderer/MaterialInstanceCache.h"
 
 using namespace Boon;
 
@@ -12,6 +14,8 @@ void Boon::Renderer::Init()
 
 void Boon::Renderer::Shutdown()
 {
+	MaterialInstanceCache::Clear();
+	MaterialUniformPool::Clear();
 	s_pApi->Shutdown();
 }
 
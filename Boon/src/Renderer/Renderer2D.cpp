@@ -9,10 +9,12 @@
 #include "Renderer/UniformBuffer.h"
 #include "Renderer/UBData.h"
 #include "Renderer/Material.h"
+#include "Core/Hash.h"
 
 #include <glm/gtc/matrix_transform.hpp>
 
 #include <algorithm>
+#include <unordered_set>
 
 namespace Boon
 {
@@ -68,25 +70,7 @@ Renderer2D::Renderer2D(const Renderer2DCreateInfo& desc)
 	uint32_t whiteTextureData = 0xffffffff;
 	m_pWhiteTexture->SetData(&whiteTextureData, sizeof(uint32_t));
 
-	uint32_t* quadIndices = new uint32_t[s_MaxIndices];
-
-	uint32_t offset = 0;
-	for (uint32_t i = 0; i < s_MaxIndices; i += 6)
-	{
-		quadIndices[i + 0] = offset + 0;
-		quadIndices[i + 1] = offset + 1;
-		quadIndices[i + 2] = offset + 2;
-
-		quadIndices[i + 3] = offset + 2;
-		quadIndices[i + 4] = offset + 3;
-		quadIndices[i + 5] = offset + 0;
-
-		offset += 4;
-	}
-
-	m_QuadIndexBuffer = IndexBuffer::Create(quadIndices, s_MaxIndices);
-
-	delete[] quadIndices;
+	m_QuadIndexBuffer = IndexBuffer::CreateQuadPattern(s_MaxQuads);
 
 	if (m_pDefaultLineMaterial)
 		m_LineBatch.Initialize(s_MaxVertices, m_pDefaultLineMaterial);
@@ -100,6 +84,9 @@ Renderer2D::~Renderer2D()
 
 void Renderer2D::Begin(RenderContext&)
 {
+	++m_FrameIndex;
+	m_Stats = {};
+
 	for (auto& [key, state] : m_QuadBatches)
 		state.Batch.Begin();
 
@@ -111,9 +98,23 @@ void Renderer2D::End(RenderContext& ctx)
 	FlushRenderQueue(ctx);
 
 	for (auto& [key, state] : m_QuadBatches)
+	{
+		if (state.Batch.GetVertexCount() > 0)
+			++m_Stats.BatchCount;
+
 		state.Batch.Flush();
+	}
 
 	m_LineBatch.Flush();
+
+	// Batches for materials that stopped showing up (destroyed overrides, old versions)
+	// would otherwise keep their vertex staging memory forever.
+	std::erase_if(m_QuadBatches, [this](const auto& entry)
+		{
+			const QuadBatchState& state = entry.second;
+			return state.Material != m_pDefaultQuadMaterial
+				&& state.LastUsedFrame + s_UnusedBatchFrames < m_FrameIndex;
+		});
 }
 
 void Renderer2D::SubmitQuad(const QuadRenderItem2D& item)
@@ -177,6 +178,23 @@ void Renderer2D::SubmitLine(const glm::vec3& p0, const glm::vec3& p1, const glm:
 	m_RenderQueue.Submit(item);
 }
 
+void Renderer2D::SubmitLines(const std::vector<LineRenderItem2D>& lines)
+{
+	if (!m_pDefaultLineMaterial)
+		return;
+
+	for (const LineRenderItem2D& line : lines)
+	{
+		LineVertex& vertex0 = m_LineBatch.PushVertex<LineVertex>();
+		vertex0.Position = line.P0;
+		vertex0.Color = line.Color;
+
+		LineVertex& vertex1 = m_LineBatch.PushVertex<LineVertex>();
+		vertex1.Position = line.P1;
+		vertex1.Color = line.Color;
+	}
+}
+
 void Renderer2D::SubmitRect(const glm::vec3& position, const glm::vec2& size, const glm::vec4& color)
 {
 	glm::vec3 p0 = position + glm::vec3(m_QuadVertexPositions[0]) * glm::vec3(size.x, size.y, 1.0f);
@@ -227,25 +245,52 @@ void Renderer2D::FlushRenderQueue(RenderContext&)
 {
 	constexpr size_t quadVertexCount = 4;
 
-	std::vector<QuadRenderItem2D> quads = m_RenderQueue.GetQuads();
+	const std::vector<QuadRenderItem2D>& queuedQuads = m_RenderQueue.GetQuads();
+	m_Stats.QuadCount += static_cast<uint32_t>(queuedQuads.size());
+
+	struct SortedQuad
+	{
+		uint64_t BatchHash;
+		const UniformBuffer* UniformPage;
+		const QuadRenderItem2D* Item;
+	};
+
+	std::vector<SortedQuad> quads;
+	quads.reserve(queuedQuads.size());
+	for (const QuadRenderItem2D& quad : queuedQuads)
+	{
+		const Material* material = quad.MaterialOverride ? quad.MaterialOverride.get() : m_pDefaultQuadMaterial.get();
+		if (!material)
+		{
+			quads.push_back({ 0, nullptr, &quad });
+			continue;
+		}
+
+		quads.push_back({ material->GetBatchHash(), material->GetUniformPage().get(), &quad });
+	}
 
 	std::sort(quads.begin(), quads.end(),
-		[](const QuadRenderItem2D& a, const QuadRenderItem2D& b)
+		[](const SortedQuad& a, const SortedQuad& b)
 		{
-			Material* materialA = a.MaterialOverride.get();
-			Material* materialB = b.MaterialOverride.get();
+			if (a.BatchHash != b.BatchHash)
+				return a.BatchHash < b.BatchHash;
 
-			if (materialA != materialB)
-				return materialA < materialB;
+			if (a.UniformPage != b.UniformPage)
+				return std::less<const UniformBuffer*>{}(a.UniformPage, b.UniformPage);
 
-			if (a.SortLayer != b.SortLayer)
-				return a.SortLayer < b.SortLayer;
+			if (a.Item->SortLayer != b.Item->SortLayer)
+				return a.Item->SortLayer < b.Item->SortLayer;
 
-			return a.SortOrder < b.SortOrder;
+			return a.Item->SortOrder < b.Item->SortOrder;
 		});
 
-	for (const QuadRenderItem2D& quad : quads)
+	const Material* lastMaterial = nullptr;
+	QuadBatchState* batchStatePtr = nullptr;
+
+	for (const SortedQuad& sorted : quads)
 	{
+		const QuadRenderItem2D& quad = *sorted.Item;
+
 		glm::vec2 texCoords[quadVertexCount] =
 		{
 			{ quad.UV0.x, quad.UV0.y },
@@ -258,21 +303,33 @@ void Renderer2D::FlushRenderQueue(RenderContext&)
 		float tilingFactor = quad.TilingFactor;
 		std::shared_ptr<Texture2D> texture = quad.Texture;
 
-		std::shared_ptr<Material> material =
+		const std::shared_ptr<Material>& material =
 			quad.MaterialOverride ? quad.MaterialOverride : m_pDefaultQuadMaterial;
 
-		QuadBatchState& batchState = GetOrCreateQuadBatch(material);
+		// Shared (canonical) override materials make consecutive quads hit the same batch
+		if (material.get() != lastMaterial || !batchStatePtr)
+		{
+			batchStatePtr = &GetOrCreateQuadBatch(material);
+			lastMaterial = material.get();
+
+			// The batch draws with the page, never binding this material itself
+			material->UploadUniforms();
+		}
+		QuadBatchState& batchState = *batchStatePtr;
+		const int materialSlot = static_cast<int>(material->GetUniformSlot());
 
 		if (quad.MaterialOverride)
 		{
+			// Per-instance parameters become vertex attributes, or are read
+			// through materialSlot, so differing values do not split the batch.
 			if (const auto* data = quad.MaterialOverride->GetDataAs<QuadMaterialData>())
 			{
 				color = data->Color;
 				tilingFactor = data->TilingFactor;
 			}
 
-			if (auto materialTexture = quad.MaterialOverride->GetTexture("u_Texture"))
-				texture = materialTexture;
+			if (!texture)
+				texture = quad.MaterialOverride->GetTexture(quad.MaterialOverride->GetSpriteTextureID());
 		}
 
 		const float textureIndex = ResolveTextureSlot(
@@ -291,6 +348,7 @@ void Renderer2D::FlushRenderQueue(RenderContext&)
 			vertex.TexIndex = textureIndex;
 			vertex.TilingFactor = tilingFactor;
 			vertex.GameObjectID = quad.EntityID;
+			vertex.MaterialSlot = materialSlot;
 		}
 	}
 
@@ -312,18 +370,42 @@ void Renderer2D::FlushRenderQueue(RenderContext&)
 
 Renderer2D::QuadBatchState& Renderer2D::GetOrCreateQuadBatch(const std::shared_ptr<Material>& material)
 {
-	std::shared_ptr<Material> resolvedMaterial = material ? material : m_pDefaultQuadMaterial;
+	const std::shared_ptr<Material>& resolvedMaterial = material ? material : m_pDefaultQuadMaterial;
 
-	QuadBatchKey key{};
-	key.Material = resolvedMaterial;
+	QuadBatchKey lookup{};
+	lookup.Hash = resolvedMaterial->GetBatchHash();
+	lookup.Material = resolvedMaterial.get();
+	lookup.UniformPage = resolvedMaterial->GetUniformPage().get();
 
-	auto it = m_QuadBatches.find(key);
+	auto it = m_QuadBatches.find(lookup);
 	if (it != m_QuadBatches.end())
+	{
+		it->second.LastUsedFrame = m_FrameIndex;
 		return it->second;
+	}
+
+	// The batch keeps its own snapshot so later edits to the source instance
+	// cannot invalidate the key. The sprite texture is bound through the slots.
+	std::shared_ptr<Material> batchMaterial = resolvedMaterial;
+	if (resolvedMaterial != m_pDefaultQuadMaterial)
+	{
+		batchMaterial = resolvedMaterial->CreateInstance();
+		batchMaterial->RemoveTexture(batchMaterial->GetSpriteTextureID());
+	}
+
+	QuadBatchKey key{};
+	key.Hash = lookup.Hash;
+	key.Material = batchMaterial.get();
+	key.UniformPage = lookup.UniformPage;
 
 	auto& state = m_QuadBatches[key];
 
-	state.Material = resolvedMaterial;
+	state.Material = batchMaterial;
+	state.LastUsedFrame = m_FrameIndex;
+
+	// Keeps the page alive, and with it the key's pointer
+	state.UniformPage = resolvedMaterial->GetUniformPage();
+	state.UniformPageSize = resolvedMaterial->GetUniformPageSize();
 	state.TextureSlots[0] = m_pWhiteTexture;
 	state.TextureSlotIndex = 1;
 
@@ -335,14 +417,46 @@ Renderer2D::QuadBatchState& Renderer2D::GetOrCreateQuadBatch(const std::shared_p
 			state.TextureSlotIndex = 1;
 		});
 
-	state.Batch.BindPreFlushCallback([&state]()
+	state.Batch.BindPreFlushCallback([this, &state]()
 		{
+			++m_Stats.DrawCalls;
+
 			for (uint32_t i = 0; i < state.TextureSlotIndex; ++i)
 			{
 				if (state.TextureSlots[i])
 					state.TextureSlots[i]->Bind(i);
 			}
+
+			if (state.UniformPage)
+				state.UniformPage->BindRange(state.Material->GetLayout().UniformBinding, 0, state.UniformPageSize);
 		});
 
 	return state;
-}
\ No newline at end of file
+}
+
+Renderer2DBatchComparison Renderer2D::CompareBatchCounts(std::span<const QuadRenderItem2D> quads, const Material* defaultMaterial)
+{
+	std::unordered_set<uint64_t> parameterKeyed;
+	std::unordered_set<uint64_t> pageIndexed;
+
+	for (const QuadRenderItem2D& quad : quads)
+	{
+		const Material* material = quad.MaterialOverride ? quad.MaterialOverride.get() : defaultMaterial;
+		if (!material)
+			continue;
+
+		const uint64_t pageKey = HashValue(material->GetBatchHash(), material->GetUniformPage().get());
+		pageIndexed.insert(pageKey);
+
+		// Before, shaders with a material block got one batch per distinct parameter block
+		const uint64_t parameterKey = material->UsesUniformBlock()
+			? HashValue(material->GetBatchHash(), material->GetParameterHash())
+			: material->GetBatchHash();
+		parameterKeyed.insert(parameterKey);
+	}
+
+	Renderer2DBatchComparison comparison{};
+	comparison.ParameterKeyed = static_cast<uint32_t>(parameterKeyed.size());
+	comparison.PageIndexed = static_cast<uint32_t>(pageIndexed.size());
+	return comparison;
+}
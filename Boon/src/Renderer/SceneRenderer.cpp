@@ -50,6 +50,7 @@ Boon::SceneRenderer::SceneRenderer(const SceneRendererCreateInfo& desc)
 
 	auto quadShader = assetLib.Load<ShaderAsset>("shaders/Quad.glsl");
 	auto tilemapShader = assetLib.Load<ShaderAsset>("shaders/Tilemap.glsl");
+	auto tilemapLookupShader = assetLib.Load<ShaderAsset>("shaders/TilemapLookup.glsl");
 	auto lineShader = assetLib.Load<ShaderAsset>("shaders/Line.glsl");
 
 	Renderer2DCreateInfo renderer2dDesc{};
@@ -62,6 +63,10 @@ Boon::SceneRenderer::SceneRenderer(const SceneRendererCreateInfo& desc)
 	if (tilemapShader.IsValid())
 		m_pDefaultTilemapMaterial = MaterialFactory::CreateFromShaderAsset(*tilemapShader.Get());
 
+	std::shared_ptr<Material> tilemapLookupMaterial = nullptr;
+	if (tilemapLookupShader.IsValid())
+		tilemapLookupMaterial = MaterialFactory::CreateFromShaderAsset(*tilemapLookupShader.Get());
+
 	if (lineShader.IsValid())
 		renderer2dDesc.pLineMaterial = MaterialFactory::CreateFromShaderAsset(*lineShader.Get(), BlendMode::Alpha, DepthMode::ReadWrite, CullMode::None, PrimitiveType::Lines);
 
@@ -70,7 +75,7 @@ Boon::SceneRenderer::SceneRenderer(const SceneRendererCreateInfo& desc)
 
 	AddPass(std::make_unique<SpriteRenderPass>(m_pDefaultQuadMaterial));
 	AddPass(std::make_unique<TextureRenderPass>(m_pDefaultQuadMaterial));
-	AddPass(std::make_unique<TilemapRenderPass>(m_pDefaultTilemapMaterial));
+	AddPass(std::make_unique<TilemapRenderPass>(m_pDefaultTilemapMaterial, tilemapLookupMaterial));
 }
 Boon::SceneRenderer::~SceneRenderer()
 {
@@ -131,6 +136,8 @@ void Boon::SceneRenderer::BeginScene(RenderContext& ctx, Camera* camera, Transfo
 	{
 		m_CameraData.ViewProjection = camera->GetProjection() * glm::inverse(cameraTransform->GetWorld());
 		m_pCameraUniformBuffer->SetValue(m_CameraData);
+
+		ctx.CameraPosition = glm::vec3(cameraTransform->GetWorld()[3]);
 	}
 
 	m_pOutputFB->Bind();
@@ -4,12 +4,12 @@
 
 using namespace Boon;
 
-std::shared_ptr<Shader> Boon::Shader::Create(const std::string& vertexSrc, const std::string& fragmentSrc)
+std::shared_ptr<Shader> Boon::Shader::Create(const std::string& vertexSrc, const std::string& fragmentSrc, uint64_t cacheKey)
 {
 	switch (RenderAPI::GetAPI())
 	{
 	case ERenderAPI::OpenGL:
-		return std::make_shared<OpenGLShader>(vertexSrc, fragmentSrc);
+		return std::make_shared<OpenGLShader>(vertexSrc, fragmentSrc, cacheKey);
 	}
 	return nullptr;
 }
@@ -0,0 +1,400 @@
+#include "Renderer/ShaderCompiler/ShaderCache.h"
+#include "Core/Hash.h"
+
+#include <atomic>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+
+namespace Boon
+{
+    namespace
+    {
+        constexpr uint32_t CacheMagic = 0x43485342; // "BSHC"
+        constexpr uint32_t CacheVersion = 1;
+
+        enum class EntryKind : uint32_t
+        {
+            Reflection = 1,
+            ProgramBinary = 2,
+            Preprocessed = 3
+        };
+
+        std::mutex s_DirectoryMutex;
+        std::filesystem::path s_Directory;
+        std::atomic<uint32_t> s_TempCounter{ 0 };
+
+        const char* GetExtension(EntryKind kind)
+        {
+            switch (kind)
+            {
+            case EntryKind::Reflection:    return ".refl";
+            case EntryKind::ProgramBinary: return ".bin";
+            case EntryKind::Preprocessed:  return ".pp";
+            }
+            return ".cache";
+        }
+
+        std::filesystem::path GetEntryPath(uint64_t key, EntryKind kind)
+        {
+            std::filesystem::path directory = ShaderCache::GetDirectory();
+            if (directory.empty())
+                return {};
+
+            static constexpr char hex[] = "0123456789abcdef";
+            char name[17] = {};
+            for (int i = 0; i < 16; ++i)
+                name[i] = hex[(key >> ((15 - i) * 4)) & 0xF];
+
+            return directory / (std::string(name) + GetExtension(kind));
+        }
+
+        /**
+         * @brief Read an entry and validate its header; the reader is left at the payload.
+         */
+        bool ReadEntry(uint64_t key, EntryKind kind, Buffer& out, BufferReader& in)
+        {
+            const std::filesystem::path path = GetEntryPath(key, kind);
+            if (path.empty())
+                return false;
+
+            std::ifstream file(path, std::ios::in | std::ios::binary);
+            if (!file)
+                return false;
+
+            out.Vector().assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+
+            in = BufferReader(out);
+            return in.Read<uint32_t>() == CacheMagic
+                && in.Read<uint32_t>() == CacheVersion
+                && in.Read<uint32_t>() == static_cast<uint32_t>(kind)
+                && in.Read<uint64_t>() == key
+                && !in.Failed();
+        }
+
+        void BeginEntry(Buffer& out, uint64_t key, EntryKind kind)
+        {
+            out.Write<uint32_t>(CacheMagic);
+            out.Write<uint32_t>(CacheVersion);
+            out.Write<uint32_t>(static_cast<uint32_t>(kind));
+            out.Write<uint64_t>(key);
+        }
+
+        // Written to a temporary file first so a concurrent reader never sees a partial entry
+        void WriteEntry(uint64_t key, EntryKind kind, const Buffer& data)
+        {
+            const std::filesystem::path path = GetEntryPath(key, kind);
+            if (path.empty())
+                return;
+
+            std::error_code ec;
+            std::filesystem::create_directories(path.parent_path(), ec);
+
+            std::filesystem::path tempPath = path;
+            tempPath += ".tmp" + std::to_string(s_TempCounter.fetch_add(1, std::memory_order_relaxed));
+
+            {
+                std::ofstream file(tempPath, std::ios::out | std::ios::binary | std::ios::trunc);
+                if (!file)
+                    return;
+
+                file.write(reinterpret_cast<const char*>(data.Data()), static_cast<std::streamsize>(data.Size()));
+                if (!file)
+                {
+                    file.close();
+                    std::filesystem::remove(tempPath, ec);
+                    return;
+                }
+            }
+
+            std::filesystem::rename(tempPath, path, ec);
+            if (ec)
+                std::filesystem::remove(tempPath, ec);
+        }
+
+        uint64_t ComputePreprocessedKey(const std::filesystem::path& directory, std::string_view rawSource)
+        {
+            uint64_t hash = HashString(FnvOffset, directory.generic_string());
+            return HashString(hash, rawSource);
+        }
+
+        bool GetFileStamp(const std::filesystem::path& path, uint64_t& outSize, int64_t& outWriteTime)
+        {
+            std::error_code ec;
+            outSize = std::filesystem::file_size(path, ec);
+            if (ec)
+                return false;
+
+            const auto writeTime = std::filesystem::last_write_time(path, ec);
+            if (ec)
+                return false;
+
+            outWriteTime = static_cast<int64_t>(writeTime.time_since_epoch().count());
+            return true;
+        }
+    }
+
+    void ShaderCache::SetDirectory(const std::filesystem::path& directory)
+    {
+        std::lock_guard lock(s_DirectoryMutex);
+        s_Directory = directory;
+    }
+
+    std::filesystem::path ShaderCache::GetDirectory()
+    {
+        std::lock_guard lock(s_DirectoryMutex);
+        return s_Directory;
+    }
+
+    bool ShaderCache::IsEnabled()
+    {
+        std::lock_guard lock(s_DirectoryMutex);
+        return !s_Directory.empty();
+    }
+
+    uint64_t ShaderCache::ComputeKey(std::string_view vertexSource, std::string_view fragmentSource)
+    {
+        uint64_t hash = HashBytes(FnvOffset, &CacheVersion, sizeof(CacheVersion));
+        hash = HashString(hash, vertexSource);
+        hash = HashString(hash, fragmentSource);
+
+        // 0 means "not cached" to callers
+        return hash != 0 ? hash : 1;
+    }
+
+    std::optional<ShaderReflection> ShaderCache::LoadReflection(uint64_t key)
+    {
+        Buffer data;
+        BufferReader in;
+        if (!ReadEntry(key, EntryKind::Reflection, data, in))
+            return std::nullopt;
+
+        ShaderReflection reflection{};
+        if (!DeserializeReflection(in, reflection))
+            return std::nullopt;
+
+        return reflection;
+    }
+
+    void ShaderCache::StoreReflection(uint64_t key, const ShaderReflection& reflection)
+    {
+        if (!IsEnabled())
+            return;
+
+        Buffer data;
+        BeginEntry(data, key, EntryKind::Reflection);
+        SerializeReflection(data, reflection);
+        WriteEntry(key, EntryKind::Reflection, data);
+    }
+
+    bool ShaderCache::LoadProgramBinary(uint64_t key, std::string_view driverTag, uint32_t& outFormat, Buffer& outBinary)
+    {
+        Buffer data;
+        BufferReader in;
+        if (!ReadEntry(key, EntryKind::ProgramBinary, data, in))
+            return false;
+
+        const std::string storedTag = in.ReadString();
+        const uint32_t format = in.Read<uint32_t>();
+        const uint64_t size = in.Read<uint64_t>();
+        const uint8_t* binary = in.Take(static_cast<size_t>(size));
+        if (in.Failed() || storedTag != driverTag)
+            return false;
+
+        outFormat = format;
+        outBinary = Buffer(binary, static_cast<size_t>(size));
+        return true;
+    }
+
+    void ShaderCache::StoreProgramBinary(uint64_t key, std::string_view driverTag, uint32_t format, const Buffer& binary)
+    {
+        if (!IsEnabled() || binary.Empty())
+            return;
+
+        Buffer data;
+        data.Reserve(binary.Size() + driverTag.size() + 64);
+        BeginEntry(data, key, EntryKind::ProgramBinary);
+        data.WriteString(std::string(driverTag));
+        data.Write<uint32_t>(format);
+        data.Write<uint64_t>(binary.Size());
+        data.Append(binary);
+        WriteEntry(key, EntryKind::ProgramBinary, data);
+    }
+
+    std::optional<std::string> ShaderCache::LoadPreprocessed(
+        const std::filesystem::path& directory,
+        std::string_view rawSource)
+    {
+        const uint64_t key = ComputePreprocessedKey(directory, rawSource);
+
+        Buffer data;
+        BufferReader in;
+        if (!ReadEntry(key, EntryKind::Preprocessed, data, in))
+            return std::nullopt;
+
+        const uint32_t dependencyCount = in.Read<uint32_t>();
+        for (uint32_t i = 0; i < dependencyCount; ++i)
+        {
+            const std::string path = in.ReadString();
+            const uint64_t storedSize = in.Read<uint64_t>();
+            const int64_t storedWriteTime = in.Read<int64_t>();
+            if (in.Failed())
+                return std::nullopt;
+
+            uint64_t size = 0;
+            int64_t writeTime = 0;
+            if (!GetFileStamp(std::filesystem::path(path), size, writeTime) ||
+                size != storedSize || writeTime != storedWriteTime)
+                return std::nullopt;
+        }
+
+        std::string resolved;
+        if (!in.ReadString(resolved))
+            return std::nullopt;
+
+        return resolved;
+    }
+
+    void ShaderCache::StorePreprocessed(
+        const std::filesystem::path& directory,
+        std::string_view rawSource,
+        const std::string& resolvedSource,
+        const std::vector<std::filesystem::path>& dependencies)
+    {
+        if (!IsEnabled())
+            return;
+
+        const uint64_t key = ComputePreprocessedKey(directory, rawSource);
+
+        Buffer data;
+        BeginEntry(data, key, EntryKind::Preprocessed);
+        data.Write<uint32_t>(static_cast<uint32_t>(dependencies.size()));
+
+        for (const std::filesystem::path& dependency : dependencies)
+        {
+            uint64_t size = 0;
+            int64_t writeTime = 0;
+            if (!GetFileStamp(dependency, size, writeTime))
+                return;
+
+            data.WriteString(dependency.string());
+            data.Write<uint64_t>(size);
+            data.Write<int64_t>(writeTime);
+        }
+
+        data.WriteString(resolvedSource);
+        WriteEntry(key, EntryKind::Preprocessed, data);
+    }
+
+    void ShaderCache::Clear()
+    {
+        const std::filesystem::path directory = GetDirectory();
+        if (directory.empty())
+            return;
+
+        std::error_code ec;
+        for (const auto& entry : std::filesystem::directory_iterator(directory, ec))
+        {
+            const std::filesystem::path extension = entry.path().extension();
+            if (extension == ".refl" || extension == ".bin" || extension == ".pp")
+                std::filesystem::remove(entry.path(), ec);
+        }
+    }
+
+    void ShaderCache::SerializeReflection(Buffer& out, const ShaderReflection& reflection)
+    {
+        const auto& elements = reflection.VertexLayout.GetElements();
+        out.Write<uint32_t>(static_cast<uint32_t>(elements.size()));
+        for (const auto& element : elements)
+        {
+            out.WriteString(element.Name);
+            out.Write<uint32_t>(static_cast<uint32_t>(element.Type));
+            out.Write<uint8_t>(element.Normalized ? 1 : 0);
+        }
+
+        const MaterialLayout& layout = reflection.MaterialLayout;
+        out.Write<uint32_t>(layout.UniformBufferSize);
+        out.Write<uint32_t>(layout.UniformBinding);
+
+        out.Write<uint32_t>(static_cast<uint32_t>(layout.Parameters.size()));
+        for (const MaterialParameter& parameter : layout.Parameters)
+        {
+            out.WriteString(parameter.Name);
+            out.Write<uint32_t>(static_cast<uint32_t>(parameter.Type));
+            out.Write<uint32_t>(parameter.Offset);
+            out.Write<uint32_t>(parameter.Size);
+        }
+
+        out.Write<uint32_t>(static_cast<uint32_t>(layout.Textures.size()));
+        for (const MaterialTextureSlot& texture : layout.Textures)
+        {
+            out.WriteString(texture.Name);
+            out.Write<uint32_t>(texture.Slot);
+            out.Write<uint32_t>(texture.Count);
+            out.Write<uint8_t>(texture.IsArray ? 1 : 0);
+        }
+    }
+
+    bool ShaderCache::DeserializeReflection(BufferReader& in, ShaderReflection& outReflection)
+    {
+        uint32_t elementCount = 0;
+        if (!in.Read(elementCount))
+            return false;
+
+        std::vector<VertexBufferLayout::Element> elements;
+        for (uint32_t i = 0; i < elementCount; ++i)
+        {
+            std::string name;
+            uint32_t type = 0;
+            uint8_t normalized = 0;
+            if (!in.ReadString(name) || !in.Read(type) || !in.Read(normalized))
+                return false;
+
+            elements.emplace_back(static_cast<ShaderDataType>(type), name, normalized != 0);
+        }
+        outReflection.VertexLayout = VertexBufferLayout(elements);
+
+        MaterialLayout& layout = outReflection.MaterialLayout;
+        uint32_t parameterCount = 0;
+        if (!in.Read(layout.UniformBufferSize) ||
+            !in.Read(layout.UniformBinding) ||
+            !in.Read(parameterCount))
+            return false;
+
+        layout.Parameters.clear();
+        for (uint32_t i = 0; i < parameterCount; ++i)
+        {
+            MaterialParameter parameter{};
+            uint32_t type = 0;
+            if (!in.ReadString(parameter.Name) ||
+                !in.Read(type) ||
+                !in.Read(parameter.Offset) ||
+                !in.Read(parameter.Size))
+                return false;
+
+            parameter.Type = static_cast<MaterialParameterType>(type);
+            layout.Parameters.push_back(std::move(parameter));
+        }
+
+        uint32_t textureCount = 0;
+        if (!in.Read(textureCount))
+            return false;
+
+        layout.Textures.clear();
+        for (uint32_t i = 0; i < textureCount; ++i)
+        {
+            MaterialTextureSlot texture{};
+            uint8_t isArray = 0;
+            if (!in.ReadString(texture.Name) ||
+                !in.Read(texture.Slot) ||
+                !in.Read(texture.Count) ||
+                !in.Read(isArray))
+                return false;
+
+            texture.IsArray = isArray != 0;
+            layout.Textures.push_back(std::move(texture));
+        }
+
+        return true;
+    }
+}
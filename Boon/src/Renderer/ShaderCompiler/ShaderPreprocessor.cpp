@@ -1,19 +1,30 @@
 #include "Renderer/ShaderCompiler/ShaderPreprocessor.h"
+#include "Renderer/ShaderCompiler/ShaderCache.h"
 
 #include <fstream>
-#include <sstream>
+#include <iterator>
 
 namespace Boon
 {
-    static std::string TrimLeft(std::string value)
+    static std::string_view TrimLeft(std::string_view value)
     {
         const size_t first = value.find_first_not_of(" \t\r\n");
-        if (first == std::string::npos)
+        if (first == std::string_view::npos)
             return {};
 
         return value.substr(first);
     }
 
+    static bool ReadFile(const std::filesystem::path& path, std::string& out)
+    {
+        std::ifstream file(path, std::ios::in | std::ios::binary);
+        if (!file)
+            return false;
+
+        out.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        return true;
+    }
+
     std::string ShaderPreprocessor::ResolveIncludes(
         const std::string& source,
         const std::filesystem::path& sourcePath)
@@ -27,16 +38,60 @@ namespace Boon
         const std::filesystem::path& currentDirectory,
         std::unordered_set<std::filesystem::path>& includeStack)
     {
-        std::istringstream input(source);
-        std::ostringstream output;
+        std::string output;
+        output.reserve(source.size());
+        ResolveIncludesInto(source, currentDirectory, includeStack, output, nullptr);
+        return output;
+    }
+
+    std::string ShaderPreprocessor::ResolveIncludes(
+        const std::string& source,
+        const std::filesystem::path& currentDirectory,
+        std::vector<std::filesystem::path>& outDependencies)
+    {
+        std::unordered_set<std::filesystem::path> includeStack;
+        std::string output;
+        output.reserve(source.size());
+        ResolveIncludesInto(source, currentDirectory, includeStack, output, &outDependencies);
+        return output;
+    }
 
-        std::string line;
-        while (std::getline(input, line))
+    std::string ShaderPreprocessor::ResolveIncludesCached(
+        const std::string& source,
+        const std::filesystem::path& currentDirectory)
+    {
+        if (auto cached = ShaderCache::LoadPreprocessed(currentDirectory, source))
+            return std::move(*cached);
+
+        std::vector<std::filesystem::path> dependencies;
+        std::string resolved = ResolveIncludes(source, currentDirectory, dependencies);
+
+        ShaderCache::StorePreprocessed(currentDirectory, source, resolved, dependencies);
+        return resolved;
+    }
+
+    void ShaderPreprocessor::ResolveIncludesInto(
+        std::string_view source,
+        const std::filesystem::path& currentDirectory,
+        std::unordered_set<std::filesystem::path>& includeStack,
+        std::string& output,
+        std::vector<std::filesystem::path>* dependencies)
+    {
+        size_t lineStart = 0;
+        while (lineStart < source.size())
         {
-            std::string includePathString;
+            size_t lineEnd = source.find('\n', lineStart);
+            if (lineEnd == std::string_view::npos)
+                lineEnd = source.size();
+
+            const std::string_view line = source.substr(lineStart, lineEnd - lineStart);
+            lineStart = lineEnd + 1;
+
+            std::string_view includePathString;
             if (!TryParseInclude(line, includePathString))
             {
-                output << line << '\n';
+                output.append(line);
+                output.push_back('\n');
                 continue;
             }
 
@@ -45,42 +100,40 @@ namespace Boon
 
             if (includeStack.contains(normalizedPath))
             {
-                output << "// Skipped recursive shader include: " << includePathString << '\n';
+                output.append("// Skipped recursive shader include: ").append(includePathString).push_back('\n');
                 continue;
             }
 
-            std::ifstream includeFile(includePath, std::ios::in);
-            if (!includeFile)
+            std::string includeSource;
+            if (!ReadFile(includePath, includeSource))
             {
-                output << "// Failed to include shader file: " << includePathString << '\n';
+                output.append("// Failed to include shader file: ").append(includePathString).push_back('\n');
                 continue;
             }
 
-            std::stringstream includeBuffer;
-            includeBuffer << includeFile.rdbuf();
+            if (dependencies)
+                dependencies->push_back(normalizedPath);
 
             includeStack.insert(normalizedPath);
-            output << "// Begin include: " << includePathString << '\n';
-            output << ResolveIncludes(includeBuffer.str(), includePath.parent_path(), includeStack);
-            output << "// End include: " << includePathString << '\n';
+            output.append("// Begin include: ").append(includePathString).push_back('\n');
+            ResolveIncludesInto(includeSource, includePath.parent_path(), includeStack, output, dependencies);
+            output.append("// End include: ").append(includePathString).push_back('\n');
             includeStack.erase(normalizedPath);
         }
-
-        return output.str();
     }
 
-    bool ShaderPreprocessor::TryParseInclude(const std::string& line, std::string& includePath)
+    bool ShaderPreprocessor::TryParseInclude(std::string_view line, std::string_view& includePath)
     {
-        const std::string trimmed = TrimLeft(line);
-        constexpr const char* includeToken = "#include";
+        const std::string_view trimmed = TrimLeft(line);
+        constexpr std::string_view includeToken = "#include";
 
-        if (trimmed.rfind(includeToken, 0) != 0)
+        if (!trimmed.starts_with(includeToken))
             return false;
 
         const size_t firstQuote = trimmed.find('"');
         const size_t lastQuote = trimmed.find_last_of('"');
 
-        if (firstQuote == std::string::npos || lastQuote == std::string::npos || firstQuote == lastQuote)
+        if (firstQuote == std::string_view::npos || lastQuote == std::string_view::npos || firstQuote == lastQuote)
             return false;
 
         includePath = trimmed.substr(firstQuote + 1, lastQuote - firstQuote - 1);
@@ -2,61 +2,90 @@
 #include "Renderer/Renderer.h"
 #include "Renderer/VertexData.h"
 #include "Core/Random.h"
+#include "Core/Threading/JobSystem.h"
+#include "BoonDebug/Logger.h"
 #include <glm/glm.hpp>
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <mutex>
+
 namespace Boon
 {
-    Tilemap::Tilemap(int chunksX, int chunksY, int chunkSize)
+    namespace
     {
-        m_ChunkSize = chunkSize;
-        m_ChunksX = chunksX;
-        m_ChunksY = chunksY;
+        // Largest tile index texture the lookup mode will allocate, in texels per side
+        constexpr int MaxLookupTextureSize = 8192;
 
-        m_MapWidth = chunksX * chunkSize;
-        m_MapHeight = chunksY * chunkSize;
+        const VertexBufferLayout& GetTileVertexLayout()
+        {
+            static const VertexBufferLayout layout = {
+                { ShaderDataType::Float3, "a_Position"     },
+                { ShaderDataType::Float4, "a_Color"        },
+                { ShaderDataType::Float2, "a_TexCoord"     }
+            };
+            return layout;
+        }
 
-        m_Chunks.reserve(m_ChunksX * m_ChunksY);
+        const VertexBufferLayout& GetTileLookupVertexLayout()
+        {
+            static const VertexBufferLayout layout = {
+                { ShaderDataType::Float3, "a_Position"     },
+                { ShaderDataType::Float2, "a_TileCoord"    },
+                { ShaderDataType::Float3, "a_Slot"         }
+            };
+            return layout;
+        }
 
-        VertexBufferLayout quadBufferLayout = {
-        { ShaderDataType::Float3, "a_Position"	   },
-        { ShaderDataType::Float4, "a_Color"		   },
-        { ShaderDataType::Float2, "a_TexCoord"     }
-        };
+        // Chunk of a tile coordinate, rounding towards negative infinity
+        int FloorDiv(int value, int divisor)
+        {
+            const int q = value / divisor;
+            return (value % divisor != 0 && (value < 0) != (divisor < 0)) ? q - 1 : q;
+        }
 
-        for (int cy = 0; cy < m_ChunksY; cy++)
+        int CountTiles(const std::vector<int>& tiles)
         {
-            for (int cx = 0; cx < m_ChunksX; cx++)
-            {
-                TilemapChunk chunk{};
-                chunk.ChunkX = cx;
-                chunk.ChunkY = cy;
-                chunk.Dirty = true;
+            return static_cast<int>(std::count_if(tiles.begin(), tiles.end(), [](int tile) { return tile >= 0; }));
+        }
+    }
 
-                // Allocate tile data
-                chunk.Tiles.resize(m_ChunkSize * m_ChunkSize, -1);
+    struct Tilemap::StreamState
+    {
+        using Clock = std::chrono::steady_clock;
 
-                // Allocate GPU buffers
-                chunk.VertexInput = VertexInput::Create();
-                chunk.VertexBuffer = VertexBuffer::Create(sizeof(TileVertex) * m_ChunkSize * m_ChunkSize * 4);
-                chunk.VertexBuffer->SetLayout(quadBufferLayout);
+        struct LoadedChunk
+        {
+            int ChunkX = 0;
+            int ChunkY = 0;
+            bool Found = false;
+            std::vector<int> Tiles;
+        };
 
-                auto indexBuffer = IndexBuffer::Create(nullptr, m_ChunkSize * m_ChunkSize * 6);
+        std::shared_ptr<TilemapChunkStore> Store;
 
-                chunk.VertexInput->SetIndexBuffer(indexBuffer);
-                chunk.VertexInput->AddVertexBuffer(chunk.VertexBuffer);
+        std::mutex Mutex;
+        std::vector<LoadedChunk> Completed;     // Filled by load jobs
 
-                m_Chunks.push_back(std::move(chunk));
-            }
-        }
-    }
+        std::unordered_map<uint64_t, Clock::time_point> Pending;
+        TilemapStreamingStats Stats;
+        double TotalLoadMs = 0.0;
+    };
 
+    Tilemap::Tilemap(int chunksX, int chunksY, int chunkSize)
+    {
+        m_ChunkSize = chunkSize;
+        m_ChunksX = chunksX;
+        m_ChunksY = chunksY;
 
+        m_MapWidth = chunksX * chunkSize;
+        m_MapHeight = chunksY * chunkSize;
+    }
 
     void Tilemap::Resize(int newChunksX, int newChunksY, int newChunkSize)
     {
-        int oldChunksX = m_ChunksX;
-        int oldChunksY = m_ChunksY;
-        int oldChunkSize = m_ChunkSize;
+        const int oldChunkSize = m_ChunkSize;
 
         m_ChunksX = newChunksX;
         m_ChunksY = newChunksY;
@@ -65,97 +94,131 @@ namespace Boon
         m_MapWidth = m_ChunksX * m_ChunkSize;
         m_MapHeight = m_ChunksY * m_ChunkSize;
 
-        std::vector<TilemapChunk> newChunks;
-        newChunks.resize(m_ChunksX * m_ChunksY);
+        m_IsDirty = true;
 
-        // Initialize metadata for new chunks
-        for (int cy = 0; cy < m_ChunksY; cy++)
+        if (newChunkSize == oldChunkSize)
         {
-            for (int cx = 0; cx < m_ChunksX; cx++)
+            // Chunks inside the new bounds keep their tiles and GPU buffers
+            if (!IsBounded())
+                return;
+
+            for (auto it = m_Chunks.begin(); it != m_Chunks.end();)
             {
-                TilemapChunk& chunk = newChunks[cy * m_ChunksX + cx];
-                chunk.ChunkX = cx;
-                chunk.ChunkY = cy;
-                chunk.Tiles.resize(m_ChunkSize * m_ChunkSize, -1);
-                chunk.Dirty = true;
-
-                // Setup GPU buffers
-                chunk.VertexInput = VertexInput::Create();
-                chunk.VertexBuffer = VertexBuffer::Create(
-                    sizeof(TileVertex) * m_ChunkSize * m_ChunkSize * 4
-                );
-
-                auto indexBuffer = IndexBuffer::Create(
-                    nullptr,
-                    m_ChunkSize * m_ChunkSize * 6
-                );
-
-                chunk.VertexInput->SetIndexBuffer(indexBuffer);
-                chunk.VertexInput->AddVertexBuffer(chunk.VertexBuffer);
+                TilemapChunk& chunk = it->second;
+                if (chunk.ChunkX >= m_ChunksX || chunk.ChunkY >= m_ChunksY || chunk.ChunkX < 0 || chunk.ChunkY < 0)
+                {
+                    ReleaseChunk(chunk);
+                    it = m_Chunks.erase(it);
+                }
+                else
+                {
+                    ++it;
+                }
             }
+            return;
         }
 
-        // Copy tile data from old layout to new
-        for (int cy = 0; cy < std::min(oldChunksY, newChunksY); cy++)
+        // Buffers are sized for the old chunk size, none of them can be reused
+        ChunkMap oldChunks = std::move(m_Chunks);
+        m_Chunks.clear();
+        ++m_Revision;
+        m_MeshPool.clear();
+        m_Mesh.QuadIndices = nullptr;
+        ResetLookup();
+
+        if (m_Stream && m_Stream->Store->GetChunkSize() != m_ChunkSize)
         {
-            for (int cx = 0; cx < std::min(oldChunksX, newChunksX); cx++)
-            {
-                const TilemapChunk& oldChunk = m_Chunks[cy * oldChunksX + cx];
-                TilemapChunk& newChunk = newChunks[cy * m_ChunksX + cx];
+            BOON_LOG_WARN("Tilemap chunk size changed to {}, streaming stopped", m_ChunkSize);
+            m_Stream = nullptr;
+        }
 
-                int copyWidth = std::min(oldChunkSize, newChunkSize);
-                int copyHeight = std::min(oldChunkSize, newChunkSize);
+        for (const auto& [key, chunk] : oldChunks)
+        {
+            if (chunk.TileCount == 0)
+                continue;
 
-                for (int y = 0; y < copyHeight; y++)
-                {
-                    for (int x = 0; x < copyWidth; x++)
-                    {
-                        newChunk.Tiles[y * newChunkSize + x] =
-                            oldChunk.Tiles[y * oldChunkSize + x];
-                    }
-                }
+            for (int i = 0; i < static_cast<int>(chunk.Tiles.size()); ++i)
+            {
+                const int tileId = chunk.Tiles[i];
+                if (tileId < 0)
+                    continue;
+
+                SetTile(chunk.ChunkX * oldChunkSize + i % oldChunkSize, chunk.ChunkY * oldChunkSize + i / oldChunkSize, tileId);
             }
         }
+    }
 
-        // Replace chunk list
-        m_Chunks = std::move(newChunks);
+    TilemapChunk* Tilemap::FindChunk(int chunkX, int chunkY)
+    {
+        auto it = m_Chunks.find(MakeTilemapChunkKey(chunkX, chunkY));
+        return it != m_Chunks.end() ? &it->second : nullptr;
     }
 
+    const TilemapChunk* Tilemap::FindChunk(int chunkX, int chunkY) const
+    {
+        auto it = m_Chunks.find(MakeTilemapChunkKey(chunkX, chunkY));
+        return it != m_Chunks.end() ? &it->second : nullptr;
+    }
 
-    void Tilemap::SetTile(int x, int y, int tileId)
+    TilemapChunk& Tilemap::GetOrCreateChunk(int chunkX, int chunkY)
     {
-        int cx = x / m_ChunkSize;
-        int cy = y / m_ChunkSize;
-        int lx = x % m_ChunkSize;
-        int ly = y % m_ChunkSize;
+        auto [it, inserted] = m_Chunks.try_emplace(MakeTilemapChunkKey(chunkX, chunkY));
+        if (inserted)
+        {
+            it->second.ChunkX = chunkX;
+            it->second.ChunkY = chunkY;
+            it->second.Revision = ++m_Revision;
+        }
+        return it->second;
+    }
 
-        int idx = cy * m_ChunksX + cx;
-        if (idx >= m_Chunks.size())
+    void Tilemap::ReleaseChunk(TilemapChunk& chunk)
+    {
+        ++m_Revision;
+        ReleaseChunkBuffers(chunk);
+
+        if (chunk.LookupSlot >= 0)
+            m_Lookup.FreeSlots.push_back(chunk.LookupSlot);
+
+        chunk.LookupSlot = -1;
+        chunk.LookupQuad = nullptr;
+    }
+
+    void Tilemap::SetTile(int x, int y, int tileId)
+    {
+        if (!IsValidTile(x, y))
             return;
 
-        TilemapChunk& chunk = m_Chunks[idx];
+        const int cx = FloorDiv(x, m_ChunkSize);
+        const int cy = FloorDiv(y, m_ChunkSize);
+        const int lx = x - cx * m_ChunkSize;
+        const int ly = y - cy * m_ChunkSize;
 
-        chunk.Tiles[ly * m_ChunkSize + lx] = tileId;
-        chunk.Dirty = true;
-        m_IsDirty = true;
+        SetTileInChunk(cx, cy, ly * m_ChunkSize + lx, tileId);
     }
 
     int Tilemap::GetTile(int x, int y) const
     {
-        if (x < 0 || y < 0 || x >= m_MapWidth || y >= m_MapHeight)
+        if (!IsValidTile(x, y))
             return -1;
 
-        int cx = x / m_ChunkSize;
-        int cy = y / m_ChunkSize;
-        int lx = x % m_ChunkSize;
-        int ly = y % m_ChunkSize;
+        const int cx = FloorDiv(x, m_ChunkSize);
+        const int cy = FloorDiv(y, m_ChunkSize);
+
+        const TilemapChunk* chunk = FindChunk(cx, cy);
+        if (!chunk || chunk->Tiles.empty())
+            return -1;
 
-        int idx = cy * m_ChunksX + cx;
-        return m_Chunks[idx].Tiles[ly * m_ChunkSize + lx];
+        const int lx = x - cx * m_ChunkSize;
+        const int ly = y - cy * m_ChunkSize;
+        return chunk->Tiles[ly * m_ChunkSize + lx];
     }
 
     bool Tilemap::IsValidTile(int x, int y) const
     {
+        if (!IsBounded())
+            return true;
+
         if (x < 0 || y < 0 || x >= m_MapWidth || y >= m_MapHeight)
             return false;
 
@@ -164,127 +227,773 @@ namespace Boon
 
     void Tilemap::SetTile(int chunkX, int chunkY, int x, int y, int tileId)
     {
-        int idx = chunkY * m_ChunksX + chunkX;
-        TilemapChunk& chunk = m_Chunks[idx];
+        if (x < 0 || y < 0 || x >= m_ChunkSize || y >= m_ChunkSize)
+            return;
 
-        chunk.Tiles[y * m_ChunkSize + x] = tileId;
-        chunk.Dirty = true;
-        m_IsDirty = true;
+        if (IsBounded() && (chunkX < 0 || chunkY < 0 || chunkX >= m_ChunksX || chunkY >= m_ChunksY))
+            return;
+
+        SetTileInChunk(chunkX, chunkY, y * m_ChunkSize + x, tileId);
     }
 
     int Tilemap::GetTile(int chunkX, int chunkY, int x, int y) const
     {
-        if (chunkX < 0 || chunkY < 0 || chunkX >= m_ChunksX || chunkY >= m_ChunksY)
+        if (x < 0 || y < 0 || x >= m_ChunkSize || y >= m_ChunkSize)
             return -1;
 
-        if (x < 0 || y < 0 || x >= m_ChunkSize || y >= m_ChunkSize)
+        const TilemapChunk* chunk = FindChunk(chunkX, chunkY);
+        if (!chunk || chunk->Tiles.empty())
             return -1;
 
-        int idx = chunkY * m_ChunksX + chunkX;
-        int idy = y * m_ChunkSize + x;
-        return m_Chunks[idx].Tiles[idy];
+        return chunk->Tiles[y * m_ChunkSize + x];
+    }
+
+    void Tilemap::SetChunkTiles(int chunkX, int chunkY, std::vector<int> tiles)
+    {
+        if (tiles.size() != static_cast<size_t>(m_ChunkSize) * m_ChunkSize)
+            return;
+
+        if (IsBounded() && (chunkX < 0 || chunkY < 0 || chunkX >= m_ChunksX || chunkY >= m_ChunksY))
+            return;
+
+        TilemapChunk& chunk = GetOrCreateChunk(chunkX, chunkY);
+        chunk.Tiles = std::move(tiles);
+        chunk.TileCount = CountTiles(chunk.Tiles);
+        chunk.LookupDirty = true;
+        chunk.Modified = true;
+        chunk.Revision = ++m_Revision;
+
+        MarkMeshDirty(chunk, 0, static_cast<uint32_t>(chunk.Tiles.size()));
     }
 
-    void Tilemap::RebuildDirtyChunks()
+    void Tilemap::SetTileInChunk(int chunkX, int chunkY, int local, int tileId)
+    {
+        TilemapChunk* chunk = FindChunk(chunkX, chunkY);
+        if (!chunk)
+        {
+            // Clearing a tile never creates a chunk
+            if (tileId < 0)
+                return;
+
+            chunk = &GetOrCreateChunk(chunkX, chunkY);
+        }
+
+        if (chunk->Tiles.empty())
+        {
+            if (tileId < 0)
+                return;
+
+            chunk->Tiles.assign(static_cast<size_t>(m_ChunkSize) * m_ChunkSize, -1);
+        }
+
+        int& tile = chunk->Tiles[local];
+        const int oldTileId = tile;
+        tile = tileId;
+
+        OnTileChanged(*chunk, MakeTilemapChunkKey(chunkX, chunkY), local, oldTileId, tileId);
+    }
+
+    void Tilemap::OnTileChanged(TilemapChunk& chunk, uint64_t key, int local, int oldTileId, int newTileId)
+    {
+        if (oldTileId == newTileId)
+            return;
+
+        chunk.TileCount += (newTileId >= 0) - (oldTileId >= 0);
+        chunk.Modified = true;
+        chunk.Revision = ++m_Revision;
+
+        MarkMeshDirty(chunk, static_cast<uint32_t>(local), static_cast<uint32_t>(local) + 1);
+
+        if (chunk.LookupDirty)
+            return;
+
+        // Past the cap a full chunk upload is cheaper than many single texels
+        if (m_Lookup.DirtyTiles.size() < MaxDirtyTiles)
+            m_Lookup.DirtyTiles.push_back({ key, static_cast<uint32_t>(local) });
+        else
+            chunk.LookupDirty = true;
+    }
+
+    void Tilemap::MarkMeshDirty(TilemapChunk& chunk, uint32_t begin, uint32_t end)
+    {
+        if (!chunk.Dirty || chunk.MeshDirtyBegin >= chunk.MeshDirtyEnd)
+        {
+            chunk.MeshDirtyBegin = begin;
+            chunk.MeshDirtyEnd = end;
+        }
+        else
+        {
+            chunk.MeshDirtyBegin = std::min(chunk.MeshDirtyBegin, begin);
+            chunk.MeshDirtyEnd = std::max(chunk.MeshDirtyEnd, end);
+        }
+
+        chunk.Dirty = true;
+        m_IsDirty = true;
+    }
+
+    void Tilemap::SyncMeshState(const SpriteAtlas& atlas)
+    {
+        if (m_Mesh.Atlas == &atlas && m_Mesh.AtlasVersion == atlas.GetVersion() && m_Mesh.UnitSize == m_UnitSize)
+            return;
+
+        // Frames or tile size changed, every vertex is stale
+        const uint32_t tilesPerChunk = static_cast<uint32_t>(m_ChunkSize * m_ChunkSize);
+        for (auto& [key, chunk] : m_Chunks)
+        {
+            if (chunk.VertexInput)
+                MarkMeshDirty(chunk, 0, tilesPerChunk);
+        }
+
+        m_Mesh.Atlas = &atlas;
+        m_Mesh.AtlasVersion = atlas.GetVersion();
+        m_Mesh.UnitSize = m_UnitSize;
+    }
+
+    void Tilemap::RebuildDirtyChunks(uint32_t maxChunks)
     {
         if (!m_Atlas.IsValid())
             return;
 
+        const std::shared_ptr<SpriteAtlas> atlas = m_Atlas->GetInstance();
+        if (!atlas)
+            return;
+
+        SyncMeshState(*atlas);
+
         if (!m_IsDirty)
             return;
 
-        for (TilemapChunk& chunk : m_Chunks)
+        const uint32_t tilesPerChunk = static_cast<uint32_t>(m_ChunkSize * m_ChunkSize);
+        if (!m_Mesh.QuadIndices)
+            m_Mesh.QuadIndices = IndexBuffer::CreateQuadPattern(tilesPerChunk);
+
+        bool bDeferred = false;
+        m_Mesh.Queue.clear();
+
+        for (auto& [key, chunk] : m_Chunks)
         {
-            if (chunk.Dirty)
-                BuildChunk(chunk);
+            if (!chunk.Dirty)
+                continue;
+
+            // Nothing to draw, hand the buffers to the next chunk that needs some
+            if (chunk.TileCount == 0)
+            {
+                ReleaseChunkBuffers(chunk);
+                chunk.Dirty = false;
+                continue;
+            }
+
+            if (maxChunks > 0 && m_Mesh.Queue.size() >= maxChunks)
+            {
+                bDeferred = true;
+                continue;
+            }
+
+            // Fresh or pooled buffers hold nothing of this chunk
+            if (!chunk.VertexInput)
+            {
+                AllocateChunkBuffers(chunk);
+                chunk.MeshDirtyBegin = 0;
+                chunk.MeshDirtyEnd = tilesPerChunk;
+            }
+
+            m_Mesh.Queue.push_back(&chunk);
+        }
+
+        if (m_Mesh.Scratch.size() < m_Mesh.Queue.size())
+            m_Mesh.Scratch.resize(m_Mesh.Queue.size());
+
+        auto meshRange = [this, &atlas](size_t begin, size_t end)
+            {
+                for (size_t i = begin; i < end; ++i)
+                    MeshTiles(*m_Mesh.Queue[i], *atlas, m_Mesh.Scratch[i]);
+            };
+
+        if (JobSystem* jobs = JobSystem::Get())
+            jobs->ParallelFor(m_Mesh.Queue.size(), 1, meshRange);
+        else
+            meshRange(0, m_Mesh.Queue.size());
+
+        // Uploads stay on the render thread
+        for (size_t i = 0; i < m_Mesh.Queue.size(); ++i)
+        {
+            TilemapChunk& chunk = *m_Mesh.Queue[i];
+            const std::vector<TileVertex>& vertices = m_Mesh.Scratch[i];
+
+            const uint32_t bytes = static_cast<uint32_t>(vertices.size() * sizeof(TileVertex));
+            const uint32_t offset = static_cast<uint32_t>(chunk.MeshDirtyBegin * 4 * sizeof(TileVertex));
+            chunk.VertexBuffer->SetSubData(vertices.data(), bytes, offset);
+            m_UploadedBytes += bytes;
+
+            chunk.Dirty = false;
+            chunk.MeshDirtyBegin = 0;
+            chunk.MeshDirtyEnd = 0;
         }
 
-        m_IsDirty = false;
+        m_Mesh.Queue.clear();
+        m_IsDirty = bDeferred;
     }
 
-    void Tilemap::BuildChunk(TilemapChunk& chunk)
+    void Tilemap::AllocateChunkBuffers(TilemapChunk& chunk)
     {
-        auto atlas = m_Atlas->GetInstance();
-        auto texture = atlas->GetTexture().Instance();
+        if (!m_MeshPool.empty())
+        {
+            chunk.VertexInput = std::move(m_MeshPool.back().Input);
+            chunk.VertexBuffer = std::move(m_MeshPool.back().Vertices);
+            m_MeshPool.pop_back();
+            return;
+        }
+
+        chunk.VertexInput = VertexInput::Create();
+        chunk.VertexBuffer = VertexBuffer::Create(sizeof(TileVertex) * m_ChunkSize * m_ChunkSize * 4);
+        chunk.VertexBuffer->SetLayout(GetTileVertexLayout());
+
+        chunk.VertexInput->SetIndexBuffer(m_Mesh.QuadIndices);
+        chunk.VertexInput->AddVertexBuffer(chunk.VertexBuffer);
+    }
+
+    void Tilemap::ReleaseChunkBuffers(TilemapChunk& chunk)
+    {
+        if (!chunk.VertexInput)
+            return;
 
-        std::vector<TileVertex> verts;
-        std::vector<uint32_t> indices;
+        if (m_MeshPool.size() < MaxPooledMeshBuffers)
+            m_MeshPool.push_back({ std::move(chunk.VertexInput), std::move(chunk.VertexBuffer) });
 
-        verts.reserve(m_ChunkSize * m_ChunkSize * 4);
-        indices.reserve(m_ChunkSize * m_ChunkSize * 6);
+        chunk.VertexInput = nullptr;
+        chunk.VertexBuffer = nullptr;
+    }
+
+    void Tilemap::BuildCollisionRects(const TilemapChunk& chunk, std::vector<TileRect>& outRects) const
+    {
+        outRects.clear();
+        if (chunk.TileCount == 0 || chunk.Tiles.empty())
+            return;
+
+        const int size = m_ChunkSize;
+        std::vector<uint8_t> covered(chunk.Tiles.size(), 0);
 
-        uint32_t indexOffset = 0;
+        auto isFree = [&](int x, int y)
+            {
+                const int i = y * size + x;
+                return chunk.Tiles[i] >= 0 && !covered[i];
+            };
 
-        for (int ty = 0; ty < m_ChunkSize; ty++)
+        for (int y = 0; y < size; ++y)
         {
-            for (int tx = 0; tx < m_ChunkSize; tx++)
+            for (int x = 0; x < size; ++x)
             {
-                int tileId = chunk.Tiles[ty * m_ChunkSize + tx];
-                if (tileId < 0)
+                if (!isFree(x, y))
                     continue;
 
-                if (!atlas->Exists(tileId))
-                    return;
-
-                const SpriteFrame& f = atlas->GetSpriteFrame(tileId);
-
-                float width = m_UnitSize;
-                float height = m_UnitSize;
-
-                // World-space tile offset inside the chunk (top-left anchored)
-                float worldX = (chunk.ChunkX * m_ChunkSize * width) + tx * width;
-                float worldY = (chunk.ChunkY * m_ChunkSize * height) + ty * height;
-
-                // Convert to centered quad to match Renderer2D
-                float cx = worldX + width * 0.5f;
-                float cy = worldY + height * 0.5f;
-
-                float depth = -0.01f;
-                glm::vec3 p0 = { cx - width * 0.5f, cy - height * 0.5f, depth };
-                glm::vec3 p1 = { cx + width * 0.5f, cy - height * 0.5f, depth };
-                glm::vec3 p2 = { cx + width * 0.5f, cy + height * 0.5f, depth };
-                glm::vec3 p3 = { cx - width * 0.5f, cy + height * 0.5f, depth };
-
-                // Half-texel padding
-                float epsilon = 0.0005f;
-                float texelX = epsilon;
-                float texelY = epsilon;
-                //float texelX = 1.f / texture->GetWidth();
-                //float texelY = 1.f / texture->GetHeight();
-                
-                glm::vec2 uv0 = f.UV + glm::vec2(texelX, texelY);
-                glm::vec2 uv1 = f.UV + glm::vec2(f.Size.x - texelX, texelY);
-                glm::vec2 uv2 = f.UV + glm::vec2(f.Size.x - texelX, f.Size.y - texelY);
-                glm::vec2 uv3 = f.UV + glm::vec2(texelX, f.Size.y - texelY);
-
-                //glm::vec2 uv0 = f.UV;
-                //glm::vec2 uv1 = { f.UV.x + f.Size.x, f.UV.y };
-                //glm::vec2 uv2 = { f.UV.x + f.Size.x, f.UV.y + f.Size.y };
-                //glm::vec2 uv3 = { f.UV.x,            f.UV.y + f.Size.y };
-
-                glm::vec4 color = { 1,1,1,1 };
-
-                verts.push_back(TileVertex{ p0, color, uv0 });
-                verts.push_back(TileVertex{ p1, color, uv1 });
-                verts.push_back(TileVertex{ p2, color, uv2 });
-                verts.push_back(TileVertex{ p3, color, uv3 });
-
-                indices.push_back(indexOffset + 0);
-                indices.push_back(indexOffset + 1);
-                indices.push_back(indexOffset + 2);
-                indices.push_back(indexOffset + 2);
-                indices.push_back(indexOffset + 3);
-                indices.push_back(indexOffset + 0);
-
-                indexOffset += 4;
+                int width = 1;
+                while (x + width < size && isFree(x + width, y))
+                    ++width;
+
+                int height = 1;
+                for (; y + height < size; ++height)
+                {
+                    bool rowSolid = true;
+                    for (int i = 0; i < width && rowSolid; ++i)
+                        rowSolid = isFree(x + i, y + height);
+
+                    if (!rowSolid)
+                        break;
+                }
+
+                for (int ry = y; ry < y + height; ++ry)
+                    std::fill_n(covered.begin() + (ry * size + x), width, uint8_t{ 1 });
+
+                outRects.push_back({ x, y, width, height });
+                x += width - 1;
             }
         }
+    }
+
+    void Tilemap::MeshTiles(const TilemapChunk& chunk, const SpriteAtlas& atlas, std::vector<TileVertex>& out) const
+    {
+        const uint32_t begin = chunk.MeshDirtyBegin;
+        const uint32_t end = chunk.MeshDirtyEnd;
+
+        out.resize(static_cast<size_t>(end - begin) * 4);
 
-        chunk.VertexBuffer->SetData(verts.data(), static_cast<uint32_t>(verts.size() * sizeof(TileVertex)));
+        const float width = m_UnitSize;
+        const float height = m_UnitSize;
+        const float depth = -0.01f;
 
-        auto indexBuffer = IndexBuffer::Create(indices.data(), static_cast<uint32_t>(indices.size()));
-        chunk.VertexInput->SetIndexBuffer(indexBuffer);
+        // Half-texel padding
+        const float epsilon = 0.0005f;
+        const float texelX = epsilon;
+        const float texelY = epsilon;
+
+        const glm::vec4 color = { 1,1,1,1 };
+
+        for (uint32_t i = begin; i < end; ++i)
+        {
+            TileVertex* quad = &out[static_cast<size_t>(i - begin) * 4];
+
+            // Empty tiles and missing frames collapse to a zero-area quad
+            const int tileId = chunk.Tiles[i];
+            if (tileId < 0 || !atlas.Exists(tileId))
+            {
+                quad[0] = quad[1] = quad[2] = quad[3] = TileVertex{};
+                continue;
+            }
+
+            const SpriteFrame& f = atlas.GetSpriteFrame(tileId);
+
+            const int tx = static_cast<int>(i) % m_ChunkSize;
+            const int ty = static_cast<int>(i) / m_ChunkSize;
+
+            // World-space tile offset inside the chunk (top-left anchored)
+            const float worldX = (chunk.ChunkX * m_ChunkSize * width) + tx * width;
+            const float worldY = (chunk.ChunkY * m_ChunkSize * height) + ty * height;
+
+            const glm::vec3 p0 = { worldX,         worldY,          depth };
+            const glm::vec3 p1 = { worldX + width, worldY,          depth };
+            const glm::vec3 p2 = { worldX + width, worldY + height, depth };
+            const glm::vec3 p3 = { worldX,         worldY + height, depth };
+
+            const glm::vec2 uv0 = f.UV + glm::vec2(texelX, texelY);
+            const glm::vec2 uv1 = f.UV + glm::vec2(f.Size.x - texelX, texelY);
+            const glm::vec2 uv2 = f.UV + glm::vec2(f.Size.x - texelX, f.Size.y - texelY);
+            const glm::vec2 uv3 = f.UV + glm::vec2(texelX, f.Size.y - texelY);
+
+            quad[0] = TileVertex{ p0, color, uv0 };
+            quad[1] = TileVertex{ p1, color, uv1 };
+            quad[2] = TileVertex{ p2, color, uv2 };
+            quad[3] = TileVertex{ p3, color, uv3 };
+        }
+    }
+
+    void Tilemap::ResetLookup()
+    {
+        m_Lookup.TileIndices = nullptr;
+        m_Lookup.SlotsPerRow = 0;
+        m_Lookup.NextSlot = 0;
+        m_Lookup.FreeSlots.clear();
+        m_Lookup.DirtyTiles.clear();
+
+        for (auto& [key, chunk] : m_Chunks)
+        {
+            chunk.LookupSlot = -1;
+            chunk.LookupDirty = true;
+            chunk.LookupQuad = nullptr;
+        }
+    }
+
+    bool Tilemap::EnsureLookupCapacity(int requiredSlots)
+    {
+        int slotsPerRow = std::max(m_Lookup.SlotsPerRow, 1);
+        while (slotsPerRow * slotsPerRow < requiredSlots)
+            slotsPerRow *= 2;
+
+        if (slotsPerRow == m_Lookup.SlotsPerRow && m_Lookup.TileIndices)
+            return true;
+
+        const int textureSize = slotsPerRow * m_ChunkSize;
+        if (textureSize > MaxLookupTextureSize)
+            return false;
+
+        TextureDescriptor desc{};
+        desc.Width = static_cast<uint32_t>(textureSize);
+        desc.Height = static_cast<uint32_t>(textureSize);
+        desc.Format = ImageFormat::R32I;
+        desc.MinFilter = ImageFilter::Nearest;
+        desc.MagFilter = ImageFilter::Nearest;
+
+        m_Lookup.TileIndices = Texture2D::Create(desc);
+
+        // Slot origins move with the row width, every resident chunk re-uploads
+        if (slotsPerRow != m_Lookup.SlotsPerRow)
+        {
+            for (auto& [key, chunk] : m_Chunks)
+            {
+                chunk.LookupDirty = true;
+                chunk.LookupQuad = nullptr;
+            }
+            m_Lookup.DirtyTiles.clear();
+        }
+
+        m_Lookup.SlotsPerRow = slotsPerRow;
+        return true;
+    }
+
+    void Tilemap::BuildLookupQuad(TilemapChunk& chunk)
+    {
+        if (!m_Lookup.QuadIndices)
+            m_Lookup.QuadIndices = IndexBuffer::CreateQuadPattern(1);
+
+        const float size = static_cast<float>(m_ChunkSize);
+        const float extent = m_ChunkSize * m_UnitSize;
+        const float x0 = chunk.ChunkX * extent;
+        const float y0 = chunk.ChunkY * extent;
+        const float depth = -0.01f;
+
+        const glm::vec3 slot = {
+            static_cast<float>((chunk.LookupSlot % m_Lookup.SlotsPerRow) * m_ChunkSize),
+            static_cast<float>((chunk.LookupSlot / m_Lookup.SlotsPerRow) * m_ChunkSize),
+            size
+        };
+
+        TileLookupVertex verts[4] =
+        {
+            { { x0,          y0,          depth }, { 0.0f, 0.0f }, slot },
+            { { x0 + extent, y0,          depth }, { size, 0.0f }, slot },
+            { { x0 + extent, y0 + extent, depth }, { size, size }, slot },
+            { { x0,          y0 + extent, depth }, { 0.0f, size }, slot }
+        };
+
+        auto vertexBuffer = VertexBuffer::Create(reinterpret_cast<float*>(verts), sizeof(verts));
+        vertexBuffer->SetLayout(GetTileLookupVertexLayout());
+
+        chunk.LookupQuad = VertexInput::Create();
+        chunk.LookupQuad->AddVertexBuffer(vertexBuffer);
+        chunk.LookupQuad->SetIndexBuffer(m_Lookup.QuadIndices);
+
+        m_UploadedBytes += sizeof(verts);
+    }
+
+    void Tilemap::UpdateFrameTable(const SpriteAtlas& atlas)
+    {
+        if (m_Lookup.FrameTable &&
+            m_Lookup.FrameTableAtlas == &atlas &&
+            m_Lookup.FrameTableVersion == atlas.GetVersion())
+            return;
+
+        const uint32_t capacity = static_cast<uint32_t>(std::max(atlas.GetFrameIdCapacity(), 1));
+        const uint32_t rows = (capacity + FrameTableWidth - 1) / FrameTableWidth;
+
+        // xy = atlas UV, zw = size; zero size marks a missing frame
+        std::vector<glm::vec4> table(static_cast<size_t>(FrameTableWidth) * rows, glm::vec4(0.0f));
+        for (const FrameEntry& entry : atlas.GetFrameEntries())
+        {
+            if (entry.stableId >= 0)
+                table[entry.stableId] = glm::vec4(entry.frame.UV, entry.frame.Size);
+        }
+
+        if (!m_Lookup.FrameTable || m_Lookup.FrameTable->GetHeight() != rows)
+        {
+            TextureDescriptor desc{};
+            desc.Width = FrameTableWidth;
+            desc.Height = rows;
+            desc.Format = ImageFormat::RGBA32F;
+            m_Lookup.FrameTable = Texture2D::Create(desc);
+        }
+
+        m_Lookup.FrameTable->SetSubData(table.data(), 0, 0, FrameTableWidth, rows);
+        m_UploadedBytes += table.size() * sizeof(glm::vec4);
+
+        m_Lookup.FrameTableAtlas = &atlas;
+        m_Lookup.FrameTableVersion = atlas.GetVersion();
+    }
+
+    void Tilemap::UpdateLookupTextures()
+    {
+        if (!m_Atlas.IsValid())
+            return;
+
+        // Still loading, or unloaded since the map was built
+        const std::shared_ptr<SpriteAtlas> atlas = m_Atlas->GetInstance();
+        if (!atlas)
+            return;
+
+        UpdateFrameTable(*atlas);
+
+        if (m_Lookup.QuadUnitSize != m_UnitSize)
+        {
+            for (auto& [key, chunk] : m_Chunks)
+                chunk.LookupQuad = nullptr;
+            m_Lookup.QuadUnitSize = m_UnitSize;
+        }
+
+        // Chunks that were emptied give their slot back before new ones are placed
+        for (auto& [key, chunk] : m_Chunks)
+        {
+            if (chunk.TileCount == 0 && chunk.LookupSlot >= 0)
+            {
+                m_Lookup.FreeSlots.push_back(chunk.LookupSlot);
+                chunk.LookupSlot = -1;
+                chunk.LookupQuad = nullptr;
+            }
+        }
+
+        int requiredSlots = m_Lookup.NextSlot;
+        for (const auto& [key, chunk] : m_Chunks)
+        {
+            if (chunk.TileCount > 0 && chunk.LookupSlot < 0)
+                ++requiredSlots;
+        }
+        requiredSlots -= static_cast<int>(m_Lookup.FreeSlots.size());
+
+        if (!EnsureLookupCapacity(requiredSlots))
+            return;
+
+        // Single texels first; chunks flagged for a full upload skip theirs
+        for (const LookupState::DirtyTile& dirty : m_Lookup.DirtyTiles)
+        {
+            auto it = m_Chunks.find(dirty.Chunk);
+            if (it == m_Chunks.end())
+                continue;
+
+            const TilemapChunk& chunk = it->second;
+            if (chunk.LookupDirty || chunk.LookupSlot < 0)
+                continue;
+
+            const uint32_t x = (chunk.LookupSlot % m_Lookup.SlotsPerRow) * m_ChunkSize + dirty.Local % m_ChunkSize;
+            const uint32_t y = (chunk.LookupSlot / m_Lookup.SlotsPerRow) * m_ChunkSize + dirty.Local / m_ChunkSize;
+            m_Lookup.TileIndices->SetSubData(&chunk.Tiles[dirty.Local], x, y, 1, 1);
+            m_UploadedBytes += sizeof(int);
+        }
+        m_Lookup.DirtyTiles.clear();
+
+        for (auto& [key, chunk] : m_Chunks)
+        {
+            if (chunk.LookupSlot < 0)
+            {
+                if (chunk.TileCount == 0)
+                    continue;
+
+                if (!m_Lookup.FreeSlots.empty())
+                {
+                    chunk.LookupSlot = m_Lookup.FreeSlots.back();
+                    m_Lookup.FreeSlots.pop_back();
+                }
+                else
+                {
+                    chunk.LookupSlot = m_Lookup.NextSlot++;
+                }
+                chunk.LookupDirty = true;
+                chunk.LookupQuad = nullptr;
+            }
+
+            if (chunk.LookupDirty)
+            {
+                const uint32_t x = (chunk.LookupSlot % m_Lookup.SlotsPerRow) * m_ChunkSize;
+                const uint32_t y = (chunk.LookupSlot / m_Lookup.SlotsPerRow) * m_ChunkSize;
+                m_Lookup.TileIndices->SetSubData(chunk.Tiles.data(), x, y, m_ChunkSize, m_ChunkSize);
+                m_UploadedBytes += chunk.Tiles.size() * sizeof(int);
+                chunk.LookupDirty = false;
+            }
+
+            if (!chunk.LookupQuad)
+                BuildLookupQuad(chunk);
+        }
+    }
+
+    TilemapStats Tilemap::GetStats() const
+    {
+        TilemapStats stats{};
+        stats.UploadedBytes = m_UploadedBytes;
+        stats.ResidentChunks = static_cast<uint32_t>(m_Chunks.size());
+
+        const size_t tilesPerChunk = static_cast<size_t>(m_ChunkSize) * m_ChunkSize;
+        const size_t meshBytesPerChunk = tilesPerChunk * 4 * sizeof(TileVertex);
+
+        for (const auto& [key, chunk] : m_Chunks)
+        {
+            stats.TileBytes += chunk.Tiles.capacity() * sizeof(int);
+
+            if (chunk.VertexInput)
+                stats.MeshBytes += meshBytesPerChunk;
+            if (chunk.LookupQuad)
+                stats.LookupBytes += 4 * sizeof(TileLookupVertex);
+        }
+
+        stats.PooledMeshBytes = m_MeshPool.size() * meshBytesPerChunk;
+
+        if (m_Mesh.QuadIndices)
+            stats.MeshBytes += static_cast<size_t>(m_Mesh.QuadIndices->GetCount()) * sizeof(uint32_t);
+
+        if (m_Lookup.TileIndices)
+            stats.LookupBytes += static_cast<size_t>(m_Lookup.TileIndices->GetWidth()) * m_Lookup.TileIndices->GetHeight() * sizeof(int);
+        if (m_Lookup.FrameTable)
+            stats.LookupBytes += static_cast<size_t>(m_Lookup.FrameTable->GetWidth()) * m_Lookup.FrameTable->GetHeight() * sizeof(glm::vec4);
+
+        return stats;
+    }
+
+    bool Tilemap::SetStreamSource(std::shared_ptr<TilemapChunkStore> store)
+    {
+        if (!store)
+        {
+            m_Stream = nullptr;
+            return true;
+        }
+
+        if (store->GetChunkSize() != m_ChunkSize)
+        {
+            BOON_LOG_ERROR("Tilemap chunk store uses chunk size {}, tilemap uses {}", store->GetChunkSize(), m_ChunkSize);
+            return false;
+        }
+
+        m_Stream = std::make_shared<StreamState>();
+        m_Stream->Store = std::move(store);
+        return true;
+    }
+
+    void Tilemap::UpdateStreaming(const glm::vec2& focusTile, int radius)
+    {
+        if (!m_Stream)
+            return;
+
+        radius = std::max(radius, 0);
+
+        const glm::ivec2 focus = {
+            FloorDiv(static_cast<int>(std::floor(focusTile.x)), m_ChunkSize),
+            FloorDiv(static_cast<int>(std::floor(focusTile.y)), m_ChunkSize)
+        };
+        const int keepRadius = radius + StreamEvictionMargin;
+
+        // The margin keeps a camera on a chunk border from loading and evicting the same row every frame
+        for (auto it = m_Chunks.begin(); it != m_Chunks.end();)
+        {
+            TilemapChunk& chunk = it->second;
+            const int distance = std::max(std::abs(chunk.ChunkX - focus.x), std::abs(chunk.ChunkY - focus.y));
+
+            if (chunk.Streamed && !chunk.Modified && distance > keepRadius)
+            {
+                ReleaseChunk(chunk);
+                it = m_Chunks.erase(it);
+                ++m_Stream->Stats.EvictedChunks;
+            }
+            else
+            {
+                ++it;
+            }
+        }
+
+        if (m_Stream->Pending.size() < MaxPendingLoads)
+        {
+            std::vector<glm::ivec2> missing;
+
+            for (int dy = -radius; dy <= radius; ++dy)
+            {
+                for (int dx = -radius; dx <= radius; ++dx)
+                {
+                    const glm::ivec2 coord = focus + glm::ivec2(dx, dy);
+
+                    if (IsBounded() && (coord.x < 0 || coord.y < 0 || coord.x >= m_ChunksX || coord.y >= m_ChunksY))
+                        continue;
+
+                    const uint64_t key = MakeTilemapChunkKey(coord.x, coord.y);
+                    if (m_Chunks.contains(key) || m_Stream->Pending.contains(key))
+                        continue;
+
+                    missing.push_back(coord);
+                }
+            }
+
+            // Nearest first, the budget cuts off the far ring
+            std::sort(missing.begin(), missing.end(), [focus](const glm::ivec2& a, const glm::ivec2& b)
+                {
+                    const glm::ivec2 da = a - focus;
+                    const glm::ivec2 db = b - focus;
+                    return da.x * da.x + da.y * da.y < db.x * db.x + db.y * db.y;
+                });
+
+            const size_t budget = std::min(missing.size(), MaxPendingLoads - m_Stream->Pending.size());
+            const StreamState::Clock::time_point now = StreamState::Clock::now();
+
+            for (size_t i = 0; i < budget; ++i)
+            {
+                m_Stream->Pending.emplace(MakeTilemapChunkKey(missing[i].x, missing[i].y), now);
+
+                auto load = [state = m_Stream, chunkX = missing[i].x, chunkY = missing[i].y]()
+                {
+                    StreamState::LoadedChunk loaded;
+                    loaded.ChunkX = chunkX;
+                    loaded.ChunkY = chunkY;
+                    loaded.Found = state->Store->ReadChunk(chunkX, chunkY, loaded.Tiles);
+
+                    std::lock_guard lock(state->Mutex);
+                    state->Completed.push_back(std::move(loaded));
+                };
+
+                if (JobSystem* jobs = JobSystem::Get())
+                    jobs->Schedule(std::move(load));
+                else
+                    load();
+            }
+        }
+
+        ApplyLoadedChunks(focus, keepRadius);
+    }
+
+    void Tilemap::ApplyLoadedChunks(const glm::ivec2& focusChunk, int keepRadius)
+    {
+        std::vector<StreamState::LoadedChunk> completed;
+        {
+            std::lock_guard lock(m_Stream->Mutex);
+            completed.swap(m_Stream->Completed);
+        }
+
+        if (completed.empty())
+            return;
+
+        const StreamState::Clock::time_point now = StreamState::Clock::now();
+        TilemapStreamingStats& stats = m_Stream->Stats;
+
+        for (StreamState::LoadedChunk& loaded : completed)
+        {
+            const uint64_t key = MakeTilemapChunkKey(loaded.ChunkX, loaded.ChunkY);
+
+            auto pending = m_Stream->Pending.find(key);
+            if (pending != m_Stream->Pending.end())
+            {
+                const double loadMs = std::chrono::duration<double, std::milli>(now - pending->second).count();
+                m_Stream->Pending.erase(pending);
+
+                ++stats.LoadedChunks;
+                stats.LastLoadMs = loadMs;
+                stats.MaxLoadMs = std::max(stats.MaxLoadMs, loadMs);
+                m_Stream->TotalLoadMs += loadMs;
+                stats.AverageLoadMs = m_Stream->TotalLoadMs / static_cast<double>(stats.LoadedChunks);
+            }
+
+            const int distance = std::max(std::abs(loaded.ChunkX - focusChunk.x), std::abs(loaded.ChunkY - focusChunk.y));
+            TilemapChunk* chunk = FindChunk(loaded.ChunkX, loaded.ChunkY);
+
+            // Left behind while loading
+            if (!chunk && distance > keepRadius)
+                continue;
+
+            if (!chunk)
+            {
+                chunk = &GetOrCreateChunk(loaded.ChunkX, loaded.ChunkY);
+                if (loaded.Found)
+                    chunk->Tiles = std::move(loaded.Tiles);
+            }
+            else if (loaded.Found)
+            {
+                // Painted while the load was in flight; the edits stay on top of the stored tiles
+                if (chunk->Tiles.empty())
+                    chunk->Tiles.assign(loaded.Tiles.size(), -1);
+
+                for (size_t i = 0; i < chunk->Tiles.size(); ++i)
+                {
+                    if (chunk->Tiles[i] < 0)
+                        chunk->Tiles[i] = loaded.Tiles[i];
+                }
+            }
+
+            chunk->Streamed = true;
+            chunk->TileCount = CountTiles(chunk->Tiles);
+            chunk->LookupDirty = true;
+            chunk->Revision = ++m_Revision;
+
+            MarkMeshDirty(*chunk, 0, static_cast<uint32_t>(m_ChunkSize * m_ChunkSize));
+        }
+    }
+
+    TilemapStreamingStats Tilemap::GetStreamingStats() const
+    {
+        if (!m_Stream)
+            return {};
 
-        chunk.Dirty = false;
+        TilemapStreamingStats stats = m_Stream->Stats;
+        stats.PendingLoads = static_cast<uint32_t>(m_Stream->Pending.size());
+        stats.DiskBytesRead = m_Stream->Store->GetBytesRead();
+        return stats;
     }
-}
+}
\ No newline at end of file
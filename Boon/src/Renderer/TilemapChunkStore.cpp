@@ -0,0 +1,262 @@
+#include "Renderer/TilemapChunkStore.h"
+#include "Renderer/Tilemap.h"
+#include "Core/Memory/Compression.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace Boon
+{
+    namespace
+    {
+        int FloorDiv(int value, int divisor)
+        {
+            const int q = value / divisor;
+            return (value % divisor != 0 && (value < 0) != (divisor < 0)) ? q - 1 : q;
+        }
+
+        int FloorMod(int value, int divisor)
+        {
+            return value - FloorDiv(value, divisor) * divisor;
+        }
+
+        size_t RegionLocalIndex(int chunkX, int chunkY)
+        {
+            const int size = TilemapChunkStore::RegionSize;
+            return static_cast<size_t>(FloorMod(chunkY, size) * size + FloorMod(chunkX, size));
+        }
+    }
+
+    std::shared_ptr<TilemapChunkStore> TilemapChunkStore::Open(const std::filesystem::path& path)
+    {
+        auto store = std::make_shared<TilemapChunkStore>();
+
+        store->m_File.open(path, std::ios::in | std::ios::binary);
+        if (!store->m_File)
+            return nullptr;
+
+        store->m_File.seekg(0, std::ios::end);
+        store->m_FileSize = static_cast<uint64_t>(store->m_File.tellg());
+        store->m_File.seekg(0, std::ios::beg);
+
+        FileHeader header{};
+        if (!store->m_File.read(reinterpret_cast<char*>(&header), sizeof(header)))
+            return nullptr;
+
+        if (header.Magic != Magic || header.Version != Version ||
+            header.RegionSize != RegionSize || header.ChunkSize <= 0)
+            return nullptr;
+
+        const uint64_t tableBytes = static_cast<uint64_t>(header.RegionCount) * sizeof(RegionTableEntry);
+        if (header.RegionTableOffset > store->m_FileSize || tableBytes > store->m_FileSize - header.RegionTableOffset)
+            return nullptr;
+
+        std::vector<RegionTableEntry> table(header.RegionCount);
+        store->m_File.seekg(static_cast<std::streamoff>(header.RegionTableOffset));
+        if (!store->m_File.read(reinterpret_cast<char*>(table.data()), static_cast<std::streamsize>(tableBytes)))
+            return nullptr;
+
+        store->m_RegionOffsets.reserve(table.size());
+        for (const RegionTableEntry& entry : table)
+            store->m_RegionOffsets[MakeTilemapChunkKey(entry.RegionX, entry.RegionY)] = entry.BlockOffset;
+
+        store->m_ChunkSize = header.ChunkSize;
+        return store;
+    }
+
+    bool TilemapChunkStore::Save(const std::filesystem::path& path, const Tilemap& tilemap)
+    {
+        TilemapChunkStoreWriter writer(path, tilemap.GetChunkSize());
+
+        for (const auto& [key, chunk] : tilemap.GetChunks())
+        {
+            if (chunk.TileCount > 0 && !writer.AddChunk(chunk.ChunkX, chunk.ChunkY, chunk.Tiles.data()))
+                return false;
+        }
+
+        return writer.Finish();
+    }
+
+    const TilemapChunkStore::ChunkEntry* TilemapChunkStore::FindChunkEntry(int chunkX, int chunkY)
+    {
+        const uint64_t regionKey = MakeTilemapChunkKey(FloorDiv(chunkX, RegionSize), FloorDiv(chunkY, RegionSize));
+
+        auto cached = m_RegionCache.find(regionKey);
+        if (cached == m_RegionCache.end())
+        {
+            auto offset = m_RegionOffsets.find(regionKey);
+            if (offset == m_RegionOffsets.end())
+                return nullptr;
+
+            std::vector<ChunkEntry> block(static_cast<size_t>(RegionSize) * RegionSize);
+            const uint64_t blockBytes = block.size() * sizeof(ChunkEntry);
+            if (offset->second > m_FileSize || blockBytes > m_FileSize - offset->second)
+                return nullptr;
+
+            m_File.clear();
+            m_File.seekg(static_cast<std::streamoff>(offset->second));
+            if (!m_File.read(reinterpret_cast<char*>(block.data()), static_cast<std::streamsize>(blockBytes)))
+                return nullptr;
+
+            // The working set of regions around a camera is small, start over rather than track recency
+            if (m_RegionCache.size() >= MaxCachedRegions)
+                m_RegionCache.clear();
+
+            cached = m_RegionCache.emplace(regionKey, std::move(block)).first;
+        }
+
+        const ChunkEntry& entry = cached->second[RegionLocalIndex(chunkX, chunkY)];
+        return entry.Size > 0 ? &entry : nullptr;
+    }
+
+    bool TilemapChunkStore::ReadChunk(int chunkX, int chunkY, std::vector<int>& outTiles)
+    {
+        Buffer compressed;
+        {
+            std::lock_guard lock(m_Mutex);
+
+            const ChunkEntry* entry = FindChunkEntry(chunkX, chunkY);
+            if (!entry || entry->Offset > m_FileSize || entry->Size > m_FileSize - entry->Offset)
+                return false;
+
+            compressed.Resize(entry->Size);
+            m_File.clear();
+            m_File.seekg(static_cast<std::streamoff>(entry->Offset));
+            if (!m_File.read(reinterpret_cast<char*>(compressed.Data()), static_cast<std::streamsize>(entry->Size)))
+                return false;
+        }
+
+        m_BytesRead.fetch_add(compressed.Size(), std::memory_order_relaxed);
+
+        outTiles.resize(static_cast<size_t>(m_ChunkSize) * m_ChunkSize);
+        return DecodeTiles(compressed.Data(), compressed.Size(), outTiles.data(), outTiles.size());
+    }
+
+    uint64_t TilemapChunkStore::GetBytesRead() const
+    {
+        return m_BytesRead.load(std::memory_order_relaxed);
+    }
+
+    void TilemapChunkStore::EncodeTiles(const int* tiles, size_t count, Buffer& out)
+    {
+        Compression::Compress(reinterpret_cast<const uint8_t*>(tiles), count * sizeof(int), out);
+    }
+
+    bool TilemapChunkStore::DecodeTiles(const uint8_t* data, size_t size, int* outTiles, size_t count)
+    {
+        return Compression::Decompress(data, size, reinterpret_cast<uint8_t*>(outTiles), count * sizeof(int));
+    }
+
+    TilemapChunkStoreWriter::TilemapChunkStoreWriter(const std::filesystem::path& path, int chunkSize)
+        : m_Path(path)
+        , m_ChunkSize(chunkSize)
+    {
+        m_TempPath = path;
+        m_TempPath += ".tmp";
+
+        std::error_code ec;
+        if (path.has_parent_path())
+            std::filesystem::create_directories(path.parent_path(), ec);
+
+        m_File.open(m_TempPath, std::ios::out | std::ios::binary | std::ios::trunc);
+
+        // Header is rewritten by Finish once the region table offset is known
+        TilemapChunkStore::FileHeader header{};
+        m_File.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        m_Offset = sizeof(header);
+
+        m_Failed = !m_File || chunkSize <= 0;
+    }
+
+    TilemapChunkStoreWriter::~TilemapChunkStoreWriter()
+    {
+        if (m_Finished)
+            return;
+
+        m_File.close();
+
+        std::error_code ec;
+        std::filesystem::remove(m_TempPath, ec);
+    }
+
+    bool TilemapChunkStoreWriter::AddChunk(int chunkX, int chunkY, const int* tiles)
+    {
+        if (m_Failed || m_Finished || !tiles)
+            return false;
+
+        const size_t count = static_cast<size_t>(m_ChunkSize) * m_ChunkSize;
+        if (std::all_of(tiles, tiles + count, [](int tile) { return tile < 0; }))
+            return true;
+
+        m_Scratch.Clear();
+        TilemapChunkStore::EncodeTiles(tiles, count, m_Scratch);
+
+        const int regionSize = TilemapChunkStore::RegionSize;
+        const uint64_t regionKey = MakeTilemapChunkKey(FloorDiv(chunkX, regionSize), FloorDiv(chunkY, regionSize));
+
+        std::vector<TilemapChunkStore::ChunkEntry>& region = m_Regions[regionKey];
+        if (region.empty())
+            region.resize(static_cast<size_t>(regionSize) * regionSize, TilemapChunkStore::ChunkEntry{});
+
+        region[RegionLocalIndex(chunkX, chunkY)] = { m_Offset, static_cast<uint32_t>(m_Scratch.Size()), 0 };
+
+        m_File.write(reinterpret_cast<const char*>(m_Scratch.Data()), static_cast<std::streamsize>(m_Scratch.Size()));
+        m_Offset += m_Scratch.Size();
+
+        m_Failed = !m_File;
+        return !m_Failed;
+    }
+
+    bool TilemapChunkStoreWriter::Finish()
+    {
+        if (m_Failed || m_Finished)
+            return false;
+
+        std::vector<TilemapChunkStore::RegionTableEntry> table;
+        table.reserve(m_Regions.size());
+
+        for (const auto& [key, region] : m_Regions)
+        {
+            const int32_t regionX = static_cast<int32_t>(static_cast<uint32_t>(key));
+            const int32_t regionY = static_cast<int32_t>(static_cast<uint32_t>(key >> 32));
+            table.push_back({ regionX, regionY, m_Offset });
+
+            const size_t blockBytes = region.size() * sizeof(TilemapChunkStore::ChunkEntry);
+            m_File.write(reinterpret_cast<const char*>(region.data()), static_cast<std::streamsize>(blockBytes));
+            m_Offset += blockBytes;
+        }
+
+        TilemapChunkStore::FileHeader header{};
+        header.Magic = TilemapChunkStore::Magic;
+        header.Version = TilemapChunkStore::Version;
+        header.ChunkSize = m_ChunkSize;
+        header.RegionSize = TilemapChunkStore::RegionSize;
+        header.RegionCount = static_cast<uint32_t>(table.size());
+        header.RegionTableOffset = m_Offset;
+
+        m_File.write(reinterpret_cast<const char*>(table.data()),
+            static_cast<std::streamsize>(table.size() * sizeof(TilemapChunkStore::RegionTableEntry)));
+
+        m_File.seekp(0);
+        m_File.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        m_File.close();
+
+        if (!m_File)
+        {
+            m_Failed = true;
+            return false;
+        }
+
+        std::error_code ec;
+        std::filesystem::rename(m_TempPath, m_Path, ec);
+        if (ec)
+        {
+            std::filesystem::remove(m_TempPath, ec);
+            m_Failed = true;
+            return false;
+        }
+
+        m_Finished = true;
+        return true;
+    }
+}
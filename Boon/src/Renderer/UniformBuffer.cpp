@@ -14,3 +14,13 @@ std::shared_ptr<UniformBuffer> Boon::UniformBuffer::Create(size_t size, uint32_t
 	}
 	return nullptr;
 }
+
+uint32_t Boon::UniformBuffer::GetOffsetAlignment()
+{
+	switch (RenderAPI::GetAPI())
+	{
+	case ERenderAPI::OpenGL:
+		return OpenGLUniformBuffer::GetOffsetAlignment();
+	}
+	return 256;
+}
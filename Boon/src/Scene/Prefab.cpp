@@ -1,9 +1,292 @@
 #include "Scene/Prefab.h"
+#include "Scene/BRef.h"
+#include "Asset/Asset.h"
+#include "Component/NameComponent.h"
+#include "Component/TransformComponent.h"
+#include "Serialization/BufferReader.h"
+
+#include <cstring>
+#include <string>
 
 namespace Boon
 {
+	namespace
+	{
+		constexpr uint32_t PrefabMagic = 0x42465042; // 'BPFB'
+		constexpr uint32_t PrefabVersion = 1;
+
+		void WriteValue(Buffer& out, const BProperty& prop, const uint8_t* base)
+		{
+			switch (prop.typeId)
+			{
+			case BTypeId::String:
+				out.WriteString(*reinterpret_cast<const std::string*>(base + prop.offset));
+				break;
+
+			case BTypeId::AssetRef:
+				out.Write<uint64_t>(static_cast<uint64_t>(*reinterpret_cast<const AssetHandle*>(base + prop.offset)));
+				break;
+
+			case BTypeId::BRef:
+				// Cleared when the template is built, nothing to store
+				break;
+
+			default:
+				out.WriteRaw(base + prop.offset, prop.size);
+				break;
+			}
+		}
+
+		void ReadValue(const uint8_t* data, size_t size, const BProperty& prop, uint8_t* base)
+		{
+			switch (prop.typeId)
+			{
+			case BTypeId::String:
+			{
+				uint32_t length = 0;
+				if (size < sizeof(length))
+					return;
+
+				std::memcpy(&length, data, sizeof(length));
+				if (length == size - sizeof(length))
+					reinterpret_cast<std::string*>(base + prop.offset)->assign(reinterpret_cast<const char*>(data + sizeof(length)), length);
+				break;
+			}
+
+			case BTypeId::AssetRef:
+			{
+				uint64_t handle = 0;
+				if (size != sizeof(handle))
+					return;
+
+				std::memcpy(&handle, data, sizeof(handle));
+				*reinterpret_cast<AssetHandle*>(base + prop.offset) = handle;
+				break;
+			}
+
+			case BTypeId::BRef:
+				break;
+
+			default:
+				if (size == prop.size)
+					std::memcpy(base + prop.offset, data, size);
+				break;
+			}
+		}
+	}
+
+	Prefab::~Prefab()
+	{
+		Clear();
+	}
+
+	void Prefab::Capture(GameObject root)
+	{
+		Clear();
+
+		if (!root.IsValid())
+			return;
+
+		CaptureNode(root, -1);
+
+		for (PrefabNode& node : m_Nodes)
+			ResolveNode(node);
+	}
+
 	void Prefab::ApplyTo(GameObject obj)
 	{
-		
+		if (m_Nodes.empty() || !obj.IsValid())
+			return;
+
+		for (const PrefabComponent& comp : m_Nodes[0].Components)
+		{
+			void* dst = obj.GetOrAddComponentByClass(comp.Class);
+
+			if (comp.Class->type != typeid(TransformComponent))
+			{
+				comp.Class->copyInstance(comp.Instance, dst);
+				continue;
+			}
+
+			// The template's transform belongs to no object, keep the one obj is attached to
+			TransformComponent& transform = *static_cast<TransformComponent*>(dst);
+			SceneComponent* owner = transform.m_Owner;
+			comp.Class->copyInstance(comp.Instance, dst);
+			transform.m_Owner = owner;
+			transform.SetDirty(TransformComponent::TransformFlag::All, true);
+		}
+	}
+
+	void Prefab::Serialize(Buffer& out) const
+	{
+		out.Write<uint32_t>(PrefabMagic);
+		out.Write<uint32_t>(PrefabVersion);
+		out.Write<uint32_t>(static_cast<uint32_t>(m_Nodes.size()));
+
+		for (const PrefabNode& node : m_Nodes)
+		{
+			out.Write<int32_t>(node.Parent);
+			out.Write<uint32_t>(static_cast<uint32_t>(node.Components.size()));
+
+			for (const PrefabComponent& comp : node.Components)
+			{
+				const std::vector<BProperty>& props = comp.Class->GetProperties();
+
+				out.Write<uint32_t>(comp.Class->hash);
+				out.WriteString(comp.Class->name);
+				out.Write<uint32_t>(static_cast<uint32_t>(props.size()));
+
+				for (const BProperty& prop : props)
+				{
+					out.WriteString(prop.name);
+					out.Write<uint8_t>(static_cast<uint8_t>(prop.typeId));
+
+					// Sized records, so a loader can step over properties it no longer knows
+					const size_t sizePos = out.Size();
+					out.Write<uint32_t>(0);
+					WriteValue(out, prop, static_cast<const uint8_t*>(comp.Instance));
+
+					const uint32_t size = static_cast<uint32_t>(out.Size() - sizePos - sizeof(uint32_t));
+					std::memcpy(out.DataAt(sizePos), &size, sizeof(size));
+				}
+			}
+		}
+	}
+
+	bool Prefab::Deserialize(const Buffer& data)
+	{
+		Clear();
+
+		BufferReader in(data);
+		if (in.Read<uint32_t>() != PrefabMagic || in.Read<uint32_t>() != PrefabVersion)
+			return false;
+
+		const uint32_t nodeCount = in.Read<uint32_t>();
+		if (in.Failed())
+			return false;
+
+		for (uint32_t n = 0; n < nodeCount; ++n)
+		{
+			const int32_t parent = in.Read<int32_t>();
+			const uint32_t componentCount = in.Read<uint32_t>();
+
+			// Parents come first, anything else would break the spawn order
+			if (in.Failed() || parent >= static_cast<int32_t>(n) || (n == 0) != (parent < 0))
+			{
+				Clear();
+				return false;
+			}
+
+			PrefabNode& node = m_Nodes.emplace_back();
+			node.Parent = parent;
+
+			for (uint32_t c = 0; c < componentCount; ++c)
+			{
+				const BClassID hash = in.Read<uint32_t>();
+				in.ReadString();
+				const uint32_t propCount = in.Read<uint32_t>();
+				if (in.Failed())
+				{
+					Clear();
+					return false;
+				}
+
+				BClass* cls = BClassRegistry::Get().Find(hash);
+				uint8_t* instance = cls ? static_cast<uint8_t*>(AddInstance(node, cls)) : nullptr;
+
+				for (uint32_t p = 0; p < propCount; ++p)
+				{
+					const std::string propName = in.ReadString();
+					const BTypeId typeId = static_cast<BTypeId>(in.Read<uint8_t>());
+					const uint32_t size = in.Read<uint32_t>();
+					const uint8_t* value = in.Take(size);
+					if (in.Failed())
+					{
+						Clear();
+						return false;
+					}
+
+					const BProperty* prop = instance ? cls->FindProperty(propName) : nullptr;
+					if (prop && prop->typeId == typeId)
+						ReadValue(value, size, *prop, instance);
+				}
+			}
+		}
+
+		for (PrefabNode& node : m_Nodes)
+			ResolveNode(node);
+
+		return true;
+	}
+
+	void Prefab::CaptureNode(GameObject obj, int32_t parent)
+	{
+		const int32_t index = static_cast<int32_t>(m_Nodes.size());
+		m_Nodes.emplace_back().Parent = parent;
+
+		BClassRegistry::Get().ForEach([this, &obj, index](BClass& cls)
+			{
+				if (obj.HasComponentByClass(&cls))
+					cls.copyInstance(obj.GetComponentByClass(&cls), AddInstance(m_Nodes[index], &cls));
+			});
+
+		for (GameObject child : obj.GetChildren())
+			CaptureNode(child, index);
+	}
+
+	void* Prefab::AddInstance(PrefabNode& node, BClass* cls)
+	{
+		void* instance = cls->createInstance();
+		node.Components.push_back({ cls, instance });
+		return instance;
+	}
+
+	void Prefab::ResolveNode(PrefabNode& node)
+	{
+		BClass* transformClass = BClassRegistry::Get().Find<TransformComponent>();
+		BClass* nameClass = BClassRegistry::Get().Find<NameComponent>();
+
+		bool hasTransform = false;
+		bool hasName = false;
+
+		for (const PrefabComponent& comp : node.Components)
+		{
+			hasTransform |= comp.Class == transformClass;
+			hasName |= comp.Class == nameClass;
+
+			// Whatever they pointed at is not part of the spawned copy
+			for (const BProperty& prop : comp.Class->GetProperties())
+			{
+				if (prop.typeId == BTypeId::BRef)
+					reinterpret_cast<BRefBase*>(static_cast<uint8_t*>(comp.Instance) + prop.offset)->Set(GameObject());
+			}
+		}
+
+		// Spawned objects get these like any other, the template has to provide them
+		if (!hasTransform && transformClass)
+			AddInstance(node, transformClass);
+		if (!hasName && nameClass)
+			static_cast<NameComponent*>(AddInstance(node, nameClass))->Name = "GameObject";
+
+		for (const PrefabComponent& comp : node.Components)
+		{
+			if (comp.Class != transformClass)
+				continue;
+
+			TransformComponent& transform = *static_cast<TransformComponent*>(comp.Instance);
+			transform.m_Owner = nullptr;
+			transform.SetDirty(TransformComponent::TransformFlag::All, true);
+		}
+	}
+
+	void Prefab::Clear()
+	{
+		for (PrefabNode& node : m_Nodes)
+		{
+			for (PrefabComponent& comp : node.Components)
+				comp.Class->destroyInstance(comp.Instance);
+		}
+
+		m_Nodes.clear();
 	}
-}
\ No newline at end of file
+}
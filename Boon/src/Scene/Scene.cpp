@@ -1,14 +1,18 @@
 #include "Scene/Scene.h"
 #include "Scene/GameObject.h"
+#include "Scene/Prefab.h"
 
 #include "Component/SceneComponent.h"
 #include "Component/NameComponent.h"
 #include "Component/ECSLifecycle.h"
 
+#include "Asset/SpriteAnimatorSystem.h"
+
 #include "Core/EngineContext.h"
 
 #include "Physics/Physics2D.h"
 
+#include <chrono>
 #include <iostream>
 
 using namespace Boon;
@@ -83,6 +87,102 @@ GameObject Boon::Scene::Instantiate(UUID uuid, const glm::vec3& pos)
 	return instance;
 }
 
+std::vector<GameObjectID> Boon::Scene::Instantiate(const Prefab& prefab, size_t count)
+{
+	const size_t nodeCount = prefab.m_Nodes.size();
+	if (nodeCount == 0 || count == 0)
+		return {};
+
+	const auto start = std::chrono::steady_clock::now();
+	const size_t total = nodeCount * count;
+
+	ReserveGameObjects(total);
+
+	// Node major: the copies of one template node sit next to each other, so every
+	// template component is a single insert over a contiguous run of objects
+	std::vector<GameObjectID> objects(total);
+	m_Registry.create(objects.begin(), objects.end());
+
+	std::vector<UUIDComponent> uuids(total);
+	for (size_t i = 0; i < total; ++i)
+		m_EntityMap.emplace(uuids[i].Uuid, objects[i]);
+	m_Registry.insert<UUIDComponent>(objects.begin(), objects.end(), uuids.begin());
+
+	std::vector<SceneComponent> hierarchy(total);
+	for (size_t node = 0; node < nodeCount; ++node)
+	{
+		const int32_t parent = prefab.m_Nodes[node].Parent;
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			SceneComponent& sceneComp = hierarchy[node * count + i];
+			sceneComp.m_Owner = objects[node * count + i];
+			sceneComp.m_pScene = this;
+
+			if (parent < 0)
+				continue;
+
+			sceneComp.m_Parent = objects[parent * count + i];
+			hierarchy[parent * count + i].m_Children.push_back(sceneComp.m_Owner);
+		}
+	}
+	m_Registry.insert<SceneComponent>(objects.begin(), objects.end(), hierarchy.begin());
+
+	for (size_t node = 0; node < nodeCount; ++node)
+	{
+		const GameObjectID* pObjects = objects.data() + node * count;
+
+		for (const Prefab::PrefabComponent& comp : prefab.m_Nodes[node].Components)
+		{
+			if (comp.Class->insertComponents)
+				comp.Class->insertComponents(*this, pObjects, count, comp.Instance);
+		}
+	}
+
+	for (GameObjectID handle : objects)
+		m_Registry.get<TransformComponent>(handle).m_Owner = &m_Registry.get<SceneComponent>(handle);
+
+	// Awake sees complete objects, children included
+	if (m_Running)
+	{
+		for (size_t node = 0; node < nodeCount; ++node)
+		{
+			for (const Prefab::PrefabComponent& comp : prefab.m_Nodes[node].Components)
+			{
+				if (!comp.Class->awake)
+					continue;
+
+				for (size_t i = 0; i < count; ++i)
+				{
+					GameObject obj{ objects[node * count + i], this };
+					comp.Class->awake(obj);
+				}
+			}
+		}
+	}
+
+	m_OnGameObjectsSpawned.Invoke(std::span<const GameObjectID>(objects));
+
+	++m_PrefabSpawnStats.Batches;
+	m_PrefabSpawnStats.Objects += total;
+	m_PrefabSpawnStats.Milliseconds += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+	objects.resize(count);
+	return objects;
+}
+
+void Boon::Scene::ReserveGameObjects(size_t count)
+{
+	const size_t total = m_EntityMap.size() + count;
+
+	m_Registry.storage<GameObjectID>().reserve(total);
+	m_Registry.storage<SceneComponent>().reserve(total);
+	m_Registry.storage<UUIDComponent>().reserve(total);
+	m_Registry.storage<TransformComponent>().reserve(total);
+	m_Registry.storage<NameComponent>().reserve(total);
+	m_EntityMap.reserve(total);
+}
+
 void Boon::Scene::Awake()
 {
 	m_Running = true;
@@ -122,6 +222,9 @@ void Boon::Scene::OnUpdate()
 {
 	m_Physics2D.Update(this);
 	m_pECSlifecycle->UpdateAll();
+
+	// After scripts, so clips they switch this frame show this frame
+	SpriteAnimatorSystem::Update(*this, GetTime().GetDeltaTime());
 }
 
 void Boon::Scene::LateUpdate()
@@ -147,9 +250,27 @@ void Boon::Scene::EndUpdate()
 	}
 }
 
-bool Boon::Scene::Raycast2D(const Ray2D& ray, HitResult2D& result) const
+bool Boon::Scene::Raycast2D(const Ray2D& ray, HitResult2D& result, const QueryFilter2D& filter) const
+{
+	return m_Physics2D.Raycast(ray, result, filter);
+}
+
+void Boon::Scene::RaycastBatch2D(std::span<const Ray2D> rays, std::span<HitResult2D> hits, std::span<uint32_t> hitCounts,
+	uint32_t maxHitsPerRay, const QueryFilter2D& filter) const
+{
+	m_Physics2D.RaycastBatch(rays, hits, hitCounts, maxHitsPerRay, filter);
+}
+
+void Boon::Scene::ShapeCastBatch2D(std::span<const ShapeCast2D> casts, std::span<HitResult2D> hits, std::span<uint32_t> hitCounts,
+	uint32_t maxHitsPerCast, const QueryFilter2D& filter) const
+{
+	m_Physics2D.ShapeCastBatch(casts, hits, hitCounts, maxHitsPerCast, filter);
+}
+
+void Boon::Scene::OverlapBatch2D(std::span<const AABB2D> boxes, std::span<GameObjectID> hits, std::span<uint32_t> hitCounts,
+	uint32_t maxHitsPerBox, const QueryFilter2D& filter) const
 {
-	return m_Physics2D.Raycast(ray, result);
+	m_Physics2D.OverlapBatch(boxes, hits, hitCounts, maxHitsPerBox, filter);
 }
 
 void Boon::Scene::OnBeginOverlap(GameObject overlapped, GameObject other)
@@ -1,6 +1,8 @@
 #include "Scene/SceneSerializer.h"
 #include "Component/NameComponent.h"
 #include "Component/SceneComponent.h"
+#include "Component/TransformComponent.h"
+#include "Component/UUIDComponent.h"
 #include "Asset/Asset.h"
 #include "Asset/AssetRef.h"
 #include "BoonDebug/Logger.h"
@@ -8,14 +10,127 @@
 #include "Scene/GameObject.h"
 #include "Reflection/BClass.h"
 
+#include "Core/Memory/Buffer.h"
+#include "Serialization/BufferReader.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstring>
 #include <iostream>
 #include <fstream>
+#include <vector>
 #include <nlohmann/json.hpp>
 
 using json = nlohmann::json;
 
 using namespace Boon;
 
+namespace
+{
+    constexpr uint32_t BinarySceneMagic = 0x4E435342; // 'BSCN'
+    constexpr uint32_t BinarySceneVersion = 1;
+
+    struct BinarySceneHeader
+    {
+        uint32_t Magic;
+        uint32_t Version;
+        uint32_t ObjectCount;
+        uint32_t ClassCount;
+    };
+
+    static_assert(sizeof(GameObjectID) == sizeof(uint32_t));
+
+    template<typename T>
+    T LoadAt(const uint8_t* data, size_t index)
+    {
+        T value;
+        std::memcpy(&value, data + index * sizeof(T), sizeof(T));
+        return value;
+    }
+
+    void WriteColumn(Buffer& out, const BProperty& prop, const std::vector<uint8_t*>& bases)
+    {
+        switch (prop.typeId)
+        {
+        case BTypeId::String:
+            for (const uint8_t* base : bases)
+                out.WriteString(*reinterpret_cast<const std::string*>(base + prop.offset));
+            break;
+
+        case BTypeId::AssetRef:
+            for (const uint8_t* base : bases)
+                out.Write<uint64_t>(static_cast<uint64_t>(*reinterpret_cast<const AssetHandle*>(base + prop.offset)));
+            break;
+
+        case BTypeId::BRef:
+            for (const uint8_t* base : bases)
+                out.Write<uint32_t>(static_cast<uint32_t>((GameObjectID)reinterpret_cast<const BRefBase*>(base + prop.offset)->Owner()));
+            break;
+
+        default:
+        {
+            // Plain data, one tightly packed run of values for the whole column
+            const size_t start = out.Size();
+            out.Resize(start + bases.size() * prop.size);
+
+            uint8_t* dst = out.Data() + start;
+            for (const uint8_t* base : bases)
+            {
+                std::memcpy(dst, base + prop.offset, prop.size);
+                dst += prop.size;
+            }
+            break;
+        }
+        }
+    }
+
+    void ReadColumn(BufferReader& in, const BProperty& prop, const std::vector<uint8_t*>& bases, Scene& scene)
+    {
+        switch (prop.typeId)
+        {
+        case BTypeId::String:
+            for (uint8_t* base : bases)
+                *reinterpret_cast<std::string*>(base + prop.offset) = in.ReadString();
+            break;
+
+        case BTypeId::AssetRef:
+            for (uint8_t* base : bases)
+                *reinterpret_cast<AssetHandle*>(base + prop.offset) = in.Read<uint64_t>();
+            break;
+
+        case BTypeId::BRef:
+            for (uint8_t* base : bases)
+                reinterpret_cast<BRefBase*>(base + prop.offset)->Set(GameObject(static_cast<GameObjectID>(in.Read<uint32_t>()), &scene));
+            break;
+
+        default:
+        {
+            const uint8_t* src = in.Take(bases.size() * prop.size);
+            if (!src)
+                return;
+
+            for (uint8_t* base : bases)
+            {
+                std::memcpy(base + prop.offset, src, prop.size);
+                src += prop.size;
+            }
+            break;
+        }
+        }
+    }
+
+    bool IsBinaryScene(const std::filesystem::path& path)
+    {
+        std::ifstream file(path, std::ios::binary);
+
+        uint32_t magic = 0;
+        file.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+
+        return file && magic == BinarySceneMagic;
+    }
+}
+
 Boon::SceneSerializer::SceneSerializer(Scene& scene)
 	: m_Context(scene){}
 
@@ -167,7 +282,293 @@ void Boon::SceneSerializer::Serialize(const std::filesystem::path& dst)
 }
 
 
+void Boon::SceneSerializer::SerializeBinary(const std::filesystem::path& dst)
+{
+    std::vector<GameObject> objects;
+    m_Context.ForeachGameObject([&](GameObject gameObject)
+        {
+            objects.push_back(gameObject);
+        });
+
+    const uint32_t objectCount = static_cast<uint32_t>(objects.size());
+
+    Buffer out;
+    out.Write(BinarySceneHeader{ BinarySceneMagic, BinarySceneVersion, objectCount, 0 });
+    out.WriteString(m_Context.m_Name);
+
+    // Object table, one column per field; classes below refer to objects by their index in it
+    for (GameObject& gameObject : objects)
+        out.Write<uint64_t>(static_cast<uint64_t>(gameObject.GetUUID()));
+
+    for (GameObject& gameObject : objects)
+        out.Write<uint32_t>(static_cast<uint32_t>((GameObjectID)gameObject));
+
+    for (GameObject& gameObject : objects)
+        out.Write<uint32_t>(static_cast<uint32_t>(gameObject.GetComponent<SceneComponent>().m_Parent));
+
+    for (GameObject& gameObject : objects)
+        out.Write<uint32_t>(static_cast<uint32_t>(gameObject.GetComponent<SceneComponent>().m_Children.size()));
+
+    for (GameObject& gameObject : objects)
+    {
+        for (GameObjectID child : gameObject.GetComponent<SceneComponent>().m_Children)
+            out.Write<uint32_t>(static_cast<uint32_t>(child));
+    }
+
+    uint32_t classCount = 0;
+    std::vector<uint32_t> rows;
+    std::vector<uint8_t*> bases;
+
+    BClassRegistry::Get().ForEach([&](const BClass& cls)
+        {
+            rows.clear();
+            bases.clear();
+
+            for (uint32_t i = 0; i < objectCount; ++i)
+            {
+                if (!objects[i].HasComponentByClass(&cls))
+                    continue;
+
+                rows.push_back(i);
+                bases.push_back(reinterpret_cast<uint8_t*>(objects[i].GetComponentByClass(&cls)));
+            }
+
+            if (rows.empty())
+                return;
+
+            out.Write<uint32_t>(cls.hash);
+            out.WriteString(cls.name);
+
+            // Block size, so readers can step over classes they do not know
+            const size_t blockSizeAt = out.Size();
+            out.Write<uint64_t>(0);
+            const size_t blockStart = out.Size();
+
+            out.Write<uint32_t>(static_cast<uint32_t>(rows.size()));
+            out.WriteRaw(rows.data(), rows.size() * sizeof(uint32_t));
+
+            uint32_t propertyCount = 0;
+            cls.ForEachProperty([&](const BProperty& prop)
+                {
+                    if (prop.typeId != BTypeId::Unknown)
+                        ++propertyCount;
+                });
+
+            out.Write<uint32_t>(propertyCount);
+
+            cls.ForEachProperty([&](const BProperty& prop)
+                {
+                    if (prop.typeId == BTypeId::Unknown)
+                        return;
+
+                    out.WriteString(prop.name);
+                    out.Write<uint8_t>(static_cast<uint8_t>(prop.typeId));
+                    out.Write<uint32_t>(static_cast<uint32_t>(prop.size));
+
+                    const size_t columnSizeAt = out.Size();
+                    out.Write<uint64_t>(0);
+                    const size_t columnStart = out.Size();
+
+                    WriteColumn(out, prop, bases);
+
+                    const uint64_t columnSize = out.Size() - columnStart;
+                    std::memcpy(out.Data() + columnSizeAt, &columnSize, sizeof(columnSize));
+                });
+
+            const uint64_t blockSize = out.Size() - blockStart;
+            std::memcpy(out.Data() + blockSizeAt, &blockSize, sizeof(blockSize));
+
+            ++classCount;
+        });
+
+    std::memcpy(out.Data() + offsetof(BinarySceneHeader, ClassCount), &classCount, sizeof(classCount));
+
+    std::ofstream file(dst, std::ios::binary | std::ios::trunc);
+    if (!file.write(reinterpret_cast<const char*>(out.Data()), static_cast<std::streamsize>(out.Size())))
+        BOON_LOG_ERROR("Could not write scene file: {}", dst.string());
+}
+
 void Boon::SceneSerializer::Deserialize(const std::filesystem::path& src)
+{
+    const auto start = std::chrono::steady_clock::now();
+    const bool binary = IsBinaryScene(src);
+
+    if (binary)
+    {
+        if (!DeserializeBinary(src))
+            return;
+    }
+    else
+        DeserializeJson(src);
+
+    const double milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    BOON_LOG("Loaded {} scene '{}' with {} objects in {:.1f} ms",
+        binary ? "binary" : "json", m_Context.m_Name, m_Context.m_EntityMap.size(), milliseconds);
+}
+
+bool Boon::SceneSerializer::DeserializeBinary(const std::filesystem::path& src)
+{
+    std::ifstream file(src, std::ios::binary | std::ios::ate);
+    if (!file.is_open())
+    {
+        BOON_LOG_ERROR("Could not open scene file: {}", src.string());
+        return false;
+    }
+
+    Buffer data(static_cast<size_t>(file.tellg()));
+    file.seekg(0);
+    if (!file.read(reinterpret_cast<char*>(data.Data()), static_cast<std::streamsize>(data.Size())))
+    {
+        BOON_LOG_ERROR("Could not read scene file: {}", src.string());
+        return false;
+    }
+
+    BufferReader in(data);
+
+    const BinarySceneHeader header = in.Read<BinarySceneHeader>();
+    if (in.Failed() || header.Magic != BinarySceneMagic || header.Version != BinarySceneVersion)
+    {
+        BOON_LOG_ERROR("Unsupported binary scene file: {}", src.string());
+        return false;
+    }
+
+    const std::string name = in.ReadString();
+
+    const size_t objectCount = header.ObjectCount;
+    const uint8_t* uuids = in.Take(objectCount * sizeof(uint64_t));
+    const uint8_t* ids = in.Take(objectCount * sizeof(uint32_t));
+    const uint8_t* parents = in.Take(objectCount * sizeof(uint32_t));
+    const uint8_t* childCounts = in.Take(objectCount * sizeof(uint32_t));
+
+    size_t childTotal = 0;
+    for (size_t i = 0; childCounts && i < objectCount; ++i)
+        childTotal += LoadAt<uint32_t>(childCounts, i);
+
+    const uint8_t* children = in.Take(childTotal * sizeof(uint32_t));
+
+    if (in.Failed())
+    {
+        BOON_LOG_ERROR("Truncated scene file: {}", src.string());
+        return false;
+    }
+
+    m_Context.m_Name = name;
+    m_Context.ReserveGameObjects(objectCount);
+
+    std::vector<GameObjectID> objects(objectCount);
+    size_t childIndex = 0;
+
+    for (size_t i = 0; i < objectCount; ++i)
+    {
+        GameObject gameObject = m_Context.Instantiate(
+            UUID(LoadAt<uint64_t>(uuids, i)),
+            static_cast<GameObjectID>(LoadAt<uint32_t>(ids, i)));
+
+        objects[i] = (GameObjectID)gameObject;
+
+        SceneComponent& scene = gameObject.GetComponent<SceneComponent>();
+        scene.m_Parent = static_cast<GameObjectID>(LoadAt<uint32_t>(parents, i));
+
+        const uint32_t childCount = LoadAt<uint32_t>(childCounts, i);
+        scene.m_Children.resize(childCount);
+        for (uint32_t c = 0; c < childCount; ++c)
+            scene.m_Children[c] = static_cast<GameObjectID>(LoadAt<uint32_t>(children, childIndex++));
+    }
+
+    std::vector<GameObjectID> rowObjects;
+    std::vector<uint8_t*> bases;
+    std::vector<bool> seenRows(objectCount);
+
+    for (uint32_t c = 0; c < header.ClassCount && !in.Failed(); ++c)
+    {
+        const BClassID classId = in.Read<uint32_t>();
+        const std::string className = in.ReadString();
+        const uint64_t blockSize = in.Read<uint64_t>();
+
+        if (!in.Has(blockSize))
+            break;
+
+        const size_t blockEnd = in.GetOffset() + blockSize;
+
+        const BClass* cls = BClassRegistry::Get().Find(classId);
+        if (!cls || !cls->addComponents || !cls->getComponent)
+        {
+            BOON_LOG_WARN("Unknown component class '{}' while deserializing.", className);
+            in.Seek(blockEnd);
+            continue;
+        }
+
+        const uint32_t rowCount = in.Read<uint32_t>();
+        const uint8_t* rows = in.Take(static_cast<size_t>(rowCount) * sizeof(uint32_t));
+        if (!rows)
+            break;
+
+        // A repeated row would insert the same component twice, which entt does not allow
+        rowObjects.clear();
+        std::fill(seenRows.begin(), seenRows.end(), false);
+
+        bool validRows = true;
+        for (uint32_t r = 0; r < rowCount; ++r)
+        {
+            const uint32_t row = LoadAt<uint32_t>(rows, r);
+            if (row >= objectCount || seenRows[row])
+            {
+                validRows = false;
+                break;
+            }
+
+            seenRows[row] = true;
+            rowObjects.push_back(objects[row]);
+        }
+
+        if (!validRows)
+        {
+            BOON_LOG_WARN("Invalid object rows for component class '{}' in scene file: {}", className, src.string());
+            in.Seek(blockEnd);
+            continue;
+        }
+
+        // One insert into the class's storage for every object carrying it
+        cls->addComponents(m_Context, rowObjects.data(), rowObjects.size());
+
+        bases.clear();
+        for (GameObjectID id : rowObjects)
+        {
+            GameObject gameObject(id, &m_Context);
+            bases.push_back(reinterpret_cast<uint8_t*>(cls->getComponent(gameObject)));
+        }
+
+        const uint32_t propertyCount = in.Read<uint32_t>();
+        for (uint32_t p = 0; p < propertyCount && !in.Failed(); ++p)
+        {
+            const std::string propName = in.ReadString();
+            const BTypeId typeId = static_cast<BTypeId>(in.Read<uint8_t>());
+            const uint32_t size = in.Read<uint32_t>();
+            const uint64_t columnSize = in.Read<uint64_t>();
+
+            const uint8_t* column = in.Take(columnSize);
+            if (!column && columnSize > 0)
+                break;
+
+            // Properties renamed, retyped or removed since the save keep their defaults
+            const BProperty* prop = cls->FindProperty(propName);
+            if (!prop || prop->typeId != typeId || prop->size != size)
+                continue;
+
+            BufferReader columnReader(column, columnSize);
+            ReadColumn(columnReader, *prop, bases, m_Context);
+        }
+
+        in.Seek(blockEnd);
+    }
+
+    if (in.Failed())
+        BOON_LOG_ERROR("Truncated scene file: {}", src.string());
+
+    return true;
+}
+
+void Boon::SceneSerializer::DeserializeJson(const std::filesystem::path& src)
 {
     std::ifstream file(src);
     if (!file.is_open())
@@ -361,25 +762,38 @@ void Boon::SceneSerializer::Clear()
 
 void Boon::SceneSerializer::Copy(Scene& from)
 {
-    for (auto pair : from.m_EntityMap)
+    const auto start = std::chrono::steady_clock::now();
+
+    SceneRegistry& registry = m_Context.m_Registry;
+    m_Context.ReserveGameObjects(from.m_EntityMap.size());
+
+    // Same ids on both sides, so stored handles like parents and children stay valid
+    for (const auto& [uuid, id] : from.m_EntityMap)
+        registry.create(id);
+    m_Context.m_EntityMap.insert(from.m_EntityMap.begin(), from.m_EntityMap.end());
+
+    m_Context.CopyComponents<SceneComponent>(from);
+    m_Context.CopyComponents<UUIDComponent>(from);
+
+    BClassRegistry::Get().ForEach([this, &from](BClass& cls)
+        {
+            if (cls.copyComponents)
+                cls.copyComponents(m_Context, from);
+        });
+
+    // Copied values still point into the source scene
+    for (auto [id, sceneComp] : registry.storage<SceneComponent>().each())
     {
-        GameObject src = GameObject(pair.second, &from);
-        GameObject dst = m_Context.Instantiate(pair.first, pair.second);
+        sceneComp.m_pScene = &m_Context;
+        registry.get<TransformComponent>(id).m_Owner = &sceneComp;
+    }
 
-        BClassRegistry::Get().ForEach([this, &src, &dst](BClass& cls)
-            {
-                if (src.HasComponentByClass(&cls))
-                {
-                    void* srcComp = src.GetComponentByClass(&cls);
-                    void* dstComp = dst.HasComponentByClass(&cls) 
-                        ? dst.GetComponentByClass(&cls) 
-                        : dst.AddComponentFromClass(&cls);
-                    cls.copyInstance(srcComp, dstComp);
-                }
-            });
-
-        dst.GetComponent<NameComponent>().Name = src.GetComponent<NameComponent>().Name;
-        dst.GetComponent<SceneComponent>().SetScene(&m_Context);
-        dst.GetTransform().m_Owner = &dst.GetComponent<SceneComponent>();
+    for (const auto& [uuid, id] : from.m_EntityMap)
+    {
+        GameObject instance{ id, &m_Context };
+        m_Context.m_OnGameObjectSpawned.Invoke(instance);
     }
+
+    const double milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    BOON_LOG("Copied scene '{}' with {} objects in {:.1f} ms", from.m_Name, from.m_EntityMap.size(), milliseconds);
 }
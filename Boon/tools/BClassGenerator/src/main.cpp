@@ -44,6 +44,7 @@ struct Property
             "Category", 
             "HideInInspector",
             "ColorPicker",
+            "Hex",
         };
         const auto& active = g_BoonMinimal ? minimalMeta : fullMeta;
         return active.find(meta) != active.end();
@@ -68,6 +69,14 @@ struct ReflectedFunction
     std::vector<ReflectedFunctionMeta> meta;
     std::vector<ReflectedFunctionParam> params;
 
+    bool IsRPC() const
+    {
+        for (const auto& m : meta)
+            if (m.key == "RPC")
+                return true;
+        return false;
+    }
+
     static bool ValidMeta(const std::string& meta)
     {
         static const std::unordered_set<std::string> minimalMeta{
@@ -209,6 +218,9 @@ static std::string inferBTypeId(const std::string& rawType) {
 
     static const std::unordered_map<std::string, std::string> lut = {
         {"int",         "BTypeId::Int"},
+        {"uint32_t",    "BTypeId::Uint"},
+        {"int64_t",     "BTypeId::Int64"},
+        {"uint64_t",    "BTypeId::Uint64"},
         {"glm::ivec2",  "BTypeId::Int2"},
         {"glm::ivec3",  "BTypeId::Int3"},
         {"glm::ivec4",  "BTypeId::Int4"},
@@ -397,6 +409,69 @@ static std::vector<ReflectedClass> parseSourceFiles(const std::vector<std::strin
     return classes;
 }
 
+// Emit typed RPC send stub + receive thunk for a single function.
+// Parameters are written/read through NetRPCArg<T> directly on the packet
+// serializer, bypassing the Variant boxing of the generic thunk.
+static void emitNetStubs(std::ofstream& out, const ReflectedClass& c, const ReflectedFunction& f, uint32_t id)
+{
+    const std::string writeName = c.name + "_" + f.name + "_NetWrite";
+    const std::string thunkName = c.name + "_" + f.name + "_NetThunk";
+
+    // Arguments arrive type erased; every one is checked against its declared
+    // type before anything is written, so a mismatch rejects the whole call
+    out << "        auto " << writeName << " = +[](BinarySerializer& ser, const NetRPCArgRef* args) -> bool {\n";
+    if (f.params.empty())
+        out << "            (void)ser; (void)args;\n";
+    for (size_t i = 0; i < f.params.size(); ++i)
+    {
+        const std::string valueType = "std::decay_t<" + f.params[i].type + ">";
+        out << "            if (!NetRPCArg<" << valueType << ">::Accepts(args[" << i << "])) return false;\n";
+    }
+    for (size_t i = 0; i < f.params.size(); ++i)
+    {
+        const std::string valueType = "std::decay_t<" + f.params[i].type + ">";
+        out << "            NetRPCArg<" << valueType << ">::WriteFrom(ser, args[" << i << "]);\n";
+    }
+    out << "            return true;\n";
+    out << "        };\n";
+
+    // Locals are named a0, a1, ... so a parameter called obj, ser or self
+    // cannot shadow the thunk's own names
+    out << "        auto " << thunkName << " = +[](void* obj, BinarySerializer& ser) -> bool {\n";
+    if (!f.params.empty())
+    {
+        out << "            if (!NetRPCArgsFit<";
+        for (size_t i = 0; i < f.params.size(); ++i)
+        {
+            out << "std::decay_t<" << f.params[i].type << ">";
+            if (i + 1 < f.params.size())
+                out << ", ";
+        }
+        out << ">(ser)) return false;\n";
+    }
+    out << "            " << c.nsQualifiedName << "* self = static_cast<" << c.nsQualifiedName << "*>(obj);\n";
+    if (f.params.empty())
+        out << "            (void)ser;\n";
+    for (size_t i = 0; i < f.params.size(); ++i)
+    {
+        const std::string valueType = "std::decay_t<" + f.params[i].type + ">";
+        out << "            " << valueType << " a" << i << " = NetRPCArg<" << valueType << ">::Read(ser);\n";
+    }
+    out << "            self->" << f.name << "(";
+    for (size_t i = 0; i < f.params.size(); ++i)
+    {
+        out << "std::move(a" << i << ")";
+        if (i + 1 < f.params.size())
+            out << ", ";
+    }
+    out << ");\n";
+    out << "            return true;\n";
+    out << "        };\n";
+
+    out << "        cls->SetNetStubs(0x" << std::hex << id << "u, " << std::dec
+        << writeName << ", " << thunkName << ");\n";
+}
+
 // Emit Generated_Components.cpp
 static void emitGeneratedFile(const std::string& output, const std::vector<ReflectedClass>& classes, const std::string& moduleName, bool verbose)
 {
@@ -409,7 +484,10 @@ static void emitGeneratedFile(const std::string& output, const std::vector<Refle
     out << "// Automatically generated. Do not modify.\n";
     out << "#include \"Reflection/RegisterBClass.h\"\n";
     out << "#include \"Reflection/BClass.h\"\n";
-    out << "#include \"Networking/NetRepRegistry.h\"\n\n";
+    out << "#include \"Networking/NetRepRegistry.h\"\n";
+    out << "#include \"Networking/NetRPCArgs.h\"\n";
+    out << "#include <type_traits>\n";
+    out << "#include <utility>\n\n";
 
     for (auto& c : classes)
     {
@@ -544,6 +622,9 @@ static void emitGeneratedFile(const std::string& output, const std::vector<Refle
                 out << "            {}\n";
 
             out << "        );\n";
+
+            if (f.IsRPC())
+                emitNetStubs(out, c, f, id);
         }
 
         for (auto& cm : c.classMeta)
@@ -5,6 +5,7 @@
 #include "Core/ServiceLocator.h"
 #include "Asset/AssetLibrary.h"
 #include "Assets/Importer/AssetImporterRegistry.h"
+#include "Assets/ThumbnailCache.h"
 
 #include <filesystem>
 #include <functional>
@@ -66,7 +67,12 @@ namespace BoonEditor
 		bool IsDirty() const { return m_Dirty; }
 		void ClearDirty() { m_Dirty = false; }
 
-		AssetRef<Texture2DAsset> GetThumbnail(AssetHandle handle) const;
+		/**
+		 * @brief Preview for the content browser, nullptr while a texture thumbnail is still being produced.
+		 */
+		std::shared_ptr<Texture2D> GetThumbnail(AssetHandle handle);
+
+		inline ThumbnailCache& GetThumbnailCache() { return m_Thumbnails; }
 
 		inline AssetLibrary& GetLibrary() { return *m_pAssetLib; }
 		inline const AssetLibrary& GetLibrary() const { return *m_pAssetLib; }
@@ -115,5 +121,6 @@ namespace BoonEditor
 		AssetLibrary* m_pAssetLib = nullptr;
 
 		mutable std::unordered_map<AssetType, AssetRef<Texture2DAsset>> m_DefaultTextures;
+		ThumbnailCache m_Thumbnails;
 	};
 }
\ No newline at end of file
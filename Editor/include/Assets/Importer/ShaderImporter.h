@@ -42,16 +42,18 @@ namespace Boon
 
             const std::string rawFragmentSource = content.substr(fragPos + 5);
 
-            ShaderPreprocessor preprocessor;
-
             ShaderAsset asset(meta.uuid);
-            asset.m_VertexSource = preprocessor.ResolveIncludes(rawVertexSource, sourcePath.parent_path());
+            asset.m_VertexSource = ShaderPreprocessor::ResolveIncludesCached(rawVertexSource, sourcePath.parent_path());
 
-            asset.m_FragmentSource = preprocessor.ResolveIncludes(rawFragmentSource, sourcePath.parent_path());
+            asset.m_FragmentSource = ShaderPreprocessor::ResolveIncludesCached(rawFragmentSource, sourcePath.parent_path());
 
             GLSLReflectionProvider reflectionProvider;
             asset.m_Reflection = reflectionProvider.Reflect(asset.m_VertexSource, asset.m_FragmentSource);
 
+            // Seed the cache so the first load of the imported asset skips reflection
+            asset.m_CacheKey = ShaderCache::ComputeKey(asset.m_VertexSource, asset.m_FragmentSource);
+            ShaderCache::StoreReflection(asset.m_CacheKey, asset.m_Reflection);
+
             Buffer payload = AssetSerializer<ShaderAsset>::Serialize(&asset);
             return BAssetFile::Write(exportPath, meta, payload);
         }
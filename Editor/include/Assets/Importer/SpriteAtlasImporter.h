@@ -1,15 +1,22 @@
 #pragma once
 
 #include "Assets/Importer/AssetImporter.h"
+#include "Assets/Importer/AssetImporterRegistry.h"
 #include "Asset/AssetLibrary.h"
 #include "Asset/Runtime/BAssetFile.h"
 #include "Asset/SpriteAtlasAsset.h"
 #include "Asset/TextureAsset.h"
+#include "BoonDebug/Logger.h"
 #include "Core/ServiceLocator.h"
+#include "Core/Threading/JobSystem.h"
+#include "Renderer/AtlasPacker.h"
 
+#include <algorithm>
 #include <fstream>
 #include <nlohmann/json.hpp>
+#include <stb_image.h>
 #include <unordered_map>
+#include <unordered_set>
 
 namespace Boon
 {
@@ -34,9 +41,16 @@ namespace Boon
 
             nlohmann::json j;
             file >> j;
+            file.close();
+
+            if (j.contains("pack"))
+            {
+                if (!PackImages(sourcePath, meta, j, *instance))
+                    return false;
+            }
 
             const std::string texPath = j.value("texture", std::string{});
-            if (!texPath.empty())
+            if (!texPath.empty() && !j.contains("pack"))
             {
                 AssetRef<Texture2DAsset> tex = assetLib.Load<Texture2DAsset>(texPath);
                 instance->SetTexture(tex);
@@ -44,7 +58,7 @@ namespace Boon
 
             std::unordered_map<int, int> oldToNew;
 
-            if (j.contains("sprites"))
+            if (j.contains("sprites") && !j.contains("pack"))
             {
                 const nlohmann::json& spritesJson = j["sprites"];
 
@@ -101,6 +115,7 @@ namespace Boon
         bool ExportToFile(const std::filesystem::path& filePath, Asset* asset) override
         {
             std::string texPath;
+            nlohmann::json pack;
 
             SpriteAtlas* atlas = nullptr;
             std::unique_ptr<SpriteAtlas> fallbackAtlas;
@@ -115,6 +130,9 @@ namespace Boon
                     nlohmann::json existing;
                     in >> existing;
                     texPath = existing.value("texture", std::string{});
+
+                    if (existing.contains("pack"))
+                        pack = existing["pack"];
                 }
             }
             else
@@ -124,23 +142,30 @@ namespace Boon
             }
 
             nlohmann::json j;
-            j["texture"] = texPath;
 
-            nlohmann::json spritesJson = nlohmann::json::object();
-            const std::vector<FrameEntry>& frames = atlas->GetFrameEntries();
-
-            for (const FrameEntry& entry : frames)
+            // Packed atlases regenerate their texture and frames from the image list on import
+            if (!pack.is_null())
+                j["pack"] = pack;
+            else
             {
-                nlohmann::json frameJson;
-                frameJson["x"] = entry.frame.UV.x;
-                frameJson["y"] = entry.frame.UV.y;
-                frameJson["w"] = entry.frame.Size.x;
-                frameJson["h"] = entry.frame.Size.y;
+                j["texture"] = texPath;
 
-                spritesJson[std::to_string(entry.stableId)] = frameJson;
-            }
+                nlohmann::json spritesJson = nlohmann::json::object();
+                const std::vector<FrameEntry>& frames = atlas->GetFrameEntries();
 
-            j["sprites"] = spritesJson;
+                for (const FrameEntry& entry : frames)
+                {
+                    nlohmann::json frameJson;
+                    frameJson["x"] = entry.frame.UV.x;
+                    frameJson["y"] = entry.frame.UV.y;
+                    frameJson["w"] = entry.frame.Size.x;
+                    frameJson["h"] = entry.frame.Size.y;
+
+                    spritesJson[std::to_string(entry.stableId)] = frameJson;
+                }
+
+                j["sprites"] = spritesJson;
+            }
 
             nlohmann::json clipsJson = nlohmann::json::array();
 
@@ -171,5 +196,282 @@ namespace Boon
         {
             return { ".bsa" };
         }
+
+        /**
+         * @brief Source texture handle to frame id for every image a packed atlas was built from.
+         *
+         * Empty when the atlas is sliced from a single texture.
+         */
+        static std::unordered_map<AssetHandle, int> LoadPackedFrameMap(
+            const AssetLibrary& assetLib,
+            const std::filesystem::path& atlasSourcePath)
+        {
+            std::unordered_map<AssetHandle, int> result;
+
+            std::ifstream file(atlasSourcePath);
+            if (!file)
+                return result;
+
+            nlohmann::json j;
+            file >> j;
+
+            if (!j.contains("pack"))
+                return result;
+
+            for (const PackedImage& image : ReadPackedImages(j["pack"]))
+            {
+                const AssetManifestEntry* entry = assetLib.GetManifest().GetByLogicalPath(image.Path);
+                if (entry && image.Id >= 0)
+                    result[entry->uuid] = image.Id;
+            }
+
+            return result;
+        }
+
+    private:
+        struct PackedImage
+        {
+            std::string Path;
+            int Id = -1;
+        };
+
+        struct DecodedImage
+        {
+            int Width = 0;
+            int Height = 0;
+            stbi_uc* Pixels = nullptr;
+        };
+
+        static std::vector<PackedImage> ReadPackedImages(const nlohmann::json& pack)
+        {
+            std::vector<PackedImage> images;
+            if (!pack.contains("images"))
+                return images;
+
+            for (const nlohmann::json& entry : pack["images"])
+            {
+                PackedImage image{};
+
+                if (entry.is_string())
+                    image.Path = entry.get<std::string>();
+                else
+                {
+                    image.Path = entry.value("path", std::string{});
+                    image.Id = entry.value("id", -1);
+                }
+
+                if (!image.Path.empty())
+                    images.push_back(image);
+            }
+
+            return images;
+        }
+
+        // Ids are kept once assigned, so frames referenced by clips and renderers survive a repack
+        static bool AssignStableIds(std::vector<PackedImage>& images)
+        {
+            std::unordered_set<int> used;
+            int nextId = 0;
+            bool changed = false;
+
+            for (PackedImage& image : images)
+            {
+                if (image.Id >= 0 && !used.insert(image.Id).second)
+                {
+                    image.Id = -1;
+                    changed = true;
+                }
+
+                nextId = std::max(nextId, image.Id + 1);
+            }
+
+            for (PackedImage& image : images)
+            {
+                if (image.Id >= 0)
+                    continue;
+
+                image.Id = nextId++;
+                changed = true;
+            }
+
+            return changed;
+        }
+
+        static std::filesystem::path GetSourceRoot(const std::filesystem::path& sourcePath, const AssetMeta& meta)
+        {
+            std::filesystem::path root = sourcePath;
+            for (auto it = meta.sourcePath.begin(); it != meta.sourcePath.end(); ++it)
+                root = root.parent_path();
+
+            return root;
+        }
+
+        // Uncompressed 32 bit TGA, bottom row first like the pixels stb hands the texture importer
+        static bool WriteTga(const std::filesystem::path& path, uint32_t width, uint32_t height, const Buffer& rgba)
+        {
+            std::ofstream out(path, std::ios::binary | std::ios::trunc);
+            if (!out)
+                return false;
+
+            uint8_t header[18]{};
+            header[2] = 2;
+            header[12] = static_cast<uint8_t>(width & 0xFF);
+            header[13] = static_cast<uint8_t>(width >> 8);
+            header[14] = static_cast<uint8_t>(height & 0xFF);
+            header[15] = static_cast<uint8_t>(height >> 8);
+            header[16] = 32;
+            header[17] = 8;
+            out.write(reinterpret_cast<const char*>(header), sizeof(header));
+
+            std::vector<uint8_t> bgra(rgba.Data(), rgba.Data() + rgba.Size());
+            for (size_t i = 0; i + 3 < bgra.size(); i += 4)
+                std::swap(bgra[i], bgra[i + 2]);
+
+            out.write(reinterpret_cast<const char*>(bgra.data()), static_cast<std::streamsize>(bgra.size()));
+            return static_cast<bool>(out);
+        }
+
+        static bool PackImages(
+            const std::filesystem::path& sourcePath,
+            const AssetMeta& meta,
+            nlohmann::json& j,
+            SpriteAtlas& atlas)
+        {
+            nlohmann::json& pack = j["pack"];
+
+            AtlasPackSettings settings{};
+            settings.MaxPageSize = pack.value("maxPageSize", settings.MaxPageSize);
+            settings.Padding = pack.value("padding", settings.Padding);
+            settings.Extrude = pack.value("extrude", settings.Extrude);
+            settings.AllowRotation = pack.value("allowRotation", settings.AllowRotation);
+
+            // SpriteFrame has no orientation, a rotated frame would render sideways
+            if (settings.AllowRotation)
+            {
+                BOON_LOG_WARN("Sprite atlas {}: rotation is not supported by sprite frames, packing unrotated", meta.sourcePath.generic_string());
+                settings.AllowRotation = false;
+            }
+
+            std::vector<PackedImage> images = ReadPackedImages(pack);
+            if (AssignStableIds(images))
+            {
+                nlohmann::json imagesJson = nlohmann::json::array();
+                for (const PackedImage& image : images)
+                    imagesJson.push_back({ { "path", image.Path }, { "id", image.Id } });
+
+                pack["images"] = imagesJson;
+
+                std::ofstream out(sourcePath, std::ios::trunc);
+                if (out)
+                    out << j.dump(4);
+            }
+
+            const std::filesystem::path sourceRoot = GetSourceRoot(sourcePath, meta);
+
+            std::vector<DecodedImage> decoded(images.size());
+            stbi_set_flip_vertically_on_load(1);
+
+            auto decodeRange = [&](size_t begin, size_t end)
+                {
+                    for (size_t i = begin; i < end; ++i)
+                    {
+                        int channels = 0;
+                        const std::string path = (sourceRoot / images[i].Path).string();
+                        decoded[i].Pixels = stbi_load(path.c_str(), &decoded[i].Width, &decoded[i].Height, &channels, 4);
+                    }
+                };
+
+            if (JobSystem* jobs = JobSystem::Get())
+                jobs->ParallelFor(images.size(), 1, decodeRange);
+            else
+                decodeRange(0, images.size());
+
+            std::vector<AtlasPackInput> inputs(images.size());
+            for (size_t i = 0; i < images.size(); ++i)
+            {
+                if (!decoded[i].Pixels)
+                {
+                    BOON_LOG_ERROR("Sprite atlas {}: could not load {}", meta.sourcePath.generic_string(), images[i].Path);
+                    continue;
+                }
+
+                inputs[i] = { static_cast<uint32_t>(decoded[i].Width), static_cast<uint32_t>(decoded[i].Height) };
+            }
+
+            const AtlasPackResult result = AtlasPacker::Pack(inputs, settings);
+
+            bool packed = !result.Pages.empty();
+            if (packed)
+            {
+                const AtlasPage& page = result.Pages[0];
+
+                Buffer pixels(static_cast<size_t>(page.Width) * page.Height * 4);
+
+                auto blitRange = [&](size_t begin, size_t end)
+                    {
+                        for (size_t i = begin; i < end; ++i)
+                        {
+                            const AtlasPackedRect& rect = result.Rects[i];
+                            if (rect.Page == 0)
+                                AtlasPacker::Blit(pixels.Data(), page.Width, page.Height, decoded[i].Pixels, rect, settings.Extrude);
+                        }
+                    };
+
+                if (JobSystem* jobs = JobSystem::Get())
+                    jobs->ParallelFor(images.size(), 16, blitRange);
+                else
+                    blitRange(0, images.size());
+
+                const std::filesystem::path pageLogical =
+                    meta.sourcePath.parent_path() / (meta.sourcePath.stem().string() + "_atlas.tga");
+
+                packed = WriteTga(sourceRoot / pageLogical, page.Width, page.Height, pixels);
+                if (packed)
+                {
+                    const AssetMeta pageMeta = ServiceLocator::Get<AssetImporterRegistry>().Import(pageLogical);
+                    packed = pageMeta.IsValid();
+
+                    if (packed)
+                        atlas.SetTexture(AssetRef<Texture2DAsset>(pageMeta.uuid));
+                }
+
+                for (size_t i = 0; i < images.size() && packed; ++i)
+                {
+                    const AtlasPackedRect& rect = result.Rects[i];
+                    if (rect.Page != 0)
+                        continue;
+
+                    SpriteFrame frame{};
+                    frame.UV = { static_cast<float>(rect.X) / page.Width, static_cast<float>(rect.Y) / page.Height };
+                    frame.Size = { static_cast<float>(rect.Width) / page.Width, static_cast<float>(rect.Height) / page.Height };
+                    atlas.AddSpriteFrameWithId(images[i].Id, frame);
+                }
+
+                BOON_LOG("Sprite atlas {}: packed {} images into {}x{} at {:.1f}% efficiency in {:.2f} ms",
+                    meta.sourcePath.generic_string(), atlas.GetFrameCount(), page.Width, page.Height,
+                    page.UsedArea * 100.0 / (static_cast<double>(page.Width) * page.Height), result.Milliseconds);
+
+                if (result.Pages.size() > 1)
+                {
+                    const size_t overflow = std::count_if(result.Rects.begin(), result.Rects.end(),
+                        [](const AtlasPackedRect& rect) { return rect.Page > 0; });
+
+                    // The atlas binds a single texture, further pages have nowhere to go
+                    BOON_LOG_ERROR("Sprite atlas {}: {} images did not fit on one page, raise maxPageSize or split the atlas",
+                        meta.sourcePath.generic_string(), overflow);
+                }
+            }
+
+            for (size_t index : result.Rejected)
+            {
+                if (decoded[index].Pixels)
+                    BOON_LOG_ERROR("Sprite atlas {}: {} does not fit a {} page", meta.sourcePath.generic_string(), images[index].Path, settings.MaxPageSize);
+            }
+
+            for (DecodedImage& image : decoded)
+                stbi_image_free(image.Pixels);
+
+            return packed || images.empty();
+        }
     };
 }
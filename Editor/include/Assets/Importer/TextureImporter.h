@@ -54,7 +54,7 @@ namespace Boon
 
         std::vector<std::string> GetExtensions() const override
         {
-            return { ".png", ".jpg", ".jpeg" };
+            return { ".png", ".jpg", ".jpeg", ".tga" };
         }
     };
 }
@@ -0,0 +1,30 @@
+#pragma once
+#include "Asset/Asset.h"
+
+#include <cstddef>
+#include <unordered_map>
+
+namespace Boon
+{
+    class Scene;
+}
+
+using namespace Boon;
+
+namespace BoonEditor
+{
+    /**
+     * @brief Point texture renderers at the atlas frames their textures were packed into.
+     *
+     * Every TextureRendererComponent whose texture appears in textureToFrame is
+     * replaced by a SpriteRendererComponent drawing that frame of the atlas,
+     * keeping its color, tiling and material override, so the objects batch on
+     * the atlas page instead of binding one texture each.
+     *
+     * @return Number of game objects remapped.
+     */
+    size_t RemapTextureRenderers(
+        Scene& scene,
+        AssetHandle atlas,
+        const std::unordered_map<AssetHandle, int>& textureToFrame);
+}
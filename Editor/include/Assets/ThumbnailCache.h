@@ -0,0 +1,137 @@
+#pragma once
+#include "Asset/Asset.h"
+#include "Core/Memory/Buffer.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace Boon
+{
+    class Texture2D;
+}
+
+using namespace Boon;
+
+namespace BoonEditor
+{
+    struct ThumbnailCacheStats
+    {
+        size_t Resident = 0;
+        size_t ResidentBytes = 0;
+        size_t Pending = 0;
+        uint64_t DiskHits = 0;
+        uint64_t Generated = 0;
+    };
+
+    /**
+     * @brief Small previews of texture assets for the content browser.
+     *
+     * A thumbnail is produced on the JobSystem: the source image is decoded,
+     * halved with a box filter down to the thumbnail size, and written to the
+     * cache directory under the asset id and a hash of the source file's size
+     * and write time, so later sessions read the small file instead. Only the
+     * finished pixels are uploaded, on the UI thread, by the next Request or
+     * Trim after they are ready, whether or not the item is still visible.
+     *
+     * Uploaded thumbnails are kept in least recently used order and dropped
+     * once they exceed the memory budget; they come back from disk. Every
+     * SourceCheckFrames frames a requested thumbnail compares its source's
+     * size and write time again and is rebuilt when the file changed; the
+     * cache file of the old version is deleted then, and all of an asset's
+     * files when it is invalidated.
+     */
+    class ThumbnailCache final
+    {
+    public:
+        static constexpr uint32_t ThumbnailSize = 128;
+        static constexpr size_t DefaultBudgetBytes = 32ull * 1024 * 1024;
+        static constexpr size_t MaxInFlight = 8;
+        static constexpr uint64_t SourceCheckFrames = 60;
+
+        ThumbnailCache() = default;
+        ~ThumbnailCache();
+
+        ThumbnailCache(const ThumbnailCache&) = delete;
+        ThumbnailCache& operator=(const ThumbnailCache&) = delete;
+
+        /**
+         * @brief Directory thumbnails are persisted in. Without one they are kept in memory only.
+         */
+        void SetDirectory(const std::filesystem::path& directory);
+        void SetBudget(size_t bytes) { m_BudgetBytes = bytes; }
+
+        /**
+         * @brief Thumbnail of a texture source image, or nullptr while it is being produced.
+         *
+         * Call for visible items only; the first call starts the work.
+         */
+        std::shared_ptr<Texture2D> Request(AssetHandle handle, const std::filesystem::path& sourcePath);
+
+        /**
+         * @brief Upload finished thumbnails and drop those over the memory budget. Call once per frame.
+         */
+        void Trim();
+
+        void Invalidate(AssetHandle handle);
+        void Clear();
+
+        ThumbnailCacheStats GetStats() const;
+
+        /**
+         * @brief Shrink RGBA8 pixels to fit within maxSize, halving with a box filter.
+         */
+        static void Downscale(const uint8_t* pixels, uint32_t width, uint32_t height, uint32_t maxSize,
+            Buffer& outPixels, uint32_t& outWidth, uint32_t& outHeight);
+
+    private:
+        struct Job
+        {
+            std::atomic<bool> Done{ false };
+            bool Failed = false;
+            bool FromDisk = false;
+            Buffer Pixels;
+            uint32_t Width = 0;
+            uint32_t Height = 0;
+        };
+
+        struct Entry
+        {
+            uint64_t SourceHash = 0;
+            std::shared_ptr<Job> Pending;
+            std::shared_ptr<Texture2D> Texture;
+            size_t Bytes = 0;
+            bool Failed = false;
+            uint64_t CheckedFrame = 0;
+            std::list<AssetHandle>::iterator Recent;
+        };
+
+        static void Produce(Job& job, AssetHandle handle, const std::filesystem::path& sourcePath, const std::filesystem::path& cachePath);
+        static uint64_t HashSource(const std::filesystem::path& sourcePath);
+
+        std::filesystem::path GetCachePath(AssetHandle handle, uint64_t sourceHash) const;
+        void Retire(AssetHandle handle, Entry& entry);
+        void Touch(Entry& entry);
+        void Release(Entry& entry);
+
+    private:
+        std::filesystem::path m_Directory;
+        size_t m_BudgetBytes = DefaultBudgetBytes;
+
+        std::unordered_map<AssetHandle, Entry> m_Entries;
+        std::list<AssetHandle> m_Recent;
+        size_t m_ResidentBytes = 0;
+        size_t m_InFlight = 0;
+        std::vector<AssetHandle> m_PendingHandles;
+        uint64_t m_Frame = 0;
+
+        uint64_t m_DiskHits = 0;
+        uint64_t m_Generated = 0;
+    };
+}
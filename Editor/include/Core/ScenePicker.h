@@ -0,0 +1,90 @@
+#pragma once
+#include <Scene/GameObjectID.h>
+
+#include <glm/glm.hpp>
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace Boon
+{
+    class Scene;
+}
+
+using namespace Boon;
+
+namespace BoonEditor
+{
+    /**
+     * @brief Picks sprites on the CPU against their cached world bounds.
+     *
+     * Every sprite and texture quad is kept with its world matrix and bounding
+     * box in a uniform grid. Refresh walks the renderers once and only moves
+     * the entries whose transform changed, so a point pick touches one cell
+     * and a box select only the cells it covers. Needs neither a framebuffer
+     * nor a GPU round trip, which makes it usable headless and for selecting
+     * large numbers of objects at once.
+     */
+    class ScenePicker final
+    {
+    public:
+        static constexpr float DefaultCellSize = 4.0f;
+
+        // Entries spanning more cells than this live in a list that is always searched
+        static constexpr int MaxCellsPerEntry = 64;
+
+        explicit ScenePicker(float cellSize = DefaultCellSize);
+
+        /**
+         * @brief Bring the cached bounds in line with the scene's sprites.
+         */
+        void Refresh(Scene& scene);
+
+        void Clear();
+
+        /**
+         * @brief Topmost quad under a world position, by world z.
+         *
+         * @return True if something was hit.
+         */
+        bool Pick(const glm::vec2& worldPoint, GameObjectID& outObject) const;
+
+        /**
+         * @brief Every quad whose bounds overlap the world space box, appended topmost first.
+         */
+        void BoxSelect(const glm::vec2& min, const glm::vec2& max, std::vector<GameObjectID>& outObjects) const;
+
+        inline size_t GetCount() const { return m_Entries.size(); }
+
+    private:
+        struct Entry
+        {
+            glm::mat4 World{ 0.0f };
+            glm::vec2 Min{};
+            glm::vec2 Max{};
+            float Depth = 0.0f;
+            glm::ivec2 CellMin{};
+            glm::ivec2 CellMax{};
+            uint32_t Stamp = 0;
+            bool Linked = false;
+            bool Large = false;
+        };
+
+        void Update(GameObjectID object, const glm::mat4& world);
+        void Link(GameObjectID object, Entry& entry);
+        void Unlink(GameObjectID object, Entry& entry);
+
+        glm::ivec2 ToCell(const glm::vec2& point) const;
+        static uint64_t CellKey(int x, int y);
+        static bool Contains(const Entry& entry, const glm::vec2& point);
+
+    private:
+        float m_CellSize;
+        uint32_t m_Stamp = 0;
+
+        std::unordered_map<GameObjectID, Entry> m_Entries;
+        std::unordered_map<uint64_t, std::vector<GameObjectID>> m_Cells;
+        std::vector<GameObjectID> m_Large;
+    };
+}
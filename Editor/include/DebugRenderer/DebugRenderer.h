@@ -1,37 +1,69 @@
 #pragma once
 #include "DebugRenderer/EditorViewportSettings.h"
 
-#include <memory>
+#include <BoonDebug/DebugRenderer.h>
+#include <Scene/GameObjectID.h>
+
+#include <glm/glm.hpp>
+
+#include <cstdint>
+#include <unordered_map>
 
 namespace Boon
 {
-	class Framebuffer;
 	class Scene;
-	class Renderer2D;
-	class Camera;
-	class TransformComponent;
+	class SceneRenderer;
+	struct RenderContext;
 }
 
 using namespace Boon;
 
 namespace BoonEditor
 {
+	/**
+	 * @brief Editor overlays drawn by the viewport's own SceneRenderer.
+	 *
+	 * Registers a pass in the debug phase, so the lines go through the scene's
+	 * Renderer2D line batch instead of a renderer of their own. Colliders are
+	 * recorded every frame; tilemap chunk outlines are kept and only rebuilt
+	 * when the map or its transform changes.
+	 */
 	class DebugRenderer final
 	{
 	public:
-		DebugRenderer(Scene* pScene, Framebuffer* pFramebuffer);
+		DebugRenderer(Scene* pScene, SceneRenderer* pSceneRenderer);
 		~DebugRenderer();
 
-		void Render(EditorViewportSettings settings, Camera* camera = nullptr, TransformComponent* cameraTransform = nullptr);
+		/**
+		 * @brief Record the overlays for the next render of the scene. Call before SceneRenderer::Render.
+		 */
+		void Prepare(const EditorViewportSettings& settings);
+
+		/**
+		 * @brief Submit the recorded overlays, called by the debug pass.
+		 */
+		void Draw(RenderContext& context);
 
-		inline void SetContext(Scene* pScene) { m_pScene = pScene; }
+		void SetContext(Scene* pScene);
 
 	private:
-		void Begin();
-		void End();
+		struct TilemapOverlay
+		{
+			uint64_t Revision = 0;
+			float UnitSize = 0.0f;
+			glm::mat4 World{ 0.0f };
+			DebugDrawList Lines;
+			uint32_t Stamp = 0;
+		};
+
+		void RecordColliders();
+		void RecordTilemaps();
 
 		Scene* m_pScene;
-		Framebuffer* m_pFramebuffer;
-		std::unique_ptr<Renderer2D> m_pRenderer2D;
+		EditorViewportSettings m_Settings{};
+
+		DebugDrawList m_FrameLines;
+		std::unordered_map<GameObjectID, TilemapOverlay> m_TilemapOverlays;
+		uint32_t m_Stamp = 0;
 	};
-}
\ No newline at end of file
+}
@@ -6,5 +6,8 @@ namespace BoonEditor
 	struct EditorViewportSettings
 	{
 		DebugRenderLayer DebugRenderLayers{ DebugRenderLayer::All };
+
+		// Pick against cached sprite bounds instead of reading back the id buffer
+		bool CpuPicking{ false };
 	};
 }
\ No newline at end of file
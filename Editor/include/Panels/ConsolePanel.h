@@ -1,8 +1,12 @@
 #pragma once
 #include "Panels/EditorPanel.h"
 
+#include <cstdint>
+#include <deque>
+#include <memory>
 #include <mutex>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace BoonEditor
@@ -10,12 +14,36 @@ namespace BoonEditor
 	struct ConsoleMessage
 	{
 		std::string Text;
+
+		// Lowercase copy of Text, searched by the filter
+		std::string SearchText;
+
+		// Offset of every line in Text, split once when the message arrives
+		std::vector<uint32_t> LineStarts;
+
 		int Level = 0;
+		uint64_t Sequence = 0;
+	};
+
+	struct ConsoleLine
+	{
+		uint64_t Message = 0;
+		uint32_t Line = 0;
 	};
 
+	/**
+	 * @brief Log console backed by a ring of the most recent messages.
+	 *
+	 * Messages may be added from any thread; they are queued and moved into
+	 * the ring by the UI thread. Lines passing the level and text filter are
+	 * kept in an index that grows as messages arrive and shrinks as the ring
+	 * wraps, so a frame only draws the rows that are on screen.
+	 */
 	class ConsolePanel final : public EditorPanel
 	{
 	public:
+		static constexpr size_t MaxMessages = 8192;
+
 		ConsolePanel(EditorContext* pContext, const std::string& name);
 		virtual ~ConsolePanel();
 
@@ -26,12 +54,44 @@ namespace BoonEditor
 		virtual void OnRenderUI() override;
 
 	private:
+		void DrainPending();
+		void EvictOldest();
+
+		const ConsoleMessage& MessageAt(uint64_t sequence) const;
+		std::string_view GetLineText(const ConsoleMessage& message, uint32_t line, bool search = false) const;
+		bool Matches(const ConsoleMessage& message, uint32_t line) const;
 
-		std::vector<ConsoleMessage> m_Messages;
+		void SetFilter(const std::string& filter, uint32_t levelMask);
+		void RebuildVisibleLines();
+		void ClearSelection();
+
+		std::string CopyLines(int first, int last) const;
+
+	private:
 		std::mutex m_Mutex;
+		std::deque<ConsoleMessage> m_Pending;
+
+		// Everything below is only touched by the UI thread
+		std::vector<ConsoleMessage> m_Ring;
+		uint64_t m_FirstSequence{ 0 };
+		uint64_t m_NextSequence{ 0 };
+
+		std::deque<ConsoleLine> m_VisibleLines;
+		size_t m_LevelCounts[3]{};
+		float m_MaxLineWidth{ 0.0f };
+
+		std::string m_Filter;
+		char m_FilterInput[256]{};
+		uint32_t m_LevelMask{ 0b111 };
+
+		bool m_HasSelection{ false };
+		bool m_IsDraggingSelection{ false };
+		int m_SelectionStart{ -1 };
+		int m_SelectionEnd{ -1 };
+
 		bool m_AutoScroll{ true };
 		bool m_ScrollToBottom{ false };
 
 		std::shared_ptr<class EditorLogSink> m_pSink;
 	};
-}
\ No newline at end of file
+}
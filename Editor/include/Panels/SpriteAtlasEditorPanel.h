@@ -61,6 +61,8 @@ namespace BoonEditor
         static glm::vec2 SizeToPixel(const SpriteFrame& frame, const glm::vec2& textureSize);
         static SpriteFrame PixelToFrame(const glm::vec2& pixelPos, const glm::vec2& pixelSize, const glm::vec2& textureSize);
 
+        void RemapSceneTextureRenderers();
+
         void RestartPreview();
         void UpdateAnimationPreview(SpriteAtlas& atlas);
     private:
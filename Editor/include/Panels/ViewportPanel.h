@@ -6,17 +6,20 @@
 #include "Panels/IViewportCanvasRenderer.h"
 
 #include "Core/EditorCamera.h"
+#include "Core/ScenePicker.h"
 
 #include "DebugRenderer/EditorViewportSettings.h"
 
 #include <Scene/GameObject.h>
 
 #include <memory>
+#include <vector>
 
 #include <glm/glm.hpp>
 
 namespace Boon
 {
+    class Input;
     class Scene;
     class SceneRenderer;
 }
@@ -57,6 +60,25 @@ namespace BoonEditor
 
         inline SceneRenderer* GetRenderer() const { return m_pRenderer.get(); }
 
+        inline const GameObject& GetHoveredGameObject() const { return m_HoveredGameObject; }
+
+        /**
+         * @brief World position on the z = 0 plane under a viewport position, origin bottom left.
+         */
+        glm::vec2 ViewportToWorld(const glm::vec2& viewportPosition);
+
+        /**
+         * @brief Objects whose sprite bounds overlap a rectangle given in viewport positions, topmost first.
+         */
+        void BoxSelect(const glm::vec2& from, const glm::vec2& to, std::vector<GameObjectID>& outObjects);
+
+        /**
+         * @brief Objects inside the last rectangle dragged with the left mouse button, topmost first.
+         *
+         * The selection holds a single object, so only the first one is selected.
+         */
+        inline const std::vector<GameObjectID>& GetBoxSelection() const { return m_BoxSelection; }
+
     protected:
         virtual void OnRenderUI() override;
 
@@ -66,6 +88,12 @@ namespace BoonEditor
 
         ViewportCanvasContext CreateCanvasContext() const;
 
+        void UpdateHovered(int mouseX, int mouseY);
+        void SetHovered(int pixelData);
+
+        void UpdateBoxSelection(Input& input, bool mouseInsideViewport);
+        void DrawBoxSelection() const;
+
     private:
         std::unique_ptr<SceneRenderer> m_pRenderer;
         EditorCamera m_Camera;
@@ -79,6 +107,15 @@ namespace BoonEditor
         glm::vec2 m_ViewportImagePosition{};
 
         GameObject m_HoveredGameObject{};
+        ScenePicker m_Picker{};
+
+        // Pixels the mouse has to travel before a left drag becomes a box selection
+        static constexpr float BoxSelectThreshold = 4.0f;
+
+        glm::vec2 m_BoxSelectStart{};
+        bool m_BoxSelectArmed = false;
+        bool m_BoxSelecting = false;
+        std::vector<GameObjectID> m_BoxSelection;
 
         SceneContext* m_pSceneContext = nullptr;
         GameObjectContext* m_pSelectionContext = nullptr;
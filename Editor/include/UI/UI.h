@@ -84,9 +84,11 @@ namespace BoonEditor
 
             case BTypeId::Int:
             case BTypeId::Uint:
+                result = IntProperty(property, pInstance);
+                break;
             case BTypeId::Int64:
             case BTypeId::Uint64:
-                result = IntProperty(property, pInstance);
+                result = Int64Property(property, pInstance);
                 break;
             case BTypeId::Int2:
                 result = Int2Property(property, pInstance);
@@ -289,6 +291,18 @@ namespace BoonEditor
             return result;
         }
 
+        static PropertyResult Int64Property(const BProperty& property, void* pInstance)
+        {
+            std::string name = property.HasMeta("Name") ? property.GetMeta("Name").value() : property.name;
+            uint8_t* base = reinterpret_cast<uint8_t*>(pInstance);
+
+            if (property.typeId == BTypeId::Int64)
+                return InputInt64(name, *reinterpret_cast<int64_t*>(base + property.offset));
+
+            // Bit masks read better in hex
+            return InputUint64(name, *reinterpret_cast<uint64_t*>(base + property.offset), property.HasMeta("Hex"));
+        }
+
         static PropertyResult Int2Property(const BProperty& property, void* pInstance)
         {
             std::string name = property.HasMeta("Name") ? property.GetMeta("Name").value() : property.name;
@@ -617,6 +631,22 @@ namespace BoonEditor
             return EndProperty(label, result);
         }
 
+        static PropertyResult InputInt64(const std::string& label, int64_t& value)
+        {
+            BeginProperty(label, value);
+            bool result = ImGui::InputScalar("##val", ImGuiDataType_S64, &value);
+            return EndProperty(label, result);
+        }
+
+        static PropertyResult InputUint64(const std::string& label, uint64_t& value, bool hex = false)
+        {
+            BeginProperty(label, value);
+            bool result = hex
+                ? ImGui::InputScalar("##val", ImGuiDataType_U64, &value, nullptr, nullptr, "%016llX", ImGuiInputTextFlags_CharsHexadecimal)
+                : ImGui::InputScalar("##val", ImGuiDataType_U64, &value);
+            return EndProperty(label, result);
+        }
+
         static PropertyResult InputDigits(const std::string& label, int& value, int digits)
         {
             bool changed = false;
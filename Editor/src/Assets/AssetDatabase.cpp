@@ -125,6 +125,7 @@ namespace BoonEditor
             return;
 
         const Path storedPath = it->second;
+        m_Thumbnails.Invalidate(asset);
 
         const std::filesystem::path logicalPath = storedPath.Path.lexically_normal();
         const std::filesystem::path sourcePath = storedPath.SourcePath().lexically_normal();
@@ -791,6 +792,7 @@ namespace BoonEditor
     {
         m_HandleToPath.clear();
         m_PathToHandle.clear();
+        m_Thumbnails.Clear();
     }
 
     void AssetDatabase::ForEachEntry(const std::function<void(AssetHandle, const std::string&)>& fn)
@@ -801,30 +803,30 @@ namespace BoonEditor
         }
     }
 
-    AssetRef<Texture2DAsset> AssetDatabase::GetThumbnail(AssetHandle handle) const
+    std::shared_ptr<Texture2D> AssetDatabase::GetThumbnail(AssetHandle handle)
     {
         const AssetMeta* meta = m_pAssetLib->GetMeta(handle);
         if (!meta)
-            return AssetRef<Texture2DAsset>();
+            return nullptr;
 
         if (meta->type == AssetType::Texture)
         {
-            const std::filesystem::path& sourcePath = GetPath(handle);
-            if (!sourcePath.empty())
-                return m_pAssetLib->Load<Texture2DAsset>(sourcePath);
+            auto it = m_HandleToPath.find(handle);
+            if (it == m_HandleToPath.end())
+                return nullptr;
 
-            return AssetRef<Texture2DAsset>();
+            return m_Thumbnails.Request(handle, it->second.SourcePath());
         }
 
-        auto loadDefault = [this](AssetType type, const std::string& path) -> AssetRef<Texture2DAsset>
+        auto loadDefault = [this](AssetType type, const std::string& path) -> std::shared_ptr<Texture2D>
             {
                 auto it = m_DefaultTextures.find(type);
                 if (it != m_DefaultTextures.end() && it->second.IsValid())
-                    return it->second;
+                    return it->second->GetInstance();
 
                 AssetRef<Texture2DAsset> ref = m_pAssetLib->Load<Texture2DAsset>(path);
                 m_DefaultTextures[type] = ref;
-                return ref;
+                return ref.IsValid() ? ref->GetInstance() : nullptr;
             };
 
         switch (meta->type)
@@ -838,7 +840,7 @@ namespace BoonEditor
         case AssetType::Scene:
             return loadDefault(AssetType::Scene, "Icons/Assets/scene_icon.png");
         default:
-            return AssetRef<Texture2DAsset>();
+            return nullptr;
         }
     }
 
@@ -0,0 +1,52 @@
+#include "Assets/SpriteAtlasRemap.h"
+
+#include <Component/SpriteRendererComponent.h>
+#include <Component/TextureRendererComponent.h>
+#include <Scene/GameObject.h>
+#include <Scene/Scene.h>
+
+#include <vector>
+
+namespace BoonEditor
+{
+    size_t RemapTextureRenderers(
+        Scene& scene,
+        AssetHandle atlas,
+        const std::unordered_map<AssetHandle, int>& textureToFrame)
+    {
+        if (!atlas.IsValid() || textureToFrame.empty())
+            return 0;
+
+        // Collect first, components are added and removed below
+        std::vector<GameObjectID> targets;
+        auto view = scene.GetAllGameObjectsWith<TextureRendererComponent>();
+        for (GameObjectID id : view)
+        {
+            const TextureRendererComponent& texture = view.get<TextureRendererComponent>(id);
+            if (textureToFrame.contains(texture.Texture.Handle()))
+                targets.push_back(id);
+        }
+
+        size_t remapped = 0;
+        for (GameObjectID id : targets)
+        {
+            GameObject gameObject{ id, &scene };
+            if (gameObject.HasComponent<SpriteRendererComponent>())
+                continue;
+
+            const TextureRendererComponent texture = gameObject.GetComponent<TextureRendererComponent>();
+
+            SpriteRendererComponent& sprite = gameObject.AddComponent<SpriteRendererComponent>();
+            sprite.SpriteAtlasHandle = AssetRef<SpriteAtlasAsset>(atlas);
+            sprite.Sprite = textureToFrame.at(texture.Texture.Handle());
+            sprite.Color = texture.Color;
+            sprite.Tiling = texture.Tiling;
+            sprite.MaterialOverride = texture.MaterialOverride;
+
+            gameObject.RemoveComponent<TextureRendererComponent>();
+            ++remapped;
+        }
+
+        return remapped;
+    }
+}
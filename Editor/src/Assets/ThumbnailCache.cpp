@@ -0,0 +1,394 @@
+#include "Assets/ThumbnailCache.h"
+
+#include <Core/Hash.h>
+#include <Core/Memory/Compression.h>
+#include <Core/Threading/JobSystem.h>
+#include <Renderer/Texture.h>
+
+#include <stb_image.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <system_error>
+#include <vector>
+
+namespace BoonEditor
+{
+    namespace
+    {
+        constexpr uint32_t ThumbnailMagic = 0x4D485442; // 'BTHM'
+        constexpr uint32_t ThumbnailVersion = 1;
+
+        struct ThumbnailHeader
+        {
+            uint32_t Magic;
+            uint32_t Version;
+            uint32_t Width;
+            uint32_t Height;
+        };
+
+        bool ReadThumbnail(const std::filesystem::path& path, Buffer& outPixels, uint32_t& outWidth, uint32_t& outHeight)
+        {
+            std::ifstream in(path, std::ios::binary);
+            if (!in)
+                return false;
+
+            ThumbnailHeader header{};
+            if (!in.read(reinterpret_cast<char*>(&header), sizeof(header)))
+                return false;
+
+            if (header.Magic != ThumbnailMagic || header.Version != ThumbnailVersion ||
+                header.Width == 0 || header.Height == 0 ||
+                header.Width > ThumbnailCache::ThumbnailSize || header.Height > ThumbnailCache::ThumbnailSize)
+                return false;
+
+            std::vector<uint8_t> compressed((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+
+            outPixels.Resize(static_cast<size_t>(header.Width) * header.Height * 4);
+            if (!Compression::Decompress(compressed.data(), compressed.size(), outPixels.Data(), outPixels.Size()))
+                return false;
+
+            outWidth = header.Width;
+            outHeight = header.Height;
+            return true;
+        }
+
+        void WriteThumbnail(const std::filesystem::path& path, const Buffer& pixels, uint32_t width, uint32_t height)
+        {
+            std::error_code ec;
+            std::filesystem::create_directories(path.parent_path(), ec);
+
+            const ThumbnailHeader header{ ThumbnailMagic, ThumbnailVersion, width, height };
+
+            Buffer out;
+            out.Write(header);
+            Compression::Compress(pixels.Data(), pixels.Size(), out);
+
+            // Written aside and moved into place, so a reader never sees half a file
+            std::filesystem::path temp = path;
+            temp += ".tmp";
+
+            {
+                std::ofstream file(temp, std::ios::binary | std::ios::trunc);
+                if (!file.write(reinterpret_cast<const char*>(out.Data()), static_cast<std::streamsize>(out.Size())))
+                    return;
+            }
+
+            std::filesystem::rename(temp, path, ec);
+            if (ec)
+                std::filesystem::remove(temp, ec);
+        }
+
+        // Files are named <handle>_<source hash>.thumb; drops every one of handle except keep
+        void RemoveThumbnails(const std::filesystem::path& directory, AssetHandle handle, const std::filesystem::path& keep = {})
+        {
+            if (directory.empty())
+                return;
+
+            const std::string prefix = std::to_string(static_cast<uint64_t>(handle)) + "_";
+
+            std::error_code ec;
+            for (std::filesystem::directory_iterator it(directory, ec), end; !ec && it != end; it.increment(ec))
+            {
+                const std::filesystem::path& path = it->path();
+                if (path.extension() != ".thumb" || !path.filename().string().starts_with(prefix) || path == keep)
+                    continue;
+
+                std::error_code removeError;
+                std::filesystem::remove(path, removeError);
+            }
+        }
+    }
+
+    ThumbnailCache::~ThumbnailCache()
+    {
+        // Jobs still running own their state and simply finish into nothing
+        Clear();
+    }
+
+    void ThumbnailCache::SetDirectory(const std::filesystem::path& directory)
+    {
+        m_Directory = directory;
+    }
+
+    std::shared_ptr<Texture2D> ThumbnailCache::Request(AssetHandle handle, const std::filesystem::path& sourcePath)
+    {
+        Entry& entry = m_Entries[handle];
+
+        // Textures and failures are only as good as the file they came from
+        if ((entry.Texture || entry.Failed) && m_Frame - entry.CheckedFrame >= SourceCheckFrames)
+        {
+            entry.CheckedFrame = m_Frame;
+            if (HashSource(sourcePath) != entry.SourceHash)
+            {
+                Release(entry);
+                entry.Failed = false;
+            }
+        }
+
+        if (entry.Texture)
+        {
+            Touch(entry);
+            return entry.Texture;
+        }
+
+        if (entry.Failed)
+            return nullptr;
+
+        if (entry.Pending)
+        {
+            if (!entry.Pending->Done.load(std::memory_order_acquire))
+                return nullptr;
+
+            Retire(handle, entry);
+            return entry.Texture;
+        }
+
+        // Visible items are requested every frame, the ones not started yet get their turn later
+        if (m_InFlight >= MaxInFlight)
+            return nullptr;
+
+        entry.SourceHash = HashSource(sourcePath);
+        entry.CheckedFrame = m_Frame;
+
+        auto job = std::make_shared<Job>();
+        entry.Pending = job;
+        ++m_InFlight;
+        m_PendingHandles.push_back(handle);
+
+        auto work = [job, handle, sourcePath, cachePath = GetCachePath(handle, entry.SourceHash)]()
+            {
+                Produce(*job, handle, sourcePath, cachePath);
+                job->Done.store(true, std::memory_order_release);
+            };
+
+        if (JobSystem* jobs = JobSystem::Get())
+            jobs->Schedule(std::move(work));
+        else
+            work();
+
+        return nullptr;
+    }
+
+    void ThumbnailCache::Trim()
+    {
+        ++m_Frame;
+
+        // Items scrolled out of view are not requested again, their jobs are finished here
+        for (size_t i = m_PendingHandles.size(); i-- > 0;)
+        {
+            const AssetHandle handle = m_PendingHandles[i];
+
+            Entry& entry = m_Entries[handle];
+            if (entry.Pending && entry.Pending->Done.load(std::memory_order_acquire))
+                Retire(handle, entry);
+        }
+
+        // Least recently drawn first; whatever was drawn this frame sits at the front
+        while (m_ResidentBytes > m_BudgetBytes && m_Recent.size() > 1)
+        {
+            const AssetHandle handle = m_Recent.back();
+
+            auto it = m_Entries.find(handle);
+            if (it != m_Entries.end())
+            {
+                Release(it->second);
+                m_Entries.erase(it);
+            }
+            else
+                m_Recent.pop_back();
+        }
+    }
+
+    void ThumbnailCache::Invalidate(AssetHandle handle)
+    {
+        auto it = m_Entries.find(handle);
+        if (it == m_Entries.end())
+            return;
+
+        if (it->second.Pending)
+        {
+            --m_InFlight;
+            std::erase(m_PendingHandles, handle);
+        }
+
+        Release(it->second);
+        m_Entries.erase(it);
+
+        RemoveThumbnails(m_Directory, handle);
+    }
+
+    void ThumbnailCache::Clear()
+    {
+        m_Entries.clear();
+        m_Recent.clear();
+        m_ResidentBytes = 0;
+        m_InFlight = 0;
+        m_PendingHandles.clear();
+    }
+
+    ThumbnailCacheStats ThumbnailCache::GetStats() const
+    {
+        ThumbnailCacheStats stats{};
+        stats.Resident = m_Recent.size();
+        stats.ResidentBytes = m_ResidentBytes;
+        stats.Pending = m_InFlight;
+        stats.DiskHits = m_DiskHits;
+        stats.Generated = m_Generated;
+        return stats;
+    }
+
+    void ThumbnailCache::Downscale(const uint8_t* pixels, uint32_t width, uint32_t height, uint32_t maxSize,
+        Buffer& outPixels, uint32_t& outWidth, uint32_t& outHeight)
+    {
+        Buffer current(pixels, static_cast<size_t>(width) * height * 4);
+        Buffer next;
+
+        while (width > maxSize || height > maxSize)
+        {
+            const uint32_t nextWidth = std::max(width / 2, 1u);
+            const uint32_t nextHeight = std::max(height / 2, 1u);
+
+            next.Resize(static_cast<size_t>(nextWidth) * nextHeight * 4);
+
+            const uint8_t* src = current.Data();
+            uint8_t* dst = next.Data();
+
+            for (uint32_t y = 0; y < nextHeight; ++y)
+            {
+                const uint32_t y0 = std::min(y * 2, height - 1);
+                const uint32_t y1 = std::min(y * 2 + 1, height - 1);
+
+                for (uint32_t x = 0; x < nextWidth; ++x)
+                {
+                    const uint32_t x0 = std::min(x * 2, width - 1);
+                    const uint32_t x1 = std::min(x * 2 + 1, width - 1);
+
+                    const uint8_t* a = src + (static_cast<size_t>(y0) * width + x0) * 4;
+                    const uint8_t* b = src + (static_cast<size_t>(y0) * width + x1) * 4;
+                    const uint8_t* c = src + (static_cast<size_t>(y1) * width + x0) * 4;
+                    const uint8_t* d = src + (static_cast<size_t>(y1) * width + x1) * 4;
+
+                    uint8_t* out = dst + (static_cast<size_t>(y) * nextWidth + x) * 4;
+                    for (int channel = 0; channel < 4; ++channel)
+                        out[channel] = static_cast<uint8_t>((a[channel] + b[channel] + c[channel] + d[channel] + 2) / 4);
+                }
+            }
+
+            std::swap(current, next);
+            width = nextWidth;
+            height = nextHeight;
+        }
+
+        outPixels = std::move(current);
+        outWidth = width;
+        outHeight = height;
+    }
+
+    void ThumbnailCache::Produce(Job& job, AssetHandle handle, const std::filesystem::path& sourcePath, const std::filesystem::path& cachePath)
+    {
+        if (!cachePath.empty() && ReadThumbnail(cachePath, job.Pixels, job.Width, job.Height))
+        {
+            job.FromDisk = true;
+            return;
+        }
+
+        int width = 0;
+        int height = 0;
+        int channels = 0;
+
+        // Runs on a worker, the global flag would race with loads on other threads
+        stbi_set_flip_vertically_on_load_thread(1);
+        stbi_uc* data = stbi_load(sourcePath.string().c_str(), &width, &height, &channels, 4);
+        if (!data)
+        {
+            job.Failed = true;
+            return;
+        }
+
+        Downscale(data, static_cast<uint32_t>(width), static_cast<uint32_t>(height), ThumbnailSize, job.Pixels, job.Width, job.Height);
+        stbi_image_free(data);
+
+        if (cachePath.empty())
+            return;
+
+        // Whatever was cached for an older version of the source is now stale
+        WriteThumbnail(cachePath, job.Pixels, job.Width, job.Height);
+        RemoveThumbnails(cachePath.parent_path(), handle, cachePath);
+    }
+
+    uint64_t ThumbnailCache::HashSource(const std::filesystem::path& sourcePath)
+    {
+        std::error_code ec;
+        const uint64_t size = static_cast<uint64_t>(std::filesystem::file_size(sourcePath, ec));
+        const int64_t time = static_cast<int64_t>(std::filesystem::last_write_time(sourcePath, ec).time_since_epoch().count());
+
+        const std::string path = sourcePath.generic_string();
+
+        uint64_t hash = HashBytes(FnvOffset, path.data(), path.size());
+        hash = HashBytes(hash, &size, sizeof(size));
+        return HashBytes(hash, &time, sizeof(time));
+    }
+
+    std::filesystem::path ThumbnailCache::GetCachePath(AssetHandle handle, uint64_t sourceHash) const
+    {
+        if (m_Directory.empty())
+            return {};
+
+        char hash[17]{};
+        std::snprintf(hash, sizeof(hash), "%016llx", static_cast<unsigned long long>(sourceHash));
+
+        return m_Directory / (std::to_string(static_cast<uint64_t>(handle)) + "_" + hash + ".thumb");
+    }
+
+    void ThumbnailCache::Retire(AssetHandle handle, Entry& entry)
+    {
+        std::shared_ptr<Job> job = std::move(entry.Pending);
+        --m_InFlight;
+        std::erase(m_PendingHandles, handle);
+
+        if (job->Failed)
+        {
+            entry.Failed = true;
+            return;
+        }
+
+        if (job->FromDisk)
+            ++m_DiskHits;
+        else
+            ++m_Generated;
+
+        TextureDescriptor desc{};
+        desc.Width = job->Width;
+        desc.Height = job->Height;
+        desc.Format = ImageFormat::RGBA8;
+        desc.MinFilter = ImageFilter::Linear;
+        desc.MagFilter = ImageFilter::Linear;
+
+        entry.Texture = Texture2D::Create(desc);
+        entry.Texture->SetData(job->Pixels);
+        entry.Bytes = job->Pixels.Size();
+
+        m_ResidentBytes += entry.Bytes;
+        m_Recent.push_front(handle);
+        entry.Recent = m_Recent.begin();
+    }
+
+    void ThumbnailCache::Touch(Entry& entry)
+    {
+        m_Recent.splice(m_Recent.begin(), m_Recent, entry.Recent);
+    }
+
+    void ThumbnailCache::Release(Entry& entry)
+    {
+        if (!entry.Texture)
+            return;
+
+        m_ResidentBytes -= entry.Bytes;
+        m_Recent.erase(entry.Recent);
+        entry.Texture.reset();
+    }
+}
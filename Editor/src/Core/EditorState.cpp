@@ -61,8 +61,6 @@
 
 #include <Reflection/BClass.h>
 
-#include <BoonDebug/DebugRenderer.h>
-
 #include <Command/EditorCommandQueue.h>
 
 #include <Input/Input.h>
@@ -121,6 +119,7 @@ void EditorState::OnEnter()
 	importer.RegisterImporter<MaterialImporter>();
 
 	AssetDatabase::Get().Init(assetLib);
+	AssetDatabase::Get().GetThumbnailCache().SetDirectory(config.ProjectRoot / "generated/Thumbnails");
 
 	m_PRenderer = std::make_unique<EditorRenderer>(m_Context.m_CurrentProject, assetLib.Load<Texture2DAsset>("Resources/BoonEngine.png").Instance());
 	m_PRenderer->SetMenuBarCallback(std::bind(&EditorState::RenderMenuBar, this));
@@ -202,8 +201,6 @@ void EditorState::OnEnter()
 void EditorState::OnUpdate()
 {
 	EngineContext& ctx = GetContext();
-	Boon::DebugRenderer::Get().BeginFrame();
-
 	Time& time = *ctx.Time;
 	SceneManager& sceneManager = *ctx.Scenes;
 
@@ -364,6 +361,23 @@ void EditorState::RenderMenuBar()
 				}
 			}
 		}
+		if (ImGui::MenuItem("Export binary scene"))
+		{
+			if (m_PlayState != EditorPlayState::Play)
+			{
+				FileSystem::OpenDialogOptions options{};
+				options.filters = { FileSystem::FileFilter{ L"Boon Scene", L"*.scene" } };
+				options.title = L"Export Binary Scene";
+				options.initialPath = m_Context.m_CurrentProject.Runtime.AssetsRoot;
+				FileSystem::Path scenPath = FileSystem::OpenFileDialog(options);
+
+				if (!scenPath.empty())
+				{
+					SceneSerializer serializer(*m_pSelectedScene);
+					serializer.SerializeBinary(scenPath);
+				}
+			}
+		}
 		if (ImGui::MenuItem("Open scene"))
 		{
 			if (m_PlayState != EditorPlayState::Play)
@@ -0,0 +1,304 @@
+#include "Core/ScenePicker.h"
+
+#include <Scene/Scene.h>
+#include <Component/TransformComponent.h>
+#include <Component/SpriteRendererComponent.h>
+#include <Component/TextureRendererComponent.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace BoonEditor
+{
+    namespace
+    {
+        // Corners of the unit quad every sprite is drawn with
+        const glm::vec4 QuadCorners[4] = {
+            { -0.5f, -0.5f, 0.0f, 1.0f },
+            {  0.5f, -0.5f, 0.0f, 1.0f },
+            {  0.5f,  0.5f, 0.0f, 1.0f },
+            { -0.5f,  0.5f, 0.0f, 1.0f }
+        };
+
+        void RemoveFrom(std::vector<GameObjectID>& objects, GameObjectID object)
+        {
+            auto it = std::find(objects.begin(), objects.end(), object);
+            if (it == objects.end())
+                return;
+
+            *it = objects.back();
+            objects.pop_back();
+        }
+    }
+
+    ScenePicker::ScenePicker(float cellSize)
+        : m_CellSize(cellSize > 0.0f ? cellSize : DefaultCellSize)
+    {
+    }
+
+    void ScenePicker::Refresh(Scene& scene)
+    {
+        ++m_Stamp;
+
+        SceneRegistry& registry = scene.GetRegistry();
+
+        registry.view<TransformComponent, SpriteRendererComponent>().each(
+            [this](GameObjectID object, TransformComponent& transform, SpriteRendererComponent&)
+            {
+                Update(object, transform.GetWorld());
+            });
+
+        registry.view<TransformComponent, TextureRendererComponent>().each(
+            [this](GameObjectID object, TransformComponent& transform, TextureRendererComponent&)
+            {
+                Update(object, transform.GetWorld());
+            });
+
+        // Whatever was not visited lost its renderer or was destroyed
+        for (auto it = m_Entries.begin(); it != m_Entries.end();)
+        {
+            if (it->second.Stamp == m_Stamp)
+            {
+                ++it;
+                continue;
+            }
+
+            Unlink(it->first, it->second);
+            it = m_Entries.erase(it);
+        }
+    }
+
+    void ScenePicker::Clear()
+    {
+        m_Entries.clear();
+        m_Cells.clear();
+        m_Large.clear();
+    }
+
+    bool ScenePicker::Pick(const glm::vec2& worldPoint, GameObjectID& outObject) const
+    {
+        bool hit = false;
+        float bestDepth = 0.0f;
+
+        auto test = [&](GameObjectID object)
+            {
+                const Entry& entry = m_Entries.at(object);
+                if (!Contains(entry, worldPoint))
+                    return;
+
+                if (!hit || entry.Depth > bestDepth)
+                {
+                    hit = true;
+                    bestDepth = entry.Depth;
+                    outObject = object;
+                }
+            };
+
+        const glm::ivec2 cell = ToCell(worldPoint);
+
+        auto it = m_Cells.find(CellKey(cell.x, cell.y));
+        if (it != m_Cells.end())
+        {
+            for (GameObjectID object : it->second)
+                test(object);
+        }
+
+        for (GameObjectID object : m_Large)
+            test(object);
+
+        return hit;
+    }
+
+    void ScenePicker::BoxSelect(const glm::vec2& min, const glm::vec2& max, std::vector<GameObjectID>& outObjects) const
+    {
+        const glm::vec2 boxMin = glm::min(min, max);
+        const glm::vec2 boxMax = glm::max(min, max);
+
+        const size_t first = outObjects.size();
+
+        const glm::ivec2 cellMin = ToCell(boxMin);
+        const glm::ivec2 cellMax = ToCell(boxMax);
+
+        auto overlaps = [&](const Entry& entry)
+            {
+                return entry.Min.x <= boxMax.x && entry.Max.x >= boxMin.x &&
+                    entry.Min.y <= boxMax.y && entry.Max.y >= boxMin.y;
+            };
+
+        // An entry sits in every cell it covers, report it only from the first one inside the box
+        auto visit = [&](int x, int y, const std::vector<GameObjectID>& objects)
+            {
+                for (GameObjectID object : objects)
+                {
+                    const Entry& entry = m_Entries.at(object);
+
+                    if (x != std::max(entry.CellMin.x, cellMin.x) || y != std::max(entry.CellMin.y, cellMin.y))
+                        continue;
+
+                    if (overlaps(entry))
+                        outObjects.push_back(object);
+                }
+            };
+
+        const int64_t boxCells =
+            (static_cast<int64_t>(cellMax.x) - cellMin.x + 1) *
+            (static_cast<int64_t>(cellMax.y) - cellMin.y + 1);
+
+        if (boxCells > static_cast<int64_t>(m_Cells.size()))
+        {
+            // Zoomed far out, fewer occupied cells than cells under the box
+            for (const auto& [key, objects] : m_Cells)
+            {
+                const int x = static_cast<int>(static_cast<int32_t>(key >> 32));
+                const int y = static_cast<int>(static_cast<int32_t>(key & 0xFFFFFFFFu));
+
+                if (x >= cellMin.x && x <= cellMax.x && y >= cellMin.y && y <= cellMax.y)
+                    visit(x, y, objects);
+            }
+        }
+        else
+        {
+            for (int y = cellMin.y; y <= cellMax.y; ++y)
+            {
+                for (int x = cellMin.x; x <= cellMax.x; ++x)
+                {
+                    auto it = m_Cells.find(CellKey(x, y));
+                    if (it != m_Cells.end())
+                        visit(x, y, it->second);
+                }
+            }
+        }
+
+        for (GameObjectID object : m_Large)
+        {
+            if (overlaps(m_Entries.at(object)))
+                outObjects.push_back(object);
+        }
+
+        std::sort(outObjects.begin() + first, outObjects.end(), [this](GameObjectID a, GameObjectID b)
+            {
+                return m_Entries.at(a).Depth > m_Entries.at(b).Depth;
+            });
+    }
+
+    void ScenePicker::Update(GameObjectID object, const glm::mat4& world)
+    {
+        Entry& entry = m_Entries[object];
+
+        // Objects carrying both renderers are visited twice in one refresh
+        if (entry.Stamp == m_Stamp)
+            return;
+
+        entry.Stamp = m_Stamp;
+
+        if (entry.Linked && entry.World == world)
+            return;
+
+        if (entry.Linked)
+            Unlink(object, entry);
+
+        entry.World = world;
+        entry.Depth = world[3].z;
+
+        glm::vec2 min(world * QuadCorners[0]);
+        glm::vec2 max = min;
+
+        for (int i = 1; i < 4; ++i)
+        {
+            const glm::vec2 corner(world * QuadCorners[i]);
+            min = glm::min(min, corner);
+            max = glm::max(max, corner);
+        }
+
+        entry.Min = min;
+        entry.Max = max;
+
+        Link(object, entry);
+    }
+
+    void ScenePicker::Link(GameObjectID object, Entry& entry)
+    {
+        entry.CellMin = ToCell(entry.Min);
+        entry.CellMax = ToCell(entry.Max);
+        entry.Linked = true;
+
+        const int64_t cells =
+            (static_cast<int64_t>(entry.CellMax.x) - entry.CellMin.x + 1) *
+            (static_cast<int64_t>(entry.CellMax.y) - entry.CellMin.y + 1);
+
+        entry.Large = cells > MaxCellsPerEntry;
+        if (entry.Large)
+        {
+            m_Large.push_back(object);
+            return;
+        }
+
+        for (int y = entry.CellMin.y; y <= entry.CellMax.y; ++y)
+        {
+            for (int x = entry.CellMin.x; x <= entry.CellMax.x; ++x)
+                m_Cells[CellKey(x, y)].push_back(object);
+        }
+    }
+
+    void ScenePicker::Unlink(GameObjectID object, Entry& entry)
+    {
+        if (!entry.Linked)
+            return;
+
+        entry.Linked = false;
+
+        if (entry.Large)
+        {
+            RemoveFrom(m_Large, object);
+            return;
+        }
+
+        for (int y = entry.CellMin.y; y <= entry.CellMax.y; ++y)
+        {
+            for (int x = entry.CellMin.x; x <= entry.CellMax.x; ++x)
+            {
+                auto it = m_Cells.find(CellKey(x, y));
+                if (it == m_Cells.end())
+                    continue;
+
+                RemoveFrom(it->second, object);
+                if (it->second.empty())
+                    m_Cells.erase(it);
+            }
+        }
+    }
+
+    glm::ivec2 ScenePicker::ToCell(const glm::vec2& point) const
+    {
+        return {
+            static_cast<int>(std::floor(point.x / m_CellSize)),
+            static_cast<int>(std::floor(point.y / m_CellSize))
+        };
+    }
+
+    uint64_t ScenePicker::CellKey(int x, int y)
+    {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) | static_cast<uint32_t>(y);
+    }
+
+    bool ScenePicker::Contains(const Entry& entry, const glm::vec2& point)
+    {
+        if (point.x < entry.Min.x || point.x > entry.Max.x ||
+            point.y < entry.Min.y || point.y > entry.Max.y)
+            return false;
+
+        // Back into the quad's own space, so rotated sprites do not pick by their corners
+        const glm::vec2 axisX(entry.World[0]);
+        const glm::vec2 axisY(entry.World[1]);
+        const glm::vec2 offset = point - glm::vec2(entry.World[3]);
+
+        const float det = axisX.x * axisY.y - axisY.x * axisX.y;
+        if (std::abs(det) < 1e-8f)
+            return false;
+
+        const float localX = (offset.x * axisY.y - axisY.x * offset.y) / det;
+        const float localY = (axisX.x * offset.y - offset.x * axisX.y) / det;
+
+        return std::abs(localX) <= 0.5f && std::abs(localY) <= 0.5f;
+    }
+}
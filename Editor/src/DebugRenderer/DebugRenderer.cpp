@@ -1,9 +1,9 @@
 #include "DebugRenderer/DebugRenderer.h"
-#include "BoonDebug/DebugRenderer.h"
 
 #include <Renderer/Renderer2D.h>
-#include <Renderer/Framebuffer.h>
-#include <Renderer/Camera.h>
+#include <Renderer/RenderPass.h>
+#include <Renderer/SceneRenderer.h>
+#include <Renderer/Tilemap.h>
 
 #include <Scene/Scene.h>
 
@@ -11,95 +11,152 @@
 #include <Component/BoxCollider2D.h>
 #include <Component/TilemapRendererComponent.h>
 
+#include <memory>
+
 using namespace BoonEditor;
 
-BoonEditor::DebugRenderer::DebugRenderer(Scene* pScene, Framebuffer* pFramebuffer)
-	: m_pScene{pScene}, m_pFramebuffer{pFramebuffer}
+namespace
+{
+	class EditorDebugPass final : public RenderPass
+	{
+	public:
+		EditorDebugPass(BoonEditor::DebugRenderer* pOwner)
+			: m_pOwner{ pOwner } {
+		}
+
+		void Execute(RenderContext& context) override
+		{
+			m_pOwner->Draw(context);
+		}
+
+		RenderPhaseID GetPhase() const override
+		{
+			return RenderPhases::Debug;
+		}
+
+	private:
+		BoonEditor::DebugRenderer* m_pOwner;
+	};
+}
+
+BoonEditor::DebugRenderer::DebugRenderer(Scene* pScene, SceneRenderer* pSceneRenderer)
+	: m_pScene{pScene}
 {
-	Renderer2DCreateInfo desc{};
-	m_pRenderer2D = std::make_unique<Renderer2D>(desc);
+	// The scene renderer outlives this object but never renders after the viewport is gone
+	pSceneRenderer->AddPass(std::make_unique<EditorDebugPass>(this));
 }
 
 BoonEditor::DebugRenderer::~DebugRenderer()
 {
 }
 
-void BoonEditor::DebugRenderer::Render(EditorViewportSettings settings, Camera* camera, TransformComponent* cameraTransform)
+void BoonEditor::DebugRenderer::SetContext(Scene* pScene)
 {
-	if (settings.DebugRenderLayers & DebugRenderLayer::Disabled)
-		return;
+	if (pScene != m_pScene)
+		m_TilemapOverlays.clear();
 
-	Begin();
+	m_pScene = pScene;
+}
+
+void BoonEditor::DebugRenderer::Prepare(const EditorViewportSettings& settings)
+{
+	m_Settings = settings;
+	m_FrameLines.Clear();
+
+	if (!m_pScene || (settings.DebugRenderLayers & DebugRenderLayer::Disabled))
+		return;
 
 	if (settings.DebugRenderLayers & DebugRenderLayer::Collision)
-	{
-		auto group = m_pScene->GetAllGameObjectsWith<TransformComponent, BoxCollider2D>();
-		for (auto gameObject : group)
-		{
-			auto [transform, collider] = group.get<TransformComponent, BoxCollider2D>(gameObject);
-			{
-				m_pRenderer2D->SubmitRect(transform.GetWorld(), collider.Size, glm::vec4(1.f, 1.f, 1.f, 1.f));
-			}
-		}
-	}
+		RecordColliders();
+
 	if (settings.DebugRenderLayers & DebugRenderLayer::Default)
+		RecordTilemaps();
+}
+
+void BoonEditor::DebugRenderer::Draw(RenderContext& context)
+{
+	if (m_Settings.DebugRenderLayers & DebugRenderLayer::Disabled)
+		return;
+
+	context.Renderer2D.SubmitLines(m_FrameLines.GetLines());
+
+	if (m_Settings.DebugRenderLayers & DebugRenderLayer::Default)
 	{
-		auto group = m_pScene->GetAllGameObjectsWith<TransformComponent, TilemapRendererComponent>();
-		for (auto gameObject : group)
-		{
-			auto [transform, tilemap] = group.get<TransformComponent, TilemapRendererComponent>(gameObject);
-			{
-				if (!tilemap.tilemap.IsValid())
-					continue;
-
-				auto map = tilemap.tilemap->GetInstance();
-				auto atlas = map->GetAtlas()->GetInstance();
-				auto texture = atlas->GetTexture().Instance();
-
-				float ppu = 32.f;
-
-				// Tiles use the atlas sprite 0 as reference size (or any tileId you prefer)
-				//const SpriteFrame& f0 = atlas->GetSpriteFrame(0);
-				//float tilePixelW = f0.Size.x * texture->GetWidth();
-				//float tilePixelH = f0.Size.y * texture->GetHeight();
-				//
-				//float tileWorldW = tilePixelW / ppu * map->GetUnitSize();
-				//float tileWorldH = tilePixelH / ppu * map->GetUnitSize();
-
-				float tileWorldW = map->GetUnitSize();
-				float tileWorldH = map->GetUnitSize();
-
-				glm::mat4 world = transform.GetWorld();
-
-				for (auto chunk : map->GetChunks())
-				{
-					// Same positioning as BuildChunk
-					float worldX = (chunk.ChunkX * map->GetChunkSize()) * tileWorldW + map->GetChunkSize() * tileWorldW * 0.5f;
-					float worldY = (chunk.ChunkY * map->GetChunkSize()) * tileWorldH + map->GetChunkSize() * tileWorldH * 0.5f;
-
-					// Centered quad (Renderer2D convention)
-					glm::vec3 pos = glm::vec3(world * glm::vec4(worldX, worldY, 0, 1));
-					glm::vec2 size = glm::vec2(map->GetChunkSize() * tileWorldW, map->GetChunkSize() * tileWorldH);
-
-					m_pRenderer2D->SubmitRect(pos, size, glm::vec4(1, 1, 1, 1));
-				}
-			}
-		}
+		for (const auto& [gameObject, overlay] : m_TilemapOverlays)
+			context.Renderer2D.SubmitLines(overlay.Lines.GetLines());
 	}
 
-	Boon::DebugRenderer::Get().FlushQueue(*m_pRenderer2D);
-
-	End();
+	Boon::DebugRenderer::Get().Flush(context.Renderer2D);
 }
 
-void BoonEditor::DebugRenderer::Begin()
+void BoonEditor::DebugRenderer::RecordColliders()
 {
-	m_pFramebuffer->Bind();
-	//m_pRenderer2D->Begin();
+	auto group = m_pScene->GetAllGameObjectsWith<TransformComponent, BoxCollider2D>();
+	for (auto gameObject : group)
+	{
+		auto [transform, collider] = group.get<TransformComponent, BoxCollider2D>(gameObject);
+		if (!collider.DrawDebug)
+			continue;
+
+		m_FrameLines.AddRect(transform.GetWorld(), collider.Size, glm::vec4(1.f, 1.f, 1.f, 1.f));
+	}
 }
 
-void BoonEditor::DebugRenderer::End()
+void BoonEditor::DebugRenderer::RecordTilemaps()
 {
-	//m_pRenderer2D->End();
-	m_pFramebuffer->Unbind();
+	++m_Stamp;
+
+	auto group = m_pScene->GetAllGameObjectsWith<TransformComponent, TilemapRendererComponent>();
+	for (auto gameObject : group)
+	{
+		auto [transform, tilemap] = group.get<TransformComponent, TilemapRendererComponent>(gameObject);
+
+		if (!tilemap.tilemap.IsValid())
+			continue;
+
+		const std::shared_ptr<Tilemap>& map = tilemap.tilemap->GetInstance();
+		if (!map)
+			continue;
+
+		const glm::mat4& world = transform.GetWorld();
+
+		TilemapOverlay& overlay = m_TilemapOverlays[gameObject];
+		overlay.Stamp = m_Stamp;
+
+		// Outlines stay valid until a chunk is added or removed, or the map moves
+		if (!overlay.Lines.IsEmpty() &&
+			overlay.Revision == map->GetRevision() &&
+			overlay.UnitSize == map->GetUnitSize() &&
+			overlay.World == world)
+			continue;
+
+		overlay.Revision = map->GetRevision();
+		overlay.UnitSize = map->GetUnitSize();
+		overlay.World = world;
+		overlay.Lines.Clear();
+		overlay.Lines.Reserve(map->GetChunks().size() * 4);
+
+		const float tileWorldW = map->GetUnitSize();
+		const float tileWorldH = map->GetUnitSize();
+		const int chunkSize = map->GetChunkSize();
+
+		const glm::vec2 size = glm::vec2(chunkSize * tileWorldW, chunkSize * tileWorldH);
+
+		for (const auto& [key, chunk] : map->GetChunks())
+		{
+			// Same positioning as BuildChunk
+			float worldX = (chunk.ChunkX * chunkSize) * tileWorldW + chunkSize * tileWorldW * 0.5f;
+			float worldY = (chunk.ChunkY * chunkSize) * tileWorldH + chunkSize * tileWorldH * 0.5f;
+
+			// Centered quad (Renderer2D convention)
+			glm::vec3 pos = glm::vec3(world * glm::vec4(worldX, worldY, 0, 1));
+
+			overlay.Lines.AddRect(pos, size, glm::vec4(1, 1, 1, 1));
+		}
+	}
+
+	std::erase_if(m_TilemapOverlays, [this](const auto& entry)
+		{
+			return entry.second.Stamp != m_Stamp;
+		});
 }
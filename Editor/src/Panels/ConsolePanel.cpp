@@ -6,11 +6,90 @@
 #include "BoonDebug/Logger.h"
 #include "Core/ServiceLocator.h"
 
+#include <algorithm>
+#include <cctype>
+
 using namespace BoonEditor;
 
+namespace
+{
+	constexpr int LevelCount = 3;
+
+	int ClampLevel(int level)
+	{
+		return std::clamp(level, 0, LevelCount - 1);
+	}
+
+	std::string ToLower(std::string_view text)
+	{
+		std::string lower(text);
+		std::transform(lower.begin(), lower.end(), lower.begin(),
+			[](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+		return lower;
+	}
+
+	const char* GetPrefixForLevel(int level)
+	{
+		switch (level)
+		{
+		case 1: return "Warn";
+		case 2: return "Error";
+		default: return "Info";
+		}
+	}
+
+	const char* GetBadgeForLevel(int level)
+	{
+		switch (level)
+		{
+		case 1: return ICON_FA_TRIANGLE_EXCLAMATION " Warn";
+		case 2: return ICON_FA_CIRCLE_XMARK " Error";
+		default: return ICON_FA_CIRCLE_INFO " Info";
+		}
+	}
+
+	ImU32 Accent(float alpha)
+	{
+		ImVec4 c = ImGui::GetStyleColorVec4(ImGuiCol_CheckMark);
+		c.w *= alpha;
+		return ImGui::GetColorU32(c);
+	}
+
+	ImU32 GetPrefixColorForLevel(int level)
+	{
+		switch (level)
+		{
+		case 1:
+			return ImGui::GetColorU32(ImVec4(1.0f, 0.72f, 0.28f, 1.0f));
+
+		case 2:
+			return ImGui::GetColorU32(ImVec4(1.0f, 0.38f, 0.42f, 1.0f));
+
+		default:
+			return Accent(0.95f);
+		}
+	}
+
+	ImU32 GetBadgeBgForLevel(int level)
+	{
+		switch (level)
+		{
+		case 1:
+			return ImGui::GetColorU32(ImVec4(1.0f, 0.72f, 0.28f, 0.14f));
+
+		case 2:
+			return ImGui::GetColorU32(ImVec4(1.0f, 0.25f, 0.32f, 0.16f));
+
+		default:
+			return Accent(0.12f);
+		}
+	}
+}
+
 ConsolePanel::ConsolePanel(EditorContext* pContext, const std::string& name)
 	: EditorPanel(pContext, name), m_pSink{ std::make_shared<EditorLogSink>(this) }
 {
+	m_Ring.resize(MaxMessages);
 	Boon::ServiceLocator::Get<Boon::Logger>().AddSink(m_pSink);
 }
 
@@ -21,195 +100,222 @@ BoonEditor::ConsolePanel::~ConsolePanel()
 
 void ConsolePanel::AddMessage(const std::string& text, int level)
 {
-	std::scoped_lock lock(m_Mutex);
-	m_Messages.push_back({ text, level });
-	m_ScrollToBottom = true;
-}
+	// Split and lowercase on the logging thread, the UI thread only links the message in
+	ConsoleMessage message{};
+	message.Text = text;
+	message.SearchText = ToLower(text);
+	message.Level = ClampLevel(level);
+
+	message.LineStarts.push_back(0);
+	for (size_t pos = text.find('\n'); pos != std::string::npos; pos = text.find('\n', pos + 1))
+		message.LineStarts.push_back(static_cast<uint32_t>(pos + 1));
 
-void ConsolePanel::Clear()
-{
 	std::scoped_lock lock(m_Mutex);
-	m_Messages.clear();
+
+	// A hidden console stops draining, keep the queue as bounded as the ring
+	if (m_Pending.size() >= MaxMessages)
+		m_Pending.pop_front();
+
+	m_Pending.push_back(std::move(message));
 }
 
-void ConsolePanel::OnRenderUI()
+void ConsolePanel::Clear()
 {
-	struct RenderLine
 	{
-		std::string Prefix;
-		std::string Text;
-		int Level{};
-		size_t MessageIndex{};
-		bool IsContinuation{};
-	};
-
-	static bool s_HasSelection = false;
-	static int s_SelectionStart = -1;
-	static int s_SelectionEnd = -1;
-	static bool s_IsDraggingSelection = false;
-
-	auto NormalizeSelection = [](int& a, int& b)
-		{
-			if (a > b)
-				std::swap(a, b);
-		};
-
-	auto SplitLines = [](const std::string& text)
-		{
-			std::vector<std::string> lines;
+		std::scoped_lock lock(m_Mutex);
+		m_Pending.clear();
+	}
 
-			size_t start = 0;
+	for (uint64_t sequence = m_FirstSequence; sequence < m_NextSequence; ++sequence)
+		m_Ring[sequence % MaxMessages] = ConsoleMessage{};
 
-			while (start <= text.size())
-			{
-				size_t end = text.find('\n', start);
+	m_FirstSequence = m_NextSequence;
+	m_VisibleLines.clear();
+	std::fill(std::begin(m_LevelCounts), std::end(m_LevelCounts), size_t{ 0 });
+	m_MaxLineWidth = 0.0f;
 
-				if (end == std::string::npos)
-				{
-					lines.emplace_back(text.substr(start));
-					break;
-				}
+	ClearSelection();
+}
 
-				lines.emplace_back(text.substr(start, end - start));
-				start = end + 1;
+void ConsolePanel::DrainPending()
+{
+	std::deque<ConsoleMessage> pending;
+	{
+		std::scoped_lock lock(m_Mutex);
+		pending.swap(m_Pending);
+	}
 
-				if (start == text.size())
-				{
-					lines.emplace_back("");
-					break;
-				}
-			}
+	for (ConsoleMessage& message : pending)
+	{
+		if (m_NextSequence - m_FirstSequence >= MaxMessages)
+			EvictOldest();
 
-			if (lines.empty())
-				lines.emplace_back("");
+		message.Sequence = m_NextSequence++;
+		++m_LevelCounts[message.Level];
 
-			return lines;
-		};
+		ConsoleMessage& stored = m_Ring[message.Sequence % MaxMessages];
+		stored = std::move(message);
 
-	auto GetPrefixForLevel = [](int level) -> const char*
+		for (uint32_t line = 0; line < stored.LineStarts.size(); ++line)
 		{
-			switch (level)
-			{
-			case 1: return "Warn";
-			case 2: return "Error";
-			default: return "Info";
-			}
-		};
+			const std::string_view text = GetLineText(stored, line);
+			m_MaxLineWidth = std::max(m_MaxLineWidth, ImGui::CalcTextSize(text.data(), text.data() + text.size()).x);
 
-	auto GetIconForLevel = [](int level) -> const char*
-		{
-			switch (level)
+			if (Matches(stored, line))
 			{
-			case 1: return ICON_FA_TRIANGLE_EXCLAMATION;
-			case 2: return ICON_FA_CIRCLE_XMARK;
-			default: return ICON_FA_CIRCLE_INFO;
+				m_VisibleLines.push_back({ stored.Sequence, line });
+				m_ScrollToBottom = true;
 			}
-		};
+		}
+	}
+}
 
-	auto Accent = [](float alpha) -> ImU32
-		{
-			ImVec4 c = ImGui::GetStyleColorVec4(ImGuiCol_CheckMark);
-			c.w *= alpha;
-			return ImGui::GetColorU32(c);
-		};
+void ConsolePanel::EvictOldest()
+{
+	ConsoleMessage& oldest = m_Ring[m_FirstSequence % MaxMessages];
 
-	auto GetPrefixColorForLevel = [&Accent](int level) -> ImU32
-		{
-			switch (level)
-			{
-			case 1:
-				return ImGui::GetColorU32(ImVec4(1.0f, 0.72f, 0.28f, 1.0f));
+	size_t removed = 0;
+	while (!m_VisibleLines.empty() && m_VisibleLines.front().Message == m_FirstSequence)
+	{
+		m_VisibleLines.pop_front();
+		++removed;
+	}
 
-			case 2:
-				return ImGui::GetColorU32(ImVec4(1.0f, 0.38f, 0.42f, 1.0f));
+	--m_LevelCounts[oldest.Level];
+	oldest = ConsoleMessage{};
+	++m_FirstSequence;
 
-			default:
-				return Accent(0.95f);
-			}
-		};
+	if (removed == 0 || !m_HasSelection)
+		return;
 
-	auto GetBadgeBgForLevel = [&Accent](int level) -> ImU32
-		{
-			switch (level)
-			{
-			case 1:
-				return ImGui::GetColorU32(ImVec4(1.0f, 0.72f, 0.28f, 0.14f));
+	// Keep the selection on the same rows as the index shifts up
+	m_SelectionStart -= static_cast<int>(removed);
+	m_SelectionEnd -= static_cast<int>(removed);
 
-			case 2:
-				return ImGui::GetColorU32(ImVec4(1.0f, 0.25f, 0.32f, 0.16f));
+	if (m_SelectionStart < 0 && m_SelectionEnd < 0)
+		ClearSelection();
+	else
+	{
+		m_SelectionStart = std::max(m_SelectionStart, 0);
+		m_SelectionEnd = std::max(m_SelectionEnd, 0);
+	}
+}
 
-			default:
-				return Accent(0.12f);
-			}
-		};
+const ConsoleMessage& ConsolePanel::MessageAt(uint64_t sequence) const
+{
+	return m_Ring[sequence % MaxMessages];
+}
 
-	auto AppendSelectedLinesToClipboard =
-		[&NormalizeSelection](const std::vector<RenderLine>& lines, int start, int end)
-		{
-			if (lines.empty() || start < 0 || end < 0)
-				return;
+std::string_view ConsolePanel::GetLineText(const ConsoleMessage& message, uint32_t line, bool search) const
+{
+	const std::string& text = search ? message.SearchText : message.Text;
 
-			NormalizeSelection(start, end);
+	const size_t begin = message.LineStarts[line];
+	const size_t end = line + 1 < message.LineStarts.size()
+		? message.LineStarts[line + 1] - 1
+		: text.size();
 
-			start = std::max(0, start);
-			end = std::min(end, static_cast<int>(lines.size()) - 1);
+	return std::string_view(text).substr(begin, end - begin);
+}
 
-			std::string out;
+bool ConsolePanel::Matches(const ConsoleMessage& message, uint32_t line) const
+{
+	if ((m_LevelMask & (1u << message.Level)) == 0)
+		return false;
 
-			for (int i = start; i <= end; ++i)
-			{
-				const auto& line = lines[i];
+	return m_Filter.empty() || GetLineText(message, line, true).find(m_Filter) != std::string_view::npos;
+}
 
-				if (!line.IsContinuation)
-				{
-					out += "[";
-					out += line.Prefix;
-					out += "] ";
-				}
-				else
-				{
-					out += "       ";
-				}
+void ConsolePanel::SetFilter(const std::string& filter, uint32_t levelMask)
+{
+	const std::string lower = ToLower(filter);
 
-				out += line.Text;
+	// A longer query and fewer levels can only drop lines, so narrow the current index instead of rescanning the ring
+	const bool narrows =
+		(levelMask & ~m_LevelMask) == 0 &&
+		lower.find(m_Filter) != std::string::npos;
 
-				if (i < end)
-					out += '\n';
-			}
+	m_Filter = lower;
+	m_LevelMask = levelMask;
+
+	if (narrows)
+	{
+		std::erase_if(m_VisibleLines, [this](const ConsoleLine& line)
+			{
+				return !Matches(MessageAt(line.Message), line.Line);
+			});
+	}
+	else
+		RebuildVisibleLines();
 
-			ImGui::SetClipboardText(out.c_str());
-		};
+	ClearSelection();
+}
 
-	std::vector<ConsoleMessage> messages;
+void ConsolePanel::RebuildVisibleLines()
+{
+	m_VisibleLines.clear();
 
+	for (uint64_t sequence = m_FirstSequence; sequence < m_NextSequence; ++sequence)
 	{
-		std::scoped_lock lock(m_Mutex);
-		messages = m_Messages;
+		const ConsoleMessage& message = MessageAt(sequence);
+
+		for (uint32_t line = 0; line < message.LineStarts.size(); ++line)
+		{
+			if (Matches(message, line))
+				m_VisibleLines.push_back({ sequence, line });
+		}
 	}
+}
+
+void ConsolePanel::ClearSelection()
+{
+	m_HasSelection = false;
+	m_IsDraggingSelection = false;
+	m_SelectionStart = -1;
+	m_SelectionEnd = -1;
+}
 
-	std::vector<RenderLine> renderLines;
-	renderLines.reserve(messages.size());
+std::string ConsolePanel::CopyLines(int first, int last) const
+{
+	if (m_VisibleLines.empty() || first < 0 || last < 0)
+		return {};
 
-	for (size_t msgIndex = 0; msgIndex < messages.size(); ++msgIndex)
-	{
-		const auto& msg = messages[msgIndex];
-		const char* prefix = GetPrefixForLevel(msg.Level);
+	if (first > last)
+		std::swap(first, last);
+
+	last = std::min(last, static_cast<int>(m_VisibleLines.size()) - 1);
+
+	std::string out;
 
-		auto split = SplitLines(msg.Text);
+	for (int i = first; i <= last; ++i)
+	{
+		const ConsoleLine& line = m_VisibleLines[i];
+		const ConsoleMessage& message = MessageAt(line.Message);
 
-		for (size_t lineIndex = 0; lineIndex < split.size(); ++lineIndex)
+		if (line.Line == 0)
+		{
+			out += "[";
+			out += GetPrefixForLevel(message.Level);
+			out += "] ";
+		}
+		else
 		{
-			RenderLine line{};
-			line.Prefix = prefix;
-			line.Text = split[lineIndex];
-			line.Level = msg.Level;
-			line.MessageIndex = msgIndex;
-			line.IsContinuation = lineIndex != 0;
-
-			renderLines.push_back(std::move(line));
+			out += "       ";
 		}
+
+		out += GetLineText(message, line.Line);
+
+		if (i < last)
+			out += '\n';
 	}
 
+	return out;
+}
+
+void ConsolePanel::OnRenderUI()
+{
+	DrainPending();
+
 	ImGui::PushStyleVar(ImGuiStyleVar_WindowPadding, ImVec2(0, 0));
 
 	if (ImGui::BeginChild(
@@ -237,56 +343,67 @@ void ConsolePanel::OnRenderUI()
 		ImGui::Text("%s Console", ICON_FA_TERMINAL);
 
 		ImGui::SameLine();
-		ImGui::TextDisabled("| %zu messages", messages.size());
+		ImGui::TextDisabled("| %zu messages", static_cast<size_t>(m_NextSequence - m_FirstSequence));
 
 		ImGui::SameLine();
 
 		if (ImGui::Button(ICON_FA_TRASH_CAN))
-		{
 			Clear();
 
-			s_HasSelection = false;
-			s_SelectionStart = -1;
-			s_SelectionEnd = -1;
-		}
-
 		ImGui::SameLine();
 
 		if (ImGui::Button(ICON_FA_COPY))
 		{
-			std::string allText;
-
-			for (const auto& msg : messages)
-			{
-				allText += "[";
-				allText += GetPrefixForLevel(msg.Level);
-				allText += "] ";
-				allText += msg.Text;
-				allText += '\n';
-			}
-
+			const std::string allText = CopyLines(0, static_cast<int>(m_VisibleLines.size()) - 1);
 			ImGui::SetClipboardText(allText.c_str());
 		}
 
 		ImGui::SameLine();
 
-		if (!s_HasSelection)
+		if (!m_HasSelection)
 			ImGui::BeginDisabled();
 
 		if (ImGui::Button(ICON_FA_CLIPBOARD))
 		{
-			AppendSelectedLinesToClipboard(
-				renderLines,
-				s_SelectionStart,
-				s_SelectionEnd);
+			const std::string selected = CopyLines(m_SelectionStart, m_SelectionEnd);
+			ImGui::SetClipboardText(selected.c_str());
 		}
 
-		if (!s_HasSelection)
+		if (!m_HasSelection)
 			ImGui::EndDisabled();
 
 		ImGui::SameLine();
 		ImGui::Checkbox("Auto-scroll", &m_AutoScroll);
 
+		uint32_t levelMask = m_LevelMask;
+
+		for (int level = 0; level < LevelCount; ++level)
+		{
+			ImGui::SameLine();
+
+			const bool enabled = (levelMask & (1u << level)) != 0;
+			ImGui::PushStyleColor(ImGuiCol_Text, enabled ? GetPrefixColorForLevel(level) : ImGui::GetColorU32(ImGuiCol_TextDisabled));
+			ImGui::PushID(level);
+
+			if (ImGui::Button((std::string(GetBadgeForLevel(level)) + " " + std::to_string(m_LevelCounts[level]) + "###Level").c_str()))
+				levelMask ^= 1u << level;
+
+			ImGui::PopID();
+			ImGui::PopStyleColor();
+		}
+
+		ImGui::SameLine();
+		ImGui::SetNextItemWidth(std::max(120.0f, ImGui::GetContentRegionAvail().x - 10.0f));
+
+		const bool filterChanged = ImGui::InputTextWithHint(
+			"##ConsoleFilter",
+			ICON_FA_MAGNIFYING_GLASS " Filter",
+			m_FilterInput,
+			sizeof(m_FilterInput));
+
+		if (filterChanged || levelMask != m_LevelMask)
+			SetFilter(m_FilterInput, levelMask);
+
 		ImGui::SetCursorPos(ImVec2(0.0f, toolbarHeight));
 
 		if (ImGui::BeginChild(
@@ -305,23 +422,17 @@ void ConsolePanel::OnRenderUI()
 			const float rowPaddingX = 8.0f;
 			const float textStartX = rowPaddingX + badgeWidth + 12.0f;
 
-			float longestLineWidth = 0.0f;
-
-			for (const auto& line : renderLines)
-			{
-				longestLineWidth =
-					std::max(
-						longestLineWidth,
-						ImGui::CalcTextSize(line.Text.c_str()).x);
-			}
+			const int lineCount = static_cast<int>(m_VisibleLines.size());
 
 			const float canvasWidth =
-				textStartX + longestLineWidth + 40.0f;
+				textStartX + m_MaxLineWidth + 40.0f;
 
 			const float canvasHeight =
 				std::max(
 					ImGui::GetContentRegionAvail().y,
-					lineHeight * static_cast<float>(renderLines.size()));
+					lineHeight * static_cast<float>(lineCount));
+
+			const ImVec2 canvasStart = ImGui::GetCursorScreenPos();
 
 			ImGui::InvisibleButton(
 				"##ConsoleCanvas",
@@ -339,7 +450,7 @@ void ConsolePanel::OnRenderUI()
 
 					int idx = static_cast<int>(localY / lineHeight);
 
-					if (idx < 0 || idx >= static_cast<int>(renderLines.size()))
+					if (idx < 0 || idx >= lineCount)
 						return -1;
 
 					return idx;
@@ -352,121 +463,130 @@ void ConsolePanel::OnRenderUI()
 
 				if (clickedLine >= 0)
 				{
-					s_HasSelection = true;
-					s_IsDraggingSelection = true;
-					s_SelectionStart = clickedLine;
-					s_SelectionEnd = clickedLine;
+					m_HasSelection = true;
+					m_IsDraggingSelection = true;
+					m_SelectionStart = clickedLine;
+					m_SelectionEnd = clickedLine;
 				}
 			}
 
-			if (s_IsDraggingSelection)
+			if (m_IsDraggingSelection)
 			{
 				if (ImGui::IsMouseDown(ImGuiMouseButton_Left))
 				{
 					int hoveredLine = MouseToLineIndex(io.MousePos);
 
 					if (hoveredLine >= 0)
-						s_SelectionEnd = hoveredLine;
+						m_SelectionEnd = hoveredLine;
 				}
 				else
 				{
-					s_IsDraggingSelection = false;
+					m_IsDraggingSelection = false;
 				}
 			}
 
-			int selStart = s_SelectionStart;
-			int selEnd = s_SelectionEnd;
+			int selStart = std::min(m_SelectionStart, m_SelectionEnd);
+			int selEnd = std::max(m_SelectionStart, m_SelectionEnd);
+
+			// Only rows inside the scroll region are drawn
+			ImGui::SetCursorScreenPos(canvasStart);
 
-			if (s_HasSelection)
-				NormalizeSelection(selStart, selEnd);
+			ImGuiListClipper clipper;
+			clipper.Begin(lineCount, lineHeight);
 
-			for (int i = 0; i < static_cast<int>(renderLines.size()); ++i)
+			while (clipper.Step())
 			{
-				const auto& line = renderLines[i];
+				for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; ++i)
+				{
+					const ConsoleLine& line = m_VisibleLines[i];
+					const ConsoleMessage& message = MessageAt(line.Message);
 
-				const float y = canvasMin.y + i * lineHeight;
+					const float y = canvasMin.y + i * lineHeight;
 
-				const ImVec2 rowMin(canvasMin.x, y);
-				const ImVec2 rowMax(canvasMin.x + canvasWidth, y + lineHeight);
+					const ImVec2 rowMin(canvasMin.x, y);
+					const ImVec2 rowMax(canvasMin.x + canvasWidth, y + lineHeight);
 
-				if ((i % 2) == 0)
-				{
-					ImVec4 stripe =
-						ImGui::GetStyleColorVec4(ImGuiCol_Text);
+					if ((i % 2) == 0)
+					{
+						ImVec4 stripe =
+							ImGui::GetStyleColorVec4(ImGuiCol_Text);
 
-					stripe.w = 0.025f;
+						stripe.w = 0.025f;
 
-					dl->AddRectFilled(
-						rowMin,
-						rowMax,
-						ImGui::GetColorU32(stripe));
-				}
+						dl->AddRectFilled(
+							rowMin,
+							rowMax,
+							ImGui::GetColorU32(stripe));
+					}
 
-				if (s_HasSelection &&
-					i >= selStart &&
-					i <= selEnd)
-				{
-					ImVec4 sel =
-						ImGui::GetStyleColorVec4(ImGuiCol_ButtonActive);
+					if (m_HasSelection &&
+						i >= selStart &&
+						i <= selEnd)
+					{
+						ImVec4 sel =
+							ImGui::GetStyleColorVec4(ImGuiCol_ButtonActive);
 
-					sel.w = 0.35f;
+						sel.w = 0.35f;
 
-					dl->AddRectFilled(
-						rowMin,
-						rowMax,
-						ImGui::GetColorU32(sel));
-				}
+						dl->AddRectFilled(
+							rowMin,
+							rowMax,
+							ImGui::GetColorU32(sel));
+					}
 
-				if (!line.IsContinuation)
-				{
-					const ImU32 badgeText =
-						GetPrefixColorForLevel(line.Level);
+					if (line.Line == 0)
+					{
+						const ImU32 badgeText =
+							GetPrefixColorForLevel(message.Level);
+
+						const ImU32 badgeBg =
+							GetBadgeBgForLevel(message.Level);
 
-					const ImU32 badgeBg =
-						GetBadgeBgForLevel(line.Level);
+						ImVec2 badgeMin(
+							canvasMin.x + rowPaddingX,
+							y + 2.0f);
 
-					ImVec2 badgeMin(
-						canvasMin.x + rowPaddingX,
-						y + 2.0f);
+						ImVec2 badgeMax(
+							badgeMin.x + badgeWidth,
+							badgeMin.y + ImGui::GetTextLineHeight() + 6.0f);
 
-					ImVec2 badgeMax(
-						badgeMin.x + badgeWidth,
-						badgeMin.y + ImGui::GetTextLineHeight() + 6.0f);
+						dl->AddRectFilled(
+							badgeMin,
+							badgeMax,
+							badgeBg,
+							6.0f);
 
-					dl->AddRectFilled(
-						badgeMin,
-						badgeMax,
-						badgeBg,
-						6.0f);
+						dl->AddRect(
+							badgeMin,
+							badgeMax,
+							badgeText,
+							6.0f);
 
-					dl->AddRect(
-						badgeMin,
-						badgeMax,
-						badgeText,
-						6.0f);
+						const char* badge = GetBadgeForLevel(message.Level);
 
-					std::string badge =
-						std::string(GetIconForLevel(line.Level)) +
-						" " +
-						line.Prefix;
+						ImVec2 textSize =
+							ImGui::CalcTextSize(badge);
 
-					ImVec2 textSize =
-						ImGui::CalcTextSize(badge.c_str());
+						dl->AddText(
+							ImVec2(
+								badgeMin.x + (badgeWidth - textSize.x) * 0.5f,
+								badgeMin.y + 3.0f),
+							badgeText,
+							badge);
+					}
+
+					const std::string_view text = GetLineText(message, line.Line);
 
 					dl->AddText(
-						ImVec2(
-							badgeMin.x + (badgeWidth - textSize.x) * 0.5f,
-							badgeMin.y + 3.0f),
-						badgeText,
-						badge.c_str());
+						ImVec2(canvasMin.x + textStartX, y + 3.0f),
+						ImGui::GetColorU32(ImGuiCol_Text),
+						text.data(),
+						text.data() + text.size());
 				}
-
-				dl->AddText(
-					ImVec2(canvasMin.x + textStartX, y + 3.0f),
-					ImGui::GetColorU32(ImGuiCol_Text),
-					line.Text.c_str());
 			}
 
+			clipper.End();
+
 			if (m_AutoScroll && m_ScrollToBottom)
 			{
 				ImGui::SetScrollHereY(1.0f);
@@ -480,4 +600,4 @@ void ConsolePanel::OnRenderUI()
 	ImGui::EndChild();
 
 	ImGui::PopStyleVar();
-}
\ No newline at end of file
+}
@@ -408,6 +408,8 @@ void ContentBrowser::Update()
         BuildFolderTree();
         db.ClearDirty();
     }
+
+    db.GetThumbnailCache().Trim();
 }
 
 void ContentBrowser::BuildFolderTree()
@@ -1187,8 +1189,6 @@ void ContentBrowser::DrawContentArea(FolderNode* folder)
                 AssetHandle h = AssetDatabase::Get().GetHandle(assetPath);
                 const bool selected = m_pSelectedAsset && m_pSelectedAsset->Get() == h;
 
-                AssetRef<Texture2DAsset> thumbnail = AssetDatabase::Get().GetThumbnail(h);
-
                 const float cardWidth = iconSize;
                 const float cardHeight = iconSize + ImGui::GetTextLineHeight() * 2.4f;
 
@@ -1202,6 +1202,10 @@ void ContentBrowser::DrawContentArea(FolderNode* folder)
                 const bool hovered = ImGui::IsItemHovered();
                 const bool pressed = ImGui::IsItemClicked();
 
+                // Only cards on screen ask for a thumbnail, so scrolling a large folder decodes what is seen
+                std::shared_ptr<Texture2D> thumbnail =
+                    ImGui::IsItemVisible() ? AssetDatabase::Get().GetThumbnail(h) : nullptr;
+
                 if (pressed && m_pSelectedAsset)
                     m_pSelectedAsset->Set(h);
 
@@ -1265,10 +1269,10 @@ void ContentBrowser::DrawContentArea(FolderNode* folder)
                     cardPos.x + cardWidth - thumbPadding,
                     cardPos.y + cardWidth - thumbPadding);
 
-                if (thumbnail.IsValid())
+                if (thumbnail)
                 {
                     drawList->AddImage(
-                        thumbnail->GetInstance()->GetRendererID(),
+                        thumbnail->GetRendererID(),
                         thumbMin,
                         thumbMax);
                 }
@@ -303,7 +303,7 @@ inline void PropertiesPanel::RenderComponentNode(
 		icon = ICON_FA_IMAGE;
 	else if (cls->name == "SpriteAnimatorComponent")
 		icon = ICON_FA_FILM;
-	else if (cls->name == "BoxCollider2D")
+	else if (cls->name == "BoxCollider2D" || cls->name == "TilemapCollider2D")
 		icon = ICON_FA_DRAW_POLYGON;
 
 	bool hasVisibleProperties = false;
@@ -7,6 +7,13 @@
 #include <UI/IconsFontAwesome7.h>
 
 #include "Assets/AssetDatabase.h"
+#include "Assets/SpriteAtlasRemap.h"
+#include "Assets/Importer/SpriteAtlasImporter.h"
+#include "Core/EditorContext.h"
+
+#include <BoonDebug/Logger.h>
+#include <Core/EngineContext.h>
+#include <Scene/SceneManager.h>
 
 #include <algorithm>
 #include <cstring>
@@ -269,6 +276,11 @@ namespace BoonEditor
         if (EditorIconButton(ICON_FA_FLOPPY_DISK, "Save", false, buttonSize))
             AssetDatabase::Get().Export<SpriteAtlasAsset>(m_Asset);
 
+        ImGui::SameLine(0.0f, 4.0f);
+
+        if (EditorIconButton(ICON_FA_SHUFFLE, "Use packed frames for texture renderers in the active scene", false, buttonSize))
+            RemapSceneTextureRenderers();
+
         ImGui::SameLine(0.0f, 10.0f);
         ImGui::SeparatorEx(ImGuiSeparatorFlags_Vertical);
         ImGui::SameLine(0.0f, 10.0f);
@@ -1645,6 +1657,29 @@ namespace BoonEditor
         return frame;
     }
 
+    void SpriteAtlasEditorPanel::RemapSceneTextureRenderers()
+    {
+        const std::filesystem::path& path = AssetDatabase::Get().GetPath(m_Asset);
+        if (path.empty())
+            return;
+
+        for (const AssetImporterRegistry::AssetRoot& root : ServiceLocator::Get<AssetImporterRegistry>().GetAssetRoots())
+        {
+            const std::filesystem::path sourcePath = root.sourceRoot / path;
+            if (!std::filesystem::exists(sourcePath))
+                continue;
+
+            const std::unordered_map<AssetHandle, int> frames =
+                SpriteAtlasImporter::LoadPackedFrameMap(AssetDatabase::Get().GetLibrary(), sourcePath);
+
+            Scene& scene = GetContext().GetEngineContext().Scenes->GetActiveScene();
+            const size_t count = RemapTextureRenderers(scene, m_Asset, frames);
+
+            BOON_LOG("Remapped {} texture renderers to frames of {}", count, path.generic_string());
+            return;
+        }
+    }
+
     void SpriteAtlasEditorPanel::RestartPreview()
     {
         m_PreviewFrame = 0;
@@ -5,6 +5,7 @@
 
 #include <Renderer/SceneRenderer.h>
 #include <Renderer/Framebuffer.h>
+#include <Scene/Scene.h>
 
 #include <Core/EditorContext.h>
 
@@ -14,6 +15,7 @@
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
 
+#include <algorithm>
 #include <cmath>
 #include <cfloat>
 
@@ -37,7 +39,7 @@ BoonEditor::ViewportPanel::ViewportPanel(
     m_pRenderer = std::make_unique<SceneRenderer>(rendererDesc);
     m_pDebugRenderer = std::make_unique<DebugRenderer>(
         pSceneContext->Get(),
-        m_pRenderer->GetOutputTarget());
+        m_pRenderer.get());
 
     m_pToolbar = std::make_unique<ViewportToolbar>(
         pContext,
@@ -50,6 +52,8 @@ BoonEditor::ViewportPanel::ViewportPanel(
         {
             m_pRenderer->SetContext(pScene);
             m_pDebugRenderer->SetContext(pScene);
+            m_Picker.Clear();
+            m_HoveredGameObject = GameObject();
         });
 }
 
@@ -111,29 +115,28 @@ void BoonEditor::ViewportPanel::Update()
 
     if (!m_pCanvasRenderer && mouseInsideViewport)
     {
-        int pixelData = m_pRenderer->GetOutputTarget()->ReadPixel(1, mouseX, mouseY);
-
-        m_HoveredGameObject =
-            pixelData < 0
-            ? GameObject()
-            : GameObject(static_cast<GameObjectID>(pixelData), m_pSceneContext->Get());
+        UpdateHovered(mouseX, mouseY);
 
         if (input.IsMousePressed(Mouse::ButtonLeft))
             m_pSelectionContext->Set(m_HoveredGameObject);
     }
 
+    if (!m_pCanvasRenderer)
+        UpdateBoxSelection(input, mouseInsideViewport);
+
     if (m_pCanvasRenderer && m_pCanvasRenderer->CanRenderViewport())
     {
         m_pCanvasRenderer->OnViewportCanvasUpdate(CreateCanvasContext());
     }
     else
     {
+        // Overlays are drawn by a pass inside the scene render
+        m_pDebugRenderer->Prepare(m_Settings);
+
         if (m_Camera.GetActive())
             m_pRenderer->Render(&m_Camera.GetCamera(), &m_Camera.GetTransform());
         else
             m_pRenderer->Render();
-
-        m_pDebugRenderer->Render(m_Settings);
     }
 }
 
@@ -143,6 +146,177 @@ void BoonEditor::ViewportPanel::SetContext(SceneContext* pContext)
 
     m_pRenderer->SetContext(pContext->Get());
     m_pDebugRenderer->SetContext(pContext->Get());
+    m_Picker.Clear();
+}
+
+void BoonEditor::ViewportPanel::UpdateHovered(int mouseX, int mouseY)
+{
+    Scene* pScene = m_pSceneContext->Get();
+    if (!pScene)
+        return;
+
+    if (m_Settings.CpuPicking)
+    {
+        m_Picker.Refresh(*pScene);
+
+        GameObjectID picked = NullGameObject;
+        m_Picker.Pick(ViewportToWorld(glm::vec2(mouseX, mouseY)), picked);
+
+        m_HoveredGameObject =
+            picked == NullGameObject
+            ? GameObject()
+            : GameObject(picked, pScene);
+        return;
+    }
+
+    // The id buffer is read back asynchronously: collect what finished since last frame,
+    // then queue this frame's position. The hovered object trails the mouse by a frame or two.
+    Framebuffer* pTarget = m_pRenderer->GetOutputTarget();
+
+    int pixelData = -1;
+    if (pTarget->PollPixel(pixelData))
+        SetHovered(pixelData);
+
+    pTarget->RequestPixel(1, mouseX, mouseY);
+}
+
+void BoonEditor::ViewportPanel::SetHovered(int pixelData)
+{
+    Scene* pScene = m_pSceneContext->Get();
+    GameObjectID id = static_cast<GameObjectID>(pixelData);
+
+    // The readback may describe a frame from before the object was destroyed
+    m_HoveredGameObject =
+        pixelData < 0 || !pScene || !pScene->GetRegistry().valid(id)
+        ? GameObject()
+        : GameObject(id, pScene);
+}
+
+glm::vec2 BoonEditor::ViewportPanel::ViewportToWorld(const glm::vec2& viewportPosition)
+{
+    if (m_ViewportSize.x <= 0.0f || m_ViewportSize.y <= 0.0f)
+        return glm::vec2{ 0.0f };
+
+    const glm::vec2 ndc = (viewportPosition / m_ViewportSize) * 2.0f - 1.0f;
+    const glm::mat4 inverseViewProjection =
+        glm::inverse(m_Camera.GetCamera().GetProjection() * m_Camera.GetView());
+
+    glm::vec4 nearPoint = inverseViewProjection * glm::vec4(ndc, -1.0f, 1.0f);
+    glm::vec4 farPoint = inverseViewProjection * glm::vec4(ndc, 1.0f, 1.0f);
+
+    nearPoint /= nearPoint.w;
+    farPoint /= farPoint.w;
+
+    // Follow the ray through the pixel down to the sprite plane
+    const float dz = nearPoint.z - farPoint.z;
+    if (std::abs(dz) < FLT_EPSILON)
+        return glm::vec2(nearPoint);
+
+    const float t = nearPoint.z / dz;
+    return glm::vec2(nearPoint + (farPoint - nearPoint) * t);
+}
+
+void BoonEditor::ViewportPanel::BoxSelect(const glm::vec2& from, const glm::vec2& to, std::vector<GameObjectID>& outObjects)
+{
+    Scene* pScene = m_pSceneContext->Get();
+    if (!pScene)
+        return;
+
+    m_Picker.Refresh(*pScene);
+
+    const glm::vec2 corners[4] = {
+        ViewportToWorld(from),
+        ViewportToWorld(to),
+        ViewportToWorld({ from.x, to.y }),
+        ViewportToWorld({ to.x, from.y })
+    };
+
+    glm::vec2 min = corners[0];
+    glm::vec2 max = corners[0];
+
+    for (const glm::vec2& corner : corners)
+    {
+        min = glm::min(min, corner);
+        max = glm::max(max, corner);
+    }
+
+    m_Picker.BoxSelect(min, max, outObjects);
+}
+
+void BoonEditor::ViewportPanel::UpdateBoxSelection(Input& input, bool mouseInsideViewport)
+{
+    // Right and left together steer the camera
+    if (input.IsMouseHeld(Mouse::ButtonRight))
+    {
+        m_BoxSelectArmed = false;
+        m_BoxSelecting = false;
+        return;
+    }
+
+    if (input.IsMousePressed(Mouse::ButtonLeft))
+    {
+        m_BoxSelectArmed = mouseInsideViewport;
+        m_BoxSelecting = false;
+        m_BoxSelectStart = m_MousePosition;
+        return;
+    }
+
+    if (!m_BoxSelectArmed)
+        return;
+
+    if (input.IsMouseHeld(Mouse::ButtonLeft))
+    {
+        // A click with a little jitter still selects what is under the mouse
+        if (!m_BoxSelecting && glm::length(m_MousePosition - m_BoxSelectStart) > BoxSelectThreshold)
+            m_BoxSelecting = true;
+        return;
+    }
+
+    m_BoxSelectArmed = false;
+    if (!m_BoxSelecting)
+        return;
+
+    m_BoxSelecting = false;
+
+    const glm::vec2 end = glm::clamp(m_MousePosition, glm::vec2{ 0.0f }, m_ViewportSize);
+
+    m_BoxSelection.clear();
+    BoxSelect(m_BoxSelectStart, end, m_BoxSelection);
+
+    Scene* pScene = m_pSceneContext->Get();
+    m_pSelectionContext->Set(
+        m_BoxSelection.empty() || !pScene
+        ? GameObject()
+        : GameObject(m_BoxSelection.front(), pScene));
+}
+
+void BoonEditor::ViewportPanel::DrawBoxSelection() const
+{
+    if (!m_BoxSelecting)
+        return;
+
+    // Viewport positions have their origin bottom left, screen positions top left
+    auto toScreen = [this](const glm::vec2& position)
+        {
+            const glm::vec2 clamped = glm::clamp(position, glm::vec2{ 0.0f }, m_ViewportSize);
+            return ImVec2{
+                m_ViewportImagePosition.x + clamped.x,
+                m_ViewportImagePosition.y + m_ViewportSize.y - clamped.y };
+        };
+
+    const ImVec2 a = toScreen(m_BoxSelectStart);
+    const ImVec2 b = toScreen(m_MousePosition);
+
+    const ImVec2 min{ std::min(a.x, b.x), std::min(a.y, b.y) };
+    const ImVec2 max{ std::max(a.x, b.x), std::max(a.y, b.y) };
+
+    ImDrawList* drawList = ImGui::GetWindowDrawList();
+
+    ImVec4 color = ImGui::GetStyleColorVec4(ImGuiCol_ButtonActive);
+    drawList->AddRect(min, max, ImGui::GetColorU32(color));
+
+    color.w *= 0.15f;
+    drawList->AddRectFilled(min, max, ImGui::GetColorU32(color));
 }
 
 void BoonEditor::ViewportPanel::OnRenderUI()
@@ -282,6 +456,8 @@ void BoonEditor::ViewportPanel::OnRenderUI()
             ImVec2{ 0.0f, 1.0f },
             ImVec2{ 1.0f, 0.0f }
         );
+
+        DrawBoxSelection();
     }
 
     if (m_pToolbar->GetActiveSetting() == ViewportToolbarSetting::Camera)
@@ -431,5 +607,10 @@ void BoonEditor::ViewportPanel::VisibilitySettings(float posX, float posY, float
             m_Settings.DebugRenderLayers &= ~DebugRenderLayer::Gizmos;
     }
 
+    ImGui::Separator();
+    ImGui::TextUnformatted("Picking");
+
+    UI::Checkbox("CPU picking", m_Settings.CpuPicking);
+
     ImGui::End();
 }
\ No newline at end of file
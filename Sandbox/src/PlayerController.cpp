@@ -171,9 +171,7 @@ void PlayerController::Move(const glm::vec2& dir)
     if (ni.IsAutonomousProxy() || ni.IsSimulatedProxy())
     {
         BClassID clsId = BClassRegistry::Get().Find<PlayerController>()->hash;
-        Variant var{};
-        var.Set<glm::vec2>(dir);
-        ni.pScene->GetRPC()->CallServer(clsId, FNV1a32("Move_Server"), m_Owner.GetUUID(), { var });
+        ni.pScene->GetRPC()->CallServer(clsId, FNV1a32("Move_Server"), m_Owner.GetUUID(), dir);
         return;
     }
 